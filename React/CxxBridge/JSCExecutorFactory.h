@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <jsi/JSCRuntime.h>
 #include <jsireact/JSIExecutor.h>
 
 namespace facebook {
@@ -23,6 +24,7 @@ class JSCExecutorFactory : public JSExecutorFactory {
 
  private:
   JSIExecutor::RuntimeInstaller runtimeInstaller_;
+  jsc::JSCRuntimeFactory runtimeFactory_;
 };
 
 } // namespace react
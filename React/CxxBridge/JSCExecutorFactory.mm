@@ -7,8 +7,6 @@
 
 #include "JSCExecutorFactory.h"
 
-#import <jsi/JSCRuntime.h>
-
 #import <memory>
 
 namespace facebook {
@@ -19,7 +17,7 @@ std::unique_ptr<JSExecutor> JSCExecutorFactory::createJSExecutor(
     std::shared_ptr<MessageQueueThread> __unused jsQueue)
 {
   return std::make_unique<JSIExecutor>(
-      facebook::jsc::makeJSCRuntime(), delegate, JSIExecutor::defaultTimeoutInvoker, runtimeInstaller_);
+      runtimeFactory_.createRuntime(), delegate, JSIExecutor::defaultTimeoutInvoker, runtimeInstaller_);
 }
 
 } // namespace react
@@ -37,11 +37,14 @@ class JSCExecutorFactory : public JSExecutorFactory {
       react::bindNativePerformanceNow(runtime, androidNativePerformanceNow);
     };
     return std::make_unique<JSIExecutor>(
-        jsc::makeJSCRuntime(),
+        runtimeFactory_.createRuntime(),
         delegate,
         JSIExecutor::defaultTimeoutInvoker,
         installBindings);
   }
+
+ private:
+  jsc::JSCRuntimeFactory runtimeFactory_;
 };
 
 } // namespace
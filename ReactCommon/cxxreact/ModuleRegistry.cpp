@@ -33,6 +33,30 @@ std::string normalizeName(std::string name) {
 
 } // namespace
 
+ModuleMethodTable::ModuleMethodTable(std::vector<MethodDescriptor> methods) {
+  size_t namesSize = 0;
+  for (auto const &descriptor : methods) {
+    namesSize += descriptor.name.size();
+  }
+  names_.reserve(namesSize);
+  offsets_.reserve(methods.size() + 1);
+  types_.reserve(methods.size());
+
+  offsets_.push_back(0);
+  for (auto const &descriptor : methods) {
+    names_ += descriptor.name;
+    offsets_.push_back(static_cast<uint32_t>(names_.size()));
+    // TODO: #10487027 compare tags instead of doing string comparison?
+    if (descriptor.type == "promise") {
+      types_.push_back(MethodType::Promise);
+    } else if (descriptor.type == "sync") {
+      types_.push_back(MethodType::Sync);
+    } else {
+      types_.push_back(MethodType::Async);
+    }
+  }
+}
+
 ModuleRegistry::ModuleRegistry(
     std::vector<std::unique_ptr<NativeModule>> modules,
     ModuleNotFoundCallback callback)
@@ -87,9 +111,9 @@ std::vector<std::string> ModuleRegistry::moduleNames() {
   return names;
 }
 
-folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
+folly::Optional<ModuleDescription> ModuleRegistry::getModuleDescription(
     const std::string &name) {
-  SystraceSection s("ModuleRegistry::getConfig", "module", name);
+  SystraceSection s("ModuleRegistry::getModuleDescription", "module", name);
 
   // Initialize modulesByName_
   if (modulesByName_.empty() && !modules_.empty()) {
@@ -136,10 +160,7 @@ folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
   CHECK(index < modules_.size());
   NativeModule *module = modules_[index].get();
 
-  // string name, object constants, array methodNames (methodId is index),
-  // [array promiseMethodIds], [array syncMethodIds]
-  folly::dynamic config = folly::dynamic::array(name);
-
+  folly::dynamic constants;
   {
     SystraceSection s_("ModuleRegistry::getConstants", "module", name);
     /**
@@ -148,44 +169,78 @@ folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
      * event. The Module will be initialized when we invoke one of its
      * NativeModule methods.
      */
-    config.push_back(module->getConstants());
+    constants = module->getConstants();
   }
 
+  std::shared_ptr<const ModuleMethodTable> methods;
   {
     SystraceSection s_("ModuleRegistry::getMethods", "module", name);
-    std::vector<MethodDescriptor> methods = module->getMethods();
+    methods = getMethodTable(index);
+  }
+
+  if (methods->empty() && constants.empty()) {
+    // no constants or methods
+    return folly::none;
+  }
+  return ModuleDescription{index, std::move(constants), std::move(methods)};
+}
 
+folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
+    const std::string &name) {
+  auto description = getModuleDescription(name);
+  if (!description.hasValue()) {
+    return folly::none;
+  }
+
+  // string name, object constants, array methodNames (methodId is index),
+  // [array promiseMethodIds], [array syncMethodIds]
+  folly::dynamic config =
+      folly::dynamic::array(name, std::move(description->constants));
+
+  auto const &methods = *description->methods;
+  if (!methods.empty()) {
     folly::dynamic methodNames = folly::dynamic::array;
     folly::dynamic promiseMethodIds = folly::dynamic::array;
     folly::dynamic syncMethodIds = folly::dynamic::array;
 
-    for (auto &descriptor : methods) {
-      // TODO: #10487027 compare tags instead of doing string comparison?
-      methodNames.push_back(std::move(descriptor.name));
-      if (descriptor.type == "promise") {
-        promiseMethodIds.push_back(methodNames.size() - 1);
-      } else if (descriptor.type == "sync") {
-        syncMethodIds.push_back(methodNames.size() - 1);
+    for (size_t methodId = 0; methodId < methods.size(); methodId++) {
+      methodNames.push_back(methods.getName(methodId).str());
+      switch (methods.getType(methodId)) {
+        case ModuleMethodTable::MethodType::Promise:
+          promiseMethodIds.push_back(methodId);
+          break;
+        case ModuleMethodTable::MethodType::Sync:
+          syncMethodIds.push_back(methodId);
+          break;
+        case ModuleMethodTable::MethodType::Async:
+          break;
       }
     }
 
-    if (!methodNames.empty()) {
-      config.push_back(std::move(methodNames));
-      if (!promiseMethodIds.empty() || !syncMethodIds.empty()) {
-        config.push_back(std::move(promiseMethodIds));
-        if (!syncMethodIds.empty()) {
-          config.push_back(std::move(syncMethodIds));
-        }
+    config.push_back(std::move(methodNames));
+    if (!promiseMethodIds.empty() || !syncMethodIds.empty()) {
+      config.push_back(std::move(promiseMethodIds));
+      if (!syncMethodIds.empty()) {
+        config.push_back(std::move(syncMethodIds));
       }
     }
   }
 
-  if (config.size() == 2 && config[1].empty()) {
-    // no constants or methods
-    return folly::none;
-  } else {
-    return ModuleConfig{index, config};
+  return ModuleConfig{description->index, std::move(config)};
+}
+
+std::shared_ptr<const ModuleMethodTable> ModuleRegistry::getMethodTable(
+    size_t index) {
+  if (methodTables_.size() < modules_.size()) {
+    methodTables_.resize(modules_.size());
+  }
+
+  auto &methodTable = methodTables_[index];
+  if (!methodTable) {
+    methodTable =
+        std::make_shared<ModuleMethodTable>(modules_[index]->getMethods());
   }
+  return methodTable;
 }
 
 std::string ModuleRegistry::getModuleName(unsigned int moduleId) {
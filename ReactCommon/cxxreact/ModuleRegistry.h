@@ -7,12 +7,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <unordered_set>
 #include <vector>
 
 #include <cxxreact/JSExecutor.h>
 #include <folly/Optional.h>
+#include <folly/Range.h>
 #include <folly/dynamic.h>
 
 #ifndef RN_EXPORT
@@ -23,12 +25,59 @@ namespace facebook {
 namespace react {
 
 class NativeModule;
+struct MethodDescriptor;
 
 struct ModuleConfig {
   size_t index;
   folly::dynamic config;
 };
 
+/**
+ * Method names and types of a module, interned into a single buffer.
+ * Method ids are indices into the table.
+ */
+class RN_EXPORT ModuleMethodTable {
+ public:
+  enum class MethodType : uint8_t { Async, Promise, Sync };
+
+  explicit ModuleMethodTable(std::vector<MethodDescriptor> methods);
+
+  size_t size() const {
+    return types_.size();
+  }
+
+  bool empty() const {
+    return types_.empty();
+  }
+
+  folly::StringPiece getName(size_t methodId) const {
+    return folly::StringPiece(
+        names_.data() + offsets_[methodId],
+        names_.data() + offsets_[methodId + 1]);
+  }
+
+  MethodType getType(size_t methodId) const {
+    return types_[methodId];
+  }
+
+ private:
+  // All names back to back; name `i` spans [offsets_[i], offsets_[i + 1]).
+  std::string names_;
+  std::vector<uint32_t> offsets_;
+  std::vector<MethodType> types_;
+};
+
+/**
+ * Everything needed to expose a module to JS.  Unlike ModuleConfig, the
+ * methods are not converted to folly::dynamic, so they can be handed to JS
+ * directly.
+ */
+struct ModuleDescription {
+  size_t index;
+  folly::dynamic constants;
+  std::shared_ptr<const ModuleMethodTable> methods;
+};
+
 class RN_EXPORT ModuleRegistry {
  public:
   // not implemented:
@@ -48,6 +97,8 @@ class RN_EXPORT ModuleRegistry {
   std::vector<std::string> moduleNames();
 
   folly::Optional<ModuleConfig> getConfig(const std::string &name);
+  folly::Optional<ModuleDescription> getModuleDescription(
+      const std::string &name);
 
   void callNativeMethod(
       unsigned int moduleId,
@@ -68,6 +119,12 @@ class RN_EXPORT ModuleRegistry {
   // This is always populated
   std::vector<std::unique_ptr<NativeModule>> modules_;
 
+  // Method tables are built the first time a module is described and are
+  // shared by all later descriptions of it.  Indices match modules_.
+  std::vector<std::shared_ptr<const ModuleMethodTable>> methodTables_;
+
+  std::shared_ptr<const ModuleMethodTable> getMethodTable(size_t index);
+
   // This is used to extend the population of modulesByName_ if registerModules
   // is called after moduleNames
   void updateModuleNamesFromIndex(size_t size);
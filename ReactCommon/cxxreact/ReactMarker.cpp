@@ -7,6 +7,8 @@
 
 #include "ReactMarker.h"
 
+#include "ReactMarkerTimeline.h"
+
 namespace facebook {
 namespace react {
 namespace ReactMarker {
@@ -24,7 +26,14 @@ LogTaggedMarkerWithInstanceKey logTaggedMarkerWithInstanceKey = nullptr;
 #endif
 
 void logMarker(const ReactMarkerId markerId) {
-  logTaggedMarker(markerId, nullptr);
+  logMarker(markerId, nullptr);
+}
+
+void logMarker(const ReactMarkerId markerId, const char *tag) {
+  ReactMarkerTimeline::shared().record(markerId, tag);
+  if (logTaggedMarker) {
+    logTaggedMarker(markerId, tag);
+  }
 }
 
 } // namespace ReactMarker
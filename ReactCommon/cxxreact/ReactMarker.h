@@ -53,6 +53,13 @@ extern RN_EXPORT LogTaggedMarkerWithInstanceKey logTaggedMarkerWithInstanceKey;
 
 extern RN_EXPORT void logMarker(const ReactMarkerId markerId);
 
+/*
+ * Records the marker in `ReactMarkerTimeline::shared()` and forwards it to
+ * `logTaggedMarker` if a platform logger is installed. Prefer this over
+ * calling `logTaggedMarker` directly.
+ */
+extern RN_EXPORT void logMarker(const ReactMarkerId markerId, const char *tag);
+
 } // namespace ReactMarker
 } // namespace react
 } // namespace facebook
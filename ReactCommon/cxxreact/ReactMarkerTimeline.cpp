@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ReactMarkerTimeline.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+enum class MarkerKind { Start, Stop, Instant };
+
+struct MarkerInfo {
+  const char *name;
+  MarkerKind kind;
+};
+
+MarkerInfo getMarkerInfo(ReactMarker::ReactMarkerId markerId) {
+  switch (markerId) {
+    case ReactMarker::NATIVE_REQUIRE_START:
+      return {"NATIVE_REQUIRE", MarkerKind::Start};
+    case ReactMarker::NATIVE_REQUIRE_STOP:
+      return {"NATIVE_REQUIRE", MarkerKind::Stop};
+    case ReactMarker::RUN_JS_BUNDLE_START:
+      return {"RUN_JS_BUNDLE", MarkerKind::Start};
+    case ReactMarker::RUN_JS_BUNDLE_STOP:
+      return {"RUN_JS_BUNDLE", MarkerKind::Stop};
+    case ReactMarker::CREATE_REACT_CONTEXT_STOP:
+      return {"CREATE_REACT_CONTEXT_STOP", MarkerKind::Instant};
+    case ReactMarker::JS_BUNDLE_STRING_CONVERT_START:
+      return {"JS_BUNDLE_STRING_CONVERT", MarkerKind::Start};
+    case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
+      return {"JS_BUNDLE_STRING_CONVERT", MarkerKind::Stop};
+    case ReactMarker::NATIVE_MODULE_SETUP_START:
+      return {"NATIVE_MODULE_SETUP", MarkerKind::Start};
+    case ReactMarker::NATIVE_MODULE_SETUP_STOP:
+      return {"NATIVE_MODULE_SETUP", MarkerKind::Stop};
+    case ReactMarker::REGISTER_JS_SEGMENT_START:
+      return {"REGISTER_JS_SEGMENT", MarkerKind::Start};
+    case ReactMarker::REGISTER_JS_SEGMENT_STOP:
+      return {"REGISTER_JS_SEGMENT", MarkerKind::Stop};
+    case ReactMarker::REACT_INSTANCE_INIT_START:
+      return {"REACT_INSTANCE_INIT", MarkerKind::Start};
+    case ReactMarker::REACT_INSTANCE_INIT_STOP:
+      return {"REACT_INSTANCE_INIT", MarkerKind::Stop};
+  }
+  return {"UNKNOWN", MarkerKind::Instant};
+}
+
+uint32_t getCurrentThreadId() {
+  static std::atomic<uint32_t> nextThreadId{1};
+  static thread_local uint32_t threadId =
+      nextThreadId.fetch_add(1, std::memory_order_relaxed);
+  return threadId;
+}
+
+int64_t toNanoseconds(ReactMarkerTimeline::Clock::time_point timePoint) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             timePoint.time_since_epoch())
+      .count();
+}
+
+void writeJsonString(std::ostream &os, std::string const &string) {
+  os << '"';
+  for (char c : string) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << ' ';
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+void writeTimestamp(
+    std::ostream &os,
+    ReactMarkerTimeline::Clock::time_point timePoint) {
+  // Microseconds with nanosecond precision.
+  auto nanoseconds = toNanoseconds(timePoint);
+  os << nanoseconds / 1000 << '.' << std::setfill('0') << std::setw(3)
+     << nanoseconds % 1000 << std::setfill(' ');
+}
+
+} // namespace
+
+constexpr size_t ReactMarkerTimeline::kCapacity;
+constexpr size_t ReactMarkerTimeline::kMaxTagLength;
+constexpr size_t ReactMarkerTimeline::kTagWords;
+
+ReactMarkerTimeline &ReactMarkerTimeline::shared() {
+  static auto &timeline = *new ReactMarkerTimeline();
+  return timeline;
+}
+
+ReactMarkerTimeline::ReactMarkerTimeline()
+    : slots_(std::make_unique<Slot[]>(kCapacity)) {}
+
+void ReactMarkerTimeline::record(
+    ReactMarker::ReactMarkerId markerId,
+    const char *tag) {
+  auto timestamp = toNanoseconds(Clock::now());
+  auto index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+  auto &slot = slots_[index % kCapacity];
+
+  std::array<uint64_t, kTagWords> tagWords{};
+  if (tag) {
+    auto length = std::min(strlen(tag), kMaxTagLength);
+    memcpy(tagWords.data(), tag, length);
+  }
+
+  slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.markerId.store(markerId, std::memory_order_relaxed);
+  slot.timestamp.store(timestamp, std::memory_order_relaxed);
+  slot.threadId.store(getCurrentThreadId(), std::memory_order_relaxed);
+  for (size_t i = 0; i < kTagWords; i++) {
+    slot.tag[i].store(tagWords[i], std::memory_order_relaxed);
+  }
+  slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+std::vector<ReactMarkerTimeline::Entry> ReactMarkerTimeline::getEntries()
+    const {
+  auto endIndex = nextIndex_.load(std::memory_order_acquire);
+  auto beginIndex = std::max(
+      firstIndex_.load(std::memory_order_relaxed),
+      endIndex > kCapacity ? endIndex - kCapacity : 0);
+
+  std::vector<Entry> entries;
+  entries.reserve(endIndex - beginIndex);
+  for (auto index = beginIndex; index < endIndex; index++) {
+    auto const &slot = slots_[index % kCapacity];
+    if (slot.sequence.load(std::memory_order_acquire) != 2 * index + 2) {
+      continue;
+    }
+
+    auto markerId = slot.markerId.load(std::memory_order_relaxed);
+    auto timestamp = slot.timestamp.load(std::memory_order_relaxed);
+    auto threadId = slot.threadId.load(std::memory_order_relaxed);
+    std::array<uint64_t, kTagWords + 1> tagWords{};
+    for (size_t i = 0; i < kTagWords; i++) {
+      tagWords[i] = slot.tag[i].load(std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != 2 * index + 2) {
+      // Overwritten while reading.
+      continue;
+    }
+
+    entries.push_back(
+        {static_cast<ReactMarker::ReactMarkerId>(markerId),
+         Clock::time_point(std::chrono::nanoseconds(timestamp)),
+         threadId,
+         std::string(reinterpret_cast<const char *>(tagWords.data()))});
+  }
+  return entries;
+}
+
+void ReactMarkerTimeline::clear() {
+  firstIndex_.store(
+      nextIndex_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void ReactMarkerTimeline::writeChromeTrace(
+    std::ostream &os,
+    std::vector<Span> const &spans) const {
+  os << "{\"traceEvents\":[";
+  auto separator = "";
+
+  for (auto const &entry : getEntries()) {
+    auto info = getMarkerInfo(entry.markerId);
+    os << separator << "{\"name\":\"" << info.name
+       << "\",\"cat\":\"ReactMarker\",\"pid\":0,\"tid\":" << entry.threadId
+       << ",\"ts\":";
+    writeTimestamp(os, entry.timePoint);
+    switch (info.kind) {
+      case MarkerKind::Start:
+      case MarkerKind::Stop:
+        // Async events, so markers started and stopped on different
+        // threads still pair up.
+        os << ",\"ph\":\"" << (info.kind == MarkerKind::Start ? 'b' : 'e')
+           << "\",\"id\":";
+        writeJsonString(os, entry.tag);
+        break;
+      case MarkerKind::Instant:
+        os << ",\"ph\":\"i\",\"s\":\"p\"";
+        break;
+    }
+    os << ",\"args\":{\"tag\":";
+    writeJsonString(os, entry.tag);
+    os << "}}";
+    separator = ",";
+  }
+
+  for (auto const &span : spans) {
+    os << separator << "{\"name\":";
+    writeJsonString(os, span.name);
+    os << ",\"cat\":\"Telemetry\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":";
+    writeTimestamp(os, span.start);
+    os << ",\"dur\":";
+    writeTimestamp(os, Clock::time_point(span.end - span.start));
+    os << "}";
+    separator = ",";
+  }
+
+  os << "],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool ReactMarkerTimeline::dumpChromeTrace(
+    std::string const &path,
+    std::vector<Span> const &spans) const {
+  std::ofstream file(path);
+  if (!file) {
+    return false;
+  }
+  writeChromeTrace(file, spans);
+  return static_cast<bool>(file);
+}
+
+} // namespace react
+} // namespace facebook
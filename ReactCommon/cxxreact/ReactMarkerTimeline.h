@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <cxxreact/ReactMarker.h>
+
+#ifndef RN_EXPORT
+#define RN_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace facebook {
+namespace react {
+
+/*
+ * In-process record of the most recent markers logged through
+ * `ReactMarker::logMarker`, independent of the platform logger.
+ * Recording is lock-free and safe from any thread; once the buffer is full
+ * the oldest markers are overwritten.
+ */
+class RN_EXPORT ReactMarkerTimeline final {
+ public:
+  /*
+   * Same clock as `TelemetryClock`, so marker times can be compared with
+   * `TransactionTelemetry` times directly.
+   */
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr size_t kCapacity = 1024;
+  static constexpr size_t kMaxTagLength = 31;
+
+  struct Entry {
+    ReactMarker::ReactMarkerId markerId;
+    Clock::time_point timePoint;
+    // Small number identifying the thread which logged the marker.
+    uint32_t threadId;
+    // Tag of the marker, truncated to `kMaxTagLength` bytes.
+    std::string tag;
+  };
+
+  /*
+   * A span of time to show next to the markers, e.g. the commit phase of a
+   * `TransactionTelemetry`.
+   */
+  struct Span {
+    std::string name;
+    Clock::time_point start;
+    Clock::time_point end;
+  };
+
+  /*
+   * The timeline `ReactMarker::logMarker` records to.
+   */
+  static ReactMarkerTimeline &shared();
+
+  ReactMarkerTimeline();
+
+  void record(ReactMarker::ReactMarkerId markerId, const char *tag);
+
+  /*
+   * Returns the recorded markers, oldest first. Markers which are being
+   * recorded or overwritten concurrently are skipped.
+   */
+  std::vector<Entry> getEntries() const;
+
+  void clear();
+
+  /*
+   * Writes the recorded markers and the given spans in the Chrome
+   * trace-event format (chrome://tracing, Perfetto). `_START` and `_STOP`
+   * markers with the same tag become async slices.
+   */
+  void writeChromeTrace(std::ostream &os, std::vector<Span> const &spans = {})
+      const;
+
+  /*
+   * Same as `writeChromeTrace`, writing to the file at `path`. Returns false
+   * if the file cannot be written.
+   */
+  bool dumpChromeTrace(
+      std::string const &path,
+      std::vector<Span> const &spans = {}) const;
+
+ private:
+  static constexpr size_t kTagWords = (kMaxTagLength + 1) / sizeof(uint64_t);
+
+  /*
+   * Every field is atomic, so readers never race with writers; `sequence`
+   * tells readers whether the fields they read belong together (seqlock).
+   * It is `2 * index + 1` while the entry with the given `index` is being
+   * written, and `2 * index + 2` once it is complete.
+   */
+  struct Slot {
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<int> markerId{0};
+    std::atomic<int64_t> timestamp{0};
+    std::atomic<uint32_t> threadId{0};
+    std::array<std::atomic<uint64_t>, kTagWords> tag{};
+  };
+
+  std::atomic<uint64_t> nextIndex_{0};
+  // Entries before this index were cleared.
+  std::atomic<uint64_t> firstIndex_{0};
+  std::unique_ptr<Slot[]> slots_;
+};
+
+} // namespace react
+} // namespace facebook
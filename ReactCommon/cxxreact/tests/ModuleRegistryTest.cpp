@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include <gtest/gtest.h>
+#pragma GCC diagnostic pop
+
+using namespace facebook;
+using namespace facebook::react;
+using namespace folly;
+
+namespace {
+
+class TestModule : public NativeModule {
+ public:
+  TestModule(
+      std::string name,
+      std::vector<MethodDescriptor> methods,
+      dynamic constants)
+      : name_(std::move(name)),
+        methods_(std::move(methods)),
+        constants_(std::move(constants)) {}
+
+  std::string getName() override {
+    return name_;
+  }
+  std::string getSyncMethodName(unsigned int methodId) override {
+    return methods_[methodId].name;
+  }
+  std::vector<MethodDescriptor> getMethods() override {
+    numberOfGetMethodsCalls++;
+    return methods_;
+  }
+  dynamic getConstants() override {
+    return constants_;
+  }
+  void invoke(unsigned int, dynamic &&, int) override {}
+  MethodCallResult callSerializableNativeHook(unsigned int, dynamic &&)
+      override {
+    return none;
+  }
+
+  int numberOfGetMethodsCalls{0};
+
+ private:
+  std::string name_;
+  std::vector<MethodDescriptor> methods_;
+  dynamic constants_;
+};
+
+} // namespace
+
+TEST(ModuleRegistry, MethodTable) {
+  ModuleMethodTable table({
+      MethodDescriptor("show", "async"),
+      MethodDescriptor("fetch", "promise"),
+      MethodDescriptor("", "async"),
+      MethodDescriptor("measure", "sync"),
+  });
+
+  ASSERT_EQ(4, table.size());
+  EXPECT_EQ("show", table.getName(0));
+  EXPECT_EQ("fetch", table.getName(1));
+  EXPECT_EQ("", table.getName(2));
+  EXPECT_EQ("measure", table.getName(3));
+  EXPECT_EQ(ModuleMethodTable::MethodType::Async, table.getType(0));
+  EXPECT_EQ(ModuleMethodTable::MethodType::Promise, table.getType(1));
+  EXPECT_EQ(ModuleMethodTable::MethodType::Sync, table.getType(3));
+}
+
+TEST(ModuleRegistry, GetConfig) {
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::make_unique<TestModule>(
+      "RCTToast",
+      std::vector<MethodDescriptor>{
+          MethodDescriptor("show", "async"),
+          MethodDescriptor("fetch", "promise"),
+          MethodDescriptor("measure", "sync"),
+      },
+      dynamic::object("LONG", 1)));
+  modules.push_back(std::make_unique<TestModule>(
+      "Constants",
+      std::vector<MethodDescriptor>{},
+      dynamic::object("version", "1.0")));
+  modules.push_back(std::make_unique<TestModule>(
+      "Empty", std::vector<MethodDescriptor>{}, nullptr));
+  auto toast = static_cast<TestModule *>(modules[0].get());
+  ModuleRegistry registry(std::move(modules));
+
+  auto toastConfig = registry.getConfig("Toast");
+  ASSERT_TRUE(toastConfig.hasValue());
+  EXPECT_EQ(0, toastConfig->index);
+  EXPECT_EQ(
+      dynamic::array(
+          "Toast",
+          dynamic::object("LONG", 1),
+          dynamic::array("show", "fetch", "measure"),
+          dynamic::array(1),
+          dynamic::array(2)),
+      toastConfig->config);
+
+  auto constantsConfig = registry.getConfig("Constants");
+  ASSERT_TRUE(constantsConfig.hasValue());
+  EXPECT_EQ(
+      dynamic::array("Constants", dynamic::object("version", "1.0")),
+      constantsConfig->config);
+
+  EXPECT_FALSE(registry.getConfig("Empty").hasValue());
+  EXPECT_FALSE(registry.getConfig("Unknown").hasValue());
+
+  // The method table is built once and shared by later descriptions.
+  auto description = registry.getModuleDescription("Toast");
+  ASSERT_TRUE(description.hasValue());
+  EXPECT_EQ(3, description->methods->size());
+  EXPECT_EQ(1, toast->numberOfGetMethodsCalls);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/ReactMarkerTimeline.h>
+
+#include <sstream>
+#include <thread>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include <gtest/gtest.h>
+#pragma GCC diagnostic pop
+
+using namespace facebook::react;
+
+TEST(ReactMarkerTimeline, RecordsMarkersInOrder) {
+  ReactMarkerTimeline timeline;
+  timeline.record(ReactMarker::RUN_JS_BUNDLE_START, "index.bundle");
+  timeline.record(ReactMarker::RUN_JS_BUNDLE_STOP, "index.bundle");
+  timeline.record(ReactMarker::CREATE_REACT_CONTEXT_STOP, nullptr);
+
+  auto entries = timeline.getEntries();
+  ASSERT_EQ(3, entries.size());
+  EXPECT_EQ(ReactMarker::RUN_JS_BUNDLE_START, entries[0].markerId);
+  EXPECT_EQ("index.bundle", entries[0].tag);
+  EXPECT_EQ(ReactMarker::RUN_JS_BUNDLE_STOP, entries[1].markerId);
+  EXPECT_EQ(ReactMarker::CREATE_REACT_CONTEXT_STOP, entries[2].markerId);
+  EXPECT_EQ("", entries[2].tag);
+  EXPECT_LE(entries[0].timePoint, entries[1].timePoint);
+  EXPECT_LE(entries[1].timePoint, entries[2].timePoint);
+  EXPECT_EQ(entries[0].threadId, entries[2].threadId);
+}
+
+TEST(ReactMarkerTimeline, TruncatesTags) {
+  ReactMarkerTimeline timeline;
+  std::string tag(100, 'x');
+  timeline.record(ReactMarker::NATIVE_MODULE_SETUP_START, tag.c_str());
+
+  auto entries = timeline.getEntries();
+  ASSERT_EQ(1, entries.size());
+  EXPECT_EQ(tag.substr(0, ReactMarkerTimeline::kMaxTagLength), entries[0].tag);
+}
+
+TEST(ReactMarkerTimeline, KeepsMostRecentMarkers) {
+  ReactMarkerTimeline timeline;
+  for (size_t i = 0; i < ReactMarkerTimeline::kCapacity + 10; i++) {
+    timeline.record(
+        ReactMarker::NATIVE_MODULE_SETUP_START, std::to_string(i).c_str());
+  }
+
+  auto entries = timeline.getEntries();
+  ASSERT_EQ(ReactMarkerTimeline::kCapacity, entries.size());
+  EXPECT_EQ("10", entries.front().tag);
+  EXPECT_EQ(
+      std::to_string(ReactMarkerTimeline::kCapacity + 9), entries.back().tag);
+
+  timeline.clear();
+  EXPECT_TRUE(timeline.getEntries().empty());
+  timeline.record(ReactMarker::NATIVE_MODULE_SETUP_STOP, nullptr);
+  EXPECT_EQ(1, timeline.getEntries().size());
+}
+
+TEST(ReactMarkerTimeline, RecordsThreads) {
+  ReactMarkerTimeline timeline;
+  timeline.record(ReactMarker::NATIVE_REQUIRE_START, nullptr);
+  std::thread([&] {
+    timeline.record(ReactMarker::NATIVE_REQUIRE_STOP, nullptr);
+  }).join();
+
+  auto entries = timeline.getEntries();
+  ASSERT_EQ(2, entries.size());
+  EXPECT_NE(entries[0].threadId, entries[1].threadId);
+}
+
+TEST(ReactMarkerTimeline, WritesChromeTrace) {
+  ReactMarkerTimeline timeline;
+  timeline.record(ReactMarker::NATIVE_MODULE_SETUP_START, "UIManager");
+  timeline.record(ReactMarker::NATIVE_MODULE_SETUP_STOP, "UIManager");
+  auto now = ReactMarkerTimeline::Clock::now();
+
+  std::ostringstream os;
+  timeline.writeChromeTrace(
+      os, {{"commit", now, now + std::chrono::microseconds(1500)}});
+  auto trace = os.str();
+
+  EXPECT_EQ(0, trace.find("{\"traceEvents\":["));
+  EXPECT_NE(
+      std::string::npos,
+      trace.find("\"name\":\"NATIVE_MODULE_SETUP\",\"cat\":\"ReactMarker\""));
+  EXPECT_NE(std::string::npos, trace.find("\"ph\":\"b\",\"id\":\"UIManager\""));
+  EXPECT_NE(std::string::npos, trace.find("\"ph\":\"e\",\"id\":\"UIManager\""));
+  EXPECT_NE(
+      std::string::npos,
+      trace.find("\"name\":\"commit\",\"cat\":\"Telemetry\",\"ph\":\"X\""));
+  EXPECT_NE(std::string::npos, trace.find("\"dur\":1500.000"));
+}
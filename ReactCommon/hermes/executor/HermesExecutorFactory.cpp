@@ -217,8 +217,15 @@ std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
           .getPropertyAsObject(*decoratedRuntime, "prototype");
   errorPrototype.setProperty(*decoratedRuntime, "jsEngine", "hermes");
 
+  // The profiler goes on top of the chain, so every host function
+  // installed by JSIExecutor, Fabric and TurboModules is attributed.
+  std::shared_ptr<jsi::Runtime> runtime = decoratedRuntime;
+  if (hostFunctionProfiler_) {
+    runtime = jsi::makeProfilingRuntime(runtime, hostFunctionProfiler_);
+  }
+
   return std::make_unique<HermesExecutor>(
-      decoratedRuntime, delegate, jsQueue, timeoutInvoker_, runtimeInstaller_);
+      runtime, delegate, jsQueue, timeoutInvoker_, runtimeInstaller_);
 }
 
 HermesExecutor::HermesExecutor(
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hermes/hermes.h>
+#include <jsi/profiler.h>
 #include <jsireact/JSIExecutor.h>
 #include <functional>
 #include <utility>
@@ -32,10 +33,18 @@ class HermesExecutorFactory : public JSExecutorFactory {
       std::shared_ptr<ExecutorDelegate> delegate,
       std::shared_ptr<MessageQueueThread> jsQueue) override;
 
+  // When set, runtimes created by this factory report the latency of
+  // every host function to `profiler`.  Meant for profiling builds only.
+  void setHostFunctionProfiler(
+      std::shared_ptr<jsi::HostFunctionProfiler> profiler) {
+    hostFunctionProfiler_ = std::move(profiler);
+  }
+
  private:
   JSIExecutor::RuntimeInstaller runtimeInstaller_;
   JSIScopedTimeoutInvoker timeoutInvoker_;
   ::hermes::vm::RuntimeConfig runtimeConfig_;
+  std::shared_ptr<jsi::HostFunctionProfiler> hostFunctionProfiler_;
 };
 
 class HermesExecutor : public JSIExecutor {
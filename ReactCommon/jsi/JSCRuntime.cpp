@@ -8,11 +8,23 @@
 #include "JSCRuntime.h"
 
 #include <JavaScriptCore/JavaScript.h>
-#include <jsi/jsilib.h>
+#ifdef __APPLE__
+#include <JavaScriptCore/JSStringRefCF.h>
+#endif
+#if defined(__has_include)
+#if __has_include(<JavaScriptCore/JSScriptRefPrivate.h>)
+// JSC API which evaluates scripts referencing their text instead of copying it.
+// It is not public, so only builds against JSC headers which have it use it.
+#include <JavaScriptCore/JSScriptRefPrivate.h>
+#define JSC_HAS_IMMORTAL_SCRIPTS 1
+#endif
+#endif
 #include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstdlib>
+#include <cstring>
+#include <list>
 #include <mutex>
 #include <queue>
 #include <sstream>
@@ -26,6 +38,7 @@ class ArgsConverter;
 } // namespace detail
 
 class JSCRuntime;
+class JSCPreparedJavaScript;
 
 struct Lock {
   void lock(const jsc::JSCRuntime &) const {}
@@ -35,7 +48,9 @@ struct Lock {
 class JSCRuntime : public jsi::Runtime {
  public:
   // Creates new context in new context group
-  JSCRuntime();
+  JSCRuntime(
+      std::shared_ptr<PreparedJavaScriptCache> preparedJavaScriptCache =
+          nullptr);
   // Retains ctx
   JSCRuntime(JSGlobalContextRef ctx);
   ~JSCRuntime();
@@ -156,9 +171,19 @@ class JSCRuntime : public jsi::Runtime {
   jsi::String createStringFromAscii(const char *str, size_t length) override;
   jsi::String createStringFromUtf8(const uint8_t *utf8, size_t length) override;
   std::string utf8(const jsi::String &) override;
+  void getStringData(
+      const jsi::String &str,
+      void *ctx,
+      StringDataCallback cb) override;
+  void getPropNameIdData(
+      const jsi::PropNameID &sym,
+      void *ctx,
+      StringDataCallback cb) override;
 
   jsi::Object createObject() override;
   jsi::Object createObject(std::shared_ptr<jsi::HostObject> ho) override;
+  jsi::ArrayBuffer createArrayBuffer(
+      std::shared_ptr<jsi::MutableBuffer> buffer) override;
   virtual std::shared_ptr<jsi::HostObject> getHostObject(
       const jsi::Object &) override;
   jsi::HostFunctionType &getHostFunction(const jsi::Function &) override;
@@ -241,9 +266,20 @@ class JSCRuntime : public jsi::Runtime {
   void checkException(JSValueRef exc, const char *msg);
   void checkException(JSValueRef res, JSValueRef exc, const char *msg);
 
+  std::shared_ptr<const JSCPreparedJavaScript> prepare(
+      const std::shared_ptr<const jsi::Buffer> &buffer,
+      std::string sourceURL);
+
   JSGlobalContextRef ctx_;
   std::atomic<bool> ctxInvalid_;
   std::string desc_;
+  std::shared_ptr<PreparedJavaScriptCache> preparedJavaScriptCache_;
+#if JSC_HAS_IMMORTAL_SCRIPTS
+  // Whether the context (and its VM) goes away with this runtime, so the text
+  // of evaluated scripts can be kept until then (see `immortalSources_`).
+  bool ownsContextGroup_{false};
+  std::vector<std::shared_ptr<const jsi::Buffer>> immortalSources_;
+#endif
 #ifndef NDEBUG
   mutable std::atomic<intptr_t> objectCounter_;
   mutable std::atomic<intptr_t> symbolCounter_;
@@ -324,6 +360,27 @@ std::string JSStringToSTLString(JSStringRef str) {
   return std::string(buffer, actualBytes - 1);
 }
 
+// Calls `cb` with the characters of the string. Short ASCII strings (the
+// common case for property names) are read into a stack buffer; anything else
+// is passed as the UTF-16 representation which JSC keeps for the string.
+void getJSStringData(
+    JSStringRef str,
+    void *ctx,
+    void (*cb)(void *ctx, bool ascii, const void *data, size_t num)) {
+  size_t length = JSStringGetLength(str);
+  std::array<char, 256> stackBuffer;
+  // Reading can not be truncated if the worst case fits into the buffer. Every
+  // non-ASCII UTF-16 code unit takes more than one byte of UTF-8, so the
+  // string is ASCII if and only if it has as many bytes as code units.
+  if (JSStringGetMaximumUTF8CStringSize(str) <= stackBuffer.size() &&
+      JSStringGetUTF8CString(str, stackBuffer.data(), stackBuffer.size()) ==
+          length + 1) {
+    cb(ctx, true, stackBuffer.data(), length);
+    return;
+  }
+  cb(ctx, false, JSStringGetCharactersPtr(str), length);
+}
+
 JSStringRef getLengthString() {
   static JSStringRef length = JSStringCreateWithUTF8CString("length");
   return length;
@@ -352,6 +409,184 @@ JSStringRef getIsArrayString() {
 #endif
 } // namespace
 
+// Prepared scripts
+namespace {
+
+#if JSC_HAS_IMMORTAL_SCRIPTS || defined(__APPLE__)
+// Whether the buffer contains 7-bit ASCII text only. Buffers which know it are
+// not read.
+bool isAsciiBuffer(const jsi::Buffer &buffer) {
+  if (auto describedBuffer =
+          dynamic_cast<const jsi::DescribedBuffer *>(&buffer)) {
+    return describedBuffer->isAscii();
+  }
+  const uint8_t *data = buffer.data();
+  size_t size = buffer.size();
+  uint64_t bits = 0;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    bits |= word;
+  }
+  for (; i < size; i++) {
+    bits |= data[i];
+  }
+  return (bits & 0x8080808080808080ull) == 0;
+}
+#endif
+
+uint64_t versionOfBuffer(const jsi::Buffer &buffer) {
+  auto describedBuffer = dynamic_cast<const jsi::DescribedBuffer *>(&buffer);
+  return describedBuffer ? describedBuffer->version() : 0;
+}
+
+// Creates a JSC string from the UTF-8 contents of the buffer.
+JSStringRef createSourceString(const jsi::Buffer &buffer, bool isAscii) {
+#ifdef __APPLE__
+  if (isAscii) {
+    // ASCII text is Latin-1 text, which JSC reads from the buffer as is.
+    // `JSStringCreateWithUTF8CString` transcodes the whole text to UTF-16
+    // first, even if it turns out to be ASCII.
+    CFStringRef string = CFStringCreateWithBytesNoCopy(
+        kCFAllocatorDefault,
+        buffer.data(),
+        buffer.size(),
+        kCFStringEncodingISOLatin1,
+        false,
+        kCFAllocatorNull);
+    JSStringRef result = JSStringCreateWithCFString(string);
+    CFRelease(string);
+    return result;
+  }
+#endif
+  if (dynamic_cast<const jsi::NullTerminatedBuffer *>(&buffer)) {
+    return JSStringCreateWithUTF8CString(
+        reinterpret_cast<const char *>(buffer.data()));
+  }
+  std::string tmp(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+  return JSStringCreateWithUTF8CString(tmp.c_str());
+}
+
+} // namespace
+
+// The source of a script, ready to be evaluated by any number of JSCRuntimes,
+// including the ones created after a reload. ASCII text is referenced in place
+// where JSC allows it (see `immortalSource`). Otherwise the text is converted
+// to a JSC string once (JSC strings are immutable and thread-safe reference
+// counted) and the original buffer is not retained.
+class JSCPreparedJavaScript final : public jsi::PreparedJavaScript {
+ public:
+  JSCPreparedJavaScript(
+      const std::shared_ptr<const jsi::Buffer> &buffer,
+      std::string sourceURL)
+      : sourceURLRef_(
+            sourceURL.empty()
+                ? nullptr
+                : JSStringCreateWithUTF8CString(sourceURL.c_str())),
+        sourceURL_(std::move(sourceURL)),
+        size_(buffer->size()),
+        version_(versionOfBuffer(*buffer)) {
+#if JSC_HAS_IMMORTAL_SCRIPTS || defined(__APPLE__)
+    auto isAscii = isAsciiBuffer(*buffer);
+#else
+    // Other JSC builds have no faster way to read ASCII text.
+    auto isAscii = false;
+#endif
+#if JSC_HAS_IMMORTAL_SCRIPTS
+    if (isAscii) {
+      immortalSource_ = buffer;
+      return;
+    }
+#endif
+    source_ = createSourceString(*buffer, isAscii);
+  }
+
+  ~JSCPreparedJavaScript() {
+    if (source_) {
+      JSStringRelease(source_);
+    }
+    if (sourceURLRef_) {
+      JSStringRelease(sourceURLRef_);
+    }
+  }
+
+  // The converted text; null if the script has an immortal source.
+  JSStringRef source() const {
+    return source_;
+  }
+
+  // ASCII text which JSC scripts reference instead of copying it, so it has
+  // to outlive the VMs of the runtimes which evaluated it.
+  const std::shared_ptr<const jsi::Buffer> &immortalSource() const {
+    return immortalSource_;
+  }
+
+  JSStringRef sourceURLRef() const {
+    return sourceURLRef_;
+  }
+
+  bool matches(const std::string &sourceURL, size_t size, uint64_t version)
+      const {
+    return version_ == version && size_ == size && sourceURL_ == sourceURL;
+  }
+
+ private:
+  JSStringRef source_{nullptr};
+  std::shared_ptr<const jsi::Buffer> immortalSource_;
+  JSStringRef sourceURLRef_;
+  std::string sourceURL_;
+  size_t size_;
+  uint64_t version_;
+};
+
+// Prepared scripts of the runtimes of one `JSCRuntimeFactory`, keyed by source
+// URL, size and version of their buffers (see `jsi::DescribedBuffer`), so
+// evaluating an unchanged bundle again neither reads nor converts it.
+// Holds at most `maxEntries` most recently used scripts.
+class PreparedJavaScriptCache {
+ public:
+  PreparedJavaScriptCache(size_t maxEntries) : maxEntries_(maxEntries) {}
+
+  std::shared_ptr<const JSCPreparedJavaScript> get(
+      const std::shared_ptr<const jsi::Buffer> &buffer,
+      const std::string &sourceURL,
+      uint64_t version) {
+    auto size = buffer->size();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if ((*it)->matches(sourceURL, size, version)) {
+          entries_.splice(entries_.begin(), entries_, it);
+          return entries_.front();
+        }
+      }
+    }
+
+    // Converting the source may take a while; do not block other runtimes.
+    auto prepared =
+        std::make_shared<const JSCPreparedJavaScript>(buffer, sourceURL);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_front(prepared);
+    if (entries_.size() > maxEntries_) {
+      entries_.pop_back();
+    }
+    return prepared;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+ private:
+  size_t maxEntries_;
+  std::list<std::shared_ptr<const JSCPreparedJavaScript>> entries_;
+  std::mutex mutex_;
+};
+
 // std::string utility
 namespace {
 std::string to_string(void *value) {
@@ -361,9 +596,14 @@ std::string to_string(void *value) {
 }
 } // namespace
 
-JSCRuntime::JSCRuntime()
+JSCRuntime::JSCRuntime(
+    std::shared_ptr<PreparedJavaScriptCache> preparedJavaScriptCache)
     : JSCRuntime(JSGlobalContextCreateInGroup(nullptr, nullptr)) {
   JSGlobalContextRelease(ctx_);
+  preparedJavaScriptCache_ = std::move(preparedJavaScriptCache);
+#if JSC_HAS_IMMORTAL_SCRIPTS
+  ownsContextGroup_ = true;
+#endif
 }
 
 JSCRuntime::JSCRuntime(JSGlobalContextRef ctx)
@@ -394,42 +634,74 @@ JSCRuntime::~JSCRuntime() {
 #endif
 }
 
-std::shared_ptr<const jsi::PreparedJavaScript> JSCRuntime::prepareJavaScript(
+std::shared_ptr<const JSCPreparedJavaScript> JSCRuntime::prepare(
     const std::shared_ptr<const jsi::Buffer> &buffer,
     std::string sourceURL) {
-  return std::make_shared<jsi::SourceJavaScriptPreparation>(
+  auto version = versionOfBuffer(*buffer);
+  if (preparedJavaScriptCache_ && version != 0) {
+    return preparedJavaScriptCache_->get(buffer, sourceURL, version);
+  }
+  return std::make_shared<const JSCPreparedJavaScript>(
       buffer, std::move(sourceURL));
 }
 
+std::shared_ptr<const jsi::PreparedJavaScript> JSCRuntime::prepareJavaScript(
+    const std::shared_ptr<const jsi::Buffer> &buffer,
+    std::string sourceURL) {
+  return prepare(buffer, std::move(sourceURL));
+}
+
 jsi::Value JSCRuntime::evaluatePreparedJavaScript(
     const std::shared_ptr<const jsi::PreparedJavaScript> &js) {
   assert(
-      dynamic_cast<const jsi::SourceJavaScriptPreparation *>(js.get()) &&
-      "preparedJavaScript must be a SourceJavaScriptPreparation");
-  auto sourceJs =
-      std::static_pointer_cast<const jsi::SourceJavaScriptPreparation>(js);
-  return evaluateJavaScript(sourceJs, sourceJs->sourceURL());
+      dynamic_cast<const JSCPreparedJavaScript *>(js.get()) &&
+      "preparedJavaScript must be a JSCPreparedJavaScript");
+  auto preparedJs = static_cast<const JSCPreparedJavaScript *>(js.get());
+  JSStringRef sourceRef = preparedJs->source();
+  JSValueRef exc = nullptr;
+
+#if JSC_HAS_IMMORTAL_SCRIPTS
+  if (auto &immortalSource = preparedJs->immortalSource()) {
+    JSScriptRef script = nullptr;
+    if (ownsContextGroup_) {
+      script = JSScriptCreateReferencingImmortalASCIIText(
+          JSContextGetGroup(ctx_),
+          preparedJs->sourceURLRef(),
+          0,
+          reinterpret_cast<const char *>(immortalSource->data()),
+          immortalSource->size(),
+          nullptr,
+          nullptr);
+    }
+    if (script) {
+      // Functions of the script keep referencing its text.
+      immortalSources_.push_back(immortalSource);
+      JSValueRef res = JSScriptEvaluate(ctx_, script, nullptr, &exc);
+      JSScriptRelease(script);
+      checkException(res, exc);
+      return createValue(res);
+    }
+    // Evaluating a copy of the text instead reports syntax errors as
+    // exceptions.
+    sourceRef = createSourceString(*immortalSource, true);
+    JSValueRef res = JSEvaluateScript(
+        ctx_, sourceRef, nullptr, preparedJs->sourceURLRef(), 0, &exc);
+    JSStringRelease(sourceRef);
+    checkException(res, exc);
+    return createValue(res);
+  }
+#endif
+
+  JSValueRef res = JSEvaluateScript(
+      ctx_, sourceRef, nullptr, preparedJs->sourceURLRef(), 0, &exc);
+  checkException(res, exc);
+  return createValue(res);
 }
 
 jsi::Value JSCRuntime::evaluateJavaScript(
     const std::shared_ptr<const jsi::Buffer> &buffer,
     const std::string &sourceURL) {
-  std::string tmp(
-      reinterpret_cast<const char *>(buffer->data()), buffer->size());
-  JSStringRef sourceRef = JSStringCreateWithUTF8CString(tmp.c_str());
-  JSStringRef sourceURLRef = nullptr;
-  if (!sourceURL.empty()) {
-    sourceURLRef = JSStringCreateWithUTF8CString(sourceURL.c_str());
-  }
-  JSValueRef exc = nullptr;
-  JSValueRef res =
-      JSEvaluateScript(ctx_, sourceRef, nullptr, sourceURLRef, 0, &exc);
-  JSStringRelease(sourceRef);
-  if (sourceURLRef) {
-    JSStringRelease(sourceURLRef);
-  }
-  checkException(res, exc);
-  return createValue(res);
+  return evaluatePreparedJavaScript(prepare(buffer, sourceURL));
 }
 
 jsi::Object JSCRuntime::global() {
@@ -679,6 +951,20 @@ std::string JSCRuntime::utf8(const jsi::String &str) {
   return JSStringToSTLString(stringRef(str));
 }
 
+void JSCRuntime::getStringData(
+    const jsi::String &str,
+    void *ctx,
+    StringDataCallback cb) {
+  getJSStringData(stringRef(str), ctx, cb);
+}
+
+void JSCRuntime::getPropNameIdData(
+    const jsi::PropNameID &sym,
+    void *ctx,
+    StringDataCallback cb) {
+  getJSStringData(stringRef(sym), ctx, cb);
+}
+
 jsi::Object JSCRuntime::createObject() {
   return createObject(static_cast<JSObjectRef>(nullptr));
 }
@@ -937,6 +1223,31 @@ bool JSCRuntime::isArrayBuffer(const jsi::Object &obj) const {
 #endif
 }
 
+jsi::ArrayBuffer JSCRuntime::createArrayBuffer(
+    std::shared_ptr<jsi::MutableBuffer> buffer) {
+#if defined(_JSC_NO_ARRAY_BUFFERS)
+  throw std::runtime_error("Unsupported");
+#else
+  auto size = buffer->size();
+  auto data = buffer->data();
+  // The ArrayBuffer owns a reference to the buffer which is dropped when the
+  // ArrayBuffer is garbage collected (or right away if creating it fails).
+  auto context = new std::shared_ptr<jsi::MutableBuffer>(std::move(buffer));
+  JSValueRef exc = nullptr;
+  JSObjectRef obj = JSObjectMakeArrayBufferWithBytesNoCopy(
+      ctx_,
+      data,
+      size,
+      [](void *, void *context) {
+        delete static_cast<std::shared_ptr<jsi::MutableBuffer> *>(context);
+      },
+      context,
+      &exc);
+  checkException(obj, exc);
+  return createObject(obj).getArrayBuffer(*this);
+#endif
+}
+
 uint8_t *JSCRuntime::data(const jsi::ArrayBuffer &obj) {
 #if defined(_JSC_NO_ARRAY_BUFFERS)
   throw std::runtime_error("Unsupported");
@@ -1469,5 +1780,16 @@ std::unique_ptr<jsi::Runtime> makeJSCRuntime() {
   return std::make_unique<JSCRuntime>();
 }
 
+JSCRuntimeFactory::JSCRuntimeFactory(size_t maxCachedScripts)
+    : cache_(std::make_shared<PreparedJavaScriptCache>(maxCachedScripts)) {}
+
+std::unique_ptr<jsi::Runtime> JSCRuntimeFactory::createRuntime() const {
+  return std::make_unique<JSCRuntime>(cache_);
+}
+
+void JSCRuntimeFactory::clearPreparedJavaScriptCache() const {
+  cache_->clear();
+}
+
 } // namespace jsc
 } // namespace facebook
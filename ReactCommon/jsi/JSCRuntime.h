@@ -13,7 +13,26 @@
 namespace facebook {
 namespace jsc {
 
+class PreparedJavaScriptCache;
+
 std::unique_ptr<jsi::Runtime> makeJSCRuntime();
 
+// Creates JSCRuntimes which share the scripts they prepare from buffers of a
+// known version (see `jsi::DescribedBuffer`), keeping at most
+// `maxCachedScripts` of them. Evaluating the same bundle in another runtime of
+// the factory, e.g. after a reload, then does not convert it again.
+class JSCRuntimeFactory {
+ public:
+  explicit JSCRuntimeFactory(size_t maxCachedScripts = 2);
+
+  std::unique_ptr<jsi::Runtime> createRuntime() const;
+
+  // Drops the cached scripts; call it under memory pressure.
+  void clearPreparedJavaScriptCache() const;
+
+ private:
+  std::shared_ptr<PreparedJavaScriptCache> cache_;
+};
+
 } // namespace jsc
 } // namespace facebook
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/JSCRuntime.h>
+#include <sys/resource.h>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace jsc {
+
+// Peak RSS never goes down, so compare scenarios by running one benchmark per
+// process (`--benchmark_filter=<name>`).
+
+// A bundle-sized (~4MB) ASCII script.
+static std::string const &bundle() {
+  static auto const &source = *new std::string([] {
+    auto source = std::string{};
+    for (int i = 0; i < 40000; i++) {
+      source += "var module" + std::to_string(i) +
+          " = function (exports) { exports.value = 'lorem ipsum dolor sit "
+          "amet, consectetur adipiscing elit'; return exports; };\n";
+    }
+    return source;
+  }());
+  return source;
+}
+
+// Same contents as `jsi::StringBuffer` but without the NUL-termination
+// guarantee, so runtimes have to copy it.
+class OpaqueBuffer : public jsi::Buffer {
+ public:
+  OpaqueBuffer(std::string const &string) : string_(string) {}
+
+  size_t size() const override {
+    return string_.size();
+  }
+
+  uint8_t const *data() const override {
+    return reinterpret_cast<uint8_t const *>(string_.data());
+  }
+
+ private:
+  std::string const &string_;
+};
+
+// Like a memory-mapped bundle: not NUL-terminated, but known to be ASCII and
+// unchanged.
+class MappedBuffer : public jsi::DescribedBuffer {
+ public:
+  MappedBuffer(std::string const &string) : string_(string) {}
+
+  size_t size() const override {
+    return string_.size();
+  }
+
+  uint8_t const *data() const override {
+    return reinterpret_cast<uint8_t const *>(string_.data());
+  }
+
+  bool isAscii() const override {
+    return true;
+  }
+
+  uint64_t version() const override {
+    return 1;
+  }
+
+ private:
+  std::string const &string_;
+};
+
+static void reportPeakRSS(benchmark::State &state) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  // `ru_maxrss` is in bytes on Apple platforms.
+  state.counters["peakRSS(MB)"] = double(usage.ru_maxrss) / (1024 * 1024);
+}
+
+static void evaluate(
+    benchmark::State &state,
+    std::shared_ptr<jsi::Buffer const> const &buffer,
+    bool reuseCache) {
+  auto runtimeFactory = JSCRuntimeFactory{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    if (!reuseCache) {
+      runtimeFactory.clearPreparedJavaScriptCache();
+    }
+    auto runtime = runtimeFactory.createRuntime();
+    state.ResumeTiming();
+
+    runtime->evaluateJavaScript(buffer, "bundle.js");
+
+    state.PauseTiming();
+    runtime.reset();
+    state.ResumeTiming();
+  }
+  reportPeakRSS(state);
+}
+
+static void evaluatingCopiedBundle(benchmark::State &state) {
+  evaluate(state, std::make_shared<OpaqueBuffer const>(bundle()), false);
+}
+BENCHMARK(evaluatingCopiedBundle);
+
+static void evaluatingNullTerminatedBundle(benchmark::State &state) {
+  evaluate(state, std::make_shared<jsi::StringBuffer const>(bundle()), false);
+}
+BENCHMARK(evaluatingNullTerminatedBundle);
+
+static void evaluatingMappedBundle(benchmark::State &state) {
+  evaluate(state, std::make_shared<MappedBuffer const>(bundle()), false);
+}
+BENCHMARK(evaluatingMappedBundle);
+
+static void reevaluatingBundleAfterReload(benchmark::State &state) {
+  evaluate(state, std::make_shared<MappedBuffer const>(bundle()), true);
+}
+BENCHMARK(reevaluatingBundleAfterReload);
+
+} // namespace jsc
+} // namespace facebook
+
+BENCHMARK_MAIN();
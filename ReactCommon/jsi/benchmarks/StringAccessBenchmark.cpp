@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/JSCRuntime.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace jsc {
+
+// Property names of a typical `style` prop object; a workload similar to
+// parsing props or looking up module methods.
+static std::vector<std::string> const &propertyNames() {
+  static auto const &names = *new std::vector<std::string>{
+      "width",          "height",          "backgroundColor", "borderRadius",
+      "marginTop",      "marginBottom",    "paddingLeft",     "paddingRight",
+      "flexDirection",  "alignItems",      "justifyContent",  "opacity",
+      "transform",      "shadowColor",     "shadowOffset",    "shadowRadius",
+      "borderTopWidth", "borderLeftColor", "overflow",        "position"};
+  return names;
+}
+
+static jsi::Array getPropertyNames(jsi::Runtime &runtime) {
+  auto object = jsi::Object(runtime);
+  for (auto const &name : propertyNames()) {
+    object.setProperty(runtime, name.c_str(), 1);
+  }
+  return object.getPropertyNames(runtime);
+}
+
+static void readingStringsAsUtf8(benchmark::State &state) {
+  auto runtime = makeJSCRuntime();
+  auto names = getPropertyNames(*runtime);
+  auto count = names.size(*runtime);
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; i++) {
+      auto name = names.getValueAtIndex(*runtime, i).getString(*runtime);
+      benchmark::DoNotOptimize(name.utf8(*runtime));
+    }
+  }
+}
+BENCHMARK(readingStringsAsUtf8);
+
+static void readingStringsIntoBuffer(benchmark::State &state) {
+  auto runtime = makeJSCRuntime();
+  auto names = getPropertyNames(*runtime);
+  auto count = names.size(*runtime);
+  auto buffer = std::string{};
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; i++) {
+      auto name = names.getValueAtIndex(*runtime, i).getString(*runtime);
+      name.utf8(*runtime, buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+}
+BENCHMARK(readingStringsIntoBuffer);
+
+static void readingStringData(benchmark::State &state) {
+  auto runtime = makeJSCRuntime();
+  auto names = getPropertyNames(*runtime);
+  auto count = names.size(*runtime);
+  auto totalLength = size_t{0};
+  auto callback = [&](bool ascii, void const *data, size_t length) {
+    totalLength += length;
+  };
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; i++) {
+      auto name = names.getValueAtIndex(*runtime, i).getString(*runtime);
+      name.getStringData(*runtime, callback);
+    }
+  }
+  benchmark::DoNotOptimize(totalLength);
+}
+BENCHMARK(readingStringData);
+
+static void comparingPropNameIDsAsUtf8(benchmark::State &state) {
+  auto runtime = makeJSCRuntime();
+  auto name =
+      jsi::PropNameID::forAscii(*runtime, "configureNextLayoutAnimation");
+  for (auto _ : state) {
+    for (auto const &candidate : propertyNames()) {
+      benchmark::DoNotOptimize(name.utf8(*runtime) == candidate);
+    }
+  }
+}
+BENCHMARK(comparingPropNameIDsAsUtf8);
+
+static void comparingPropNameIDsAsAscii(benchmark::State &state) {
+  auto runtime = makeJSCRuntime();
+  auto name =
+      jsi::PropNameID::forAscii(*runtime, "configureNextLayoutAnimation");
+  for (auto _ : state) {
+    for (auto const &candidate : propertyNames()) {
+      benchmark::DoNotOptimize(
+          name.equalsAscii(*runtime, candidate.data(), candidate.size()));
+    }
+  }
+}
+BENCHMARK(comparingPropNameIDsAsAscii);
+
+} // namespace jsc
+} // namespace facebook
@@ -193,6 +193,18 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
   std::string utf8(const String& s) override {
     return plain_.utf8(s);
   }
+  void getStringData(
+      const String& s,
+      void* ctx,
+      Runtime::StringDataCallback cb) override {
+    plain_.getStringData(s, ctx, cb);
+  }
+  void getPropNameIdData(
+      const PropNameID& id,
+      void* ctx,
+      Runtime::StringDataCallback cb) override {
+    plain_.getPropNameIdData(id, ctx, cb);
+  }
 
   Object createObject() override {
     return plain_.createObject();
@@ -319,6 +331,10 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
   bool instanceOf(const Object& o, const Function& f) override {
     return plain_.instanceOf(o, f);
   };
+  ArrayBuffer createArrayBuffer(
+      std::shared_ptr<MutableBuffer> buffer) override {
+    return plain_.createArrayBuffer(std::move(buffer));
+  };
 
   // jsi::Instrumentation methods
 
@@ -564,6 +580,20 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     return RD::utf8(s);
   }
+  void getStringData(
+      const String& s,
+      void* ctx,
+      Runtime::StringDataCallback cb) override {
+    Around around{with_};
+    RD::getStringData(s, ctx, cb);
+  }
+  void getPropNameIdData(
+      const PropNameID& id,
+      void* ctx,
+      Runtime::StringDataCallback cb) override {
+    Around around{with_};
+    RD::getPropNameIdData(id, ctx, cb);
+  }
 
   Object createObject() override {
     Around around{with_};
@@ -717,6 +747,11 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     return RD::instanceOf(o, f);
   };
+  ArrayBuffer createArrayBuffer(
+      std::shared_ptr<MutableBuffer> buffer) override {
+    Around around{with_};
+    return RD::createArrayBuffer(std::move(buffer));
+  };
 
  private:
   // Wrap an RAII type around With& to guarantee after always happens.
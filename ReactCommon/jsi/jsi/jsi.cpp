@@ -8,6 +8,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 
 #include <jsi/instrumentation.h>
@@ -58,6 +59,151 @@ Value callGlobalFunction(Runtime& runtime, const char* name, const Value& arg) {
   return f.call(runtime, arg);
 }
 
+bool isAscii(const char* str, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    if (static_cast<unsigned char>(str[i]) > 0x7f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Decodes UTF-8, replacing malformed sequences with U+FFFD.
+std::u16string convertUtf8ToUtf16(const std::string& utf8) {
+  std::u16string utf16;
+  utf16.reserve(utf8.size());
+  size_t i = 0;
+  while (i < utf8.size()) {
+    unsigned char lead = utf8[i];
+    char32_t codePoint;
+    size_t length;
+    if (lead < 0x80) {
+      codePoint = lead;
+      length = 1;
+    } else if ((lead & 0xe0) == 0xc0) {
+      codePoint = lead & 0x1f;
+      length = 2;
+    } else if ((lead & 0xf0) == 0xe0) {
+      codePoint = lead & 0x0f;
+      length = 3;
+    } else if ((lead & 0xf8) == 0xf0) {
+      codePoint = lead & 0x07;
+      length = 4;
+    } else {
+      utf16.push_back(0xfffd);
+      i++;
+      continue;
+    }
+    if (i + length > utf8.size()) {
+      utf16.push_back(0xfffd);
+      break;
+    }
+    bool valid = true;
+    for (size_t j = 1; j < length; ++j) {
+      unsigned char trail = utf8[i + j];
+      if ((trail & 0xc0) != 0x80) {
+        valid = false;
+        break;
+      }
+      codePoint = (codePoint << 6) | (trail & 0x3f);
+    }
+    if (!valid) {
+      utf16.push_back(0xfffd);
+      i++;
+      continue;
+    }
+    i += length;
+    if (codePoint >= 0x10000) {
+      codePoint -= 0x10000;
+      utf16.push_back(static_cast<char16_t>(0xd800 + (codePoint >> 10)));
+      utf16.push_back(static_cast<char16_t>(0xdc00 + (codePoint & 0x3ff)));
+    } else {
+      utf16.push_back(static_cast<char16_t>(codePoint));
+    }
+  }
+  return utf16;
+}
+
+// Encodes UTF-16, replacing unpaired surrogates with U+FFFD.
+void appendUtf16AsUtf8(std::string& utf8, const char16_t* utf16, size_t num) {
+  for (size_t i = 0; i < num; ++i) {
+    char32_t codePoint = utf16[i];
+    if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+      if (codePoint <= 0xdbff && i + 1 < num && utf16[i + 1] >= 0xdc00 &&
+          utf16[i + 1] <= 0xdfff) {
+        codePoint = 0x10000 + ((codePoint - 0xd800) << 10) +
+            (utf16[i + 1] - 0xdc00);
+        i++;
+      } else {
+        codePoint = 0xfffd;
+      }
+    }
+    if (codePoint < 0x80) {
+      utf8.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+      utf8.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+      utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    } else if (codePoint < 0x10000) {
+      utf8.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+      utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+      utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    } else {
+      utf8.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+      utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+      utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+      utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+  }
+}
+
+void callWithUtf8Data(
+    const std::string& utf8,
+    void* ctx,
+    void (*cb)(void* ctx, bool ascii, const void* data, size_t num)) {
+  if (isAscii(utf8.data(), utf8.size())) {
+    cb(ctx, true, utf8.data(), utf8.size());
+    return;
+  }
+  std::u16string utf16 = convertUtf8ToUtf16(utf8);
+  cb(ctx, false, utf16.data(), utf16.size());
+}
+
+struct Utf8Writer {
+  std::string& buffer;
+
+  void operator()(bool ascii, const void* data, size_t num) {
+    buffer.clear();
+    if (ascii) {
+      buffer.append(static_cast<const char*>(data), num);
+    } else {
+      appendUtf16AsUtf8(buffer, static_cast<const char16_t*>(data), num);
+    }
+  }
+};
+
+struct AsciiComparator {
+  const char* str;
+  size_t length;
+  bool equal;
+
+  void operator()(bool ascii, const void* data, size_t num) {
+    if (num != length) {
+      equal = false;
+    } else if (ascii) {
+      equal = memcmp(data, str, num) == 0;
+    } else {
+      auto utf16 = static_cast<const char16_t*>(data);
+      equal = true;
+      for (size_t i = 0; i < num; ++i) {
+        if (utf16[i] != static_cast<unsigned char>(str[i])) {
+          equal = false;
+          break;
+        }
+      }
+    }
+  }
+};
+
 } // namespace
 
 namespace detail {
@@ -70,6 +216,8 @@ void throwJSError(Runtime& rt, const char* msg) {
 
 Buffer::~Buffer() = default;
 
+MutableBuffer::~MutableBuffer() = default;
+
 PreparedJavaScript::~PreparedJavaScript() = default;
 
 Value HostObject::get(Runtime&, const PropNameID&) {
@@ -133,6 +281,20 @@ Instrumentation& Runtime::instrumentation() {
   return sharedInstance;
 }
 
+void Runtime::getStringData(
+    const String& str,
+    void* ctx,
+    StringDataCallback cb) {
+  callWithUtf8Data(utf8(str), ctx, cb);
+}
+
+void Runtime::getPropNameIdData(
+    const PropNameID& sym,
+    void* ctx,
+    StringDataCallback cb) {
+  callWithUtf8Data(utf8(sym), ctx, cb);
+}
+
 Value Runtime::createValueFromJsonUtf8(const uint8_t* json, size_t length) {
   Function parseJson = global()
                            .getPropertyAsObject(*this, "JSON")
@@ -149,6 +311,23 @@ Pointer& Pointer::operator=(Pointer&& other) {
   return *this;
 }
 
+void PropNameID::utf8(Runtime& runtime, std::string& buffer) const {
+  Utf8Writer writer{buffer};
+  getPropNameIdData(runtime, writer);
+}
+
+bool PropNameID::equalsAscii(Runtime& runtime, const char* str, size_t length)
+    const {
+  AsciiComparator comparator{str, length, false};
+  getPropNameIdData(runtime, comparator);
+  return comparator.equal;
+}
+
+void String::utf8(Runtime& runtime, std::string& buffer) const {
+  Utf8Writer writer{buffer};
+  getStringData(runtime, writer);
+}
+
 Object Object::getPropertyAsObject(Runtime& runtime, const char* name) const {
   Value v = getProperty(runtime, name);
 
@@ -368,6 +547,11 @@ Runtime::ScopeState* Runtime::pushScope() {
 
 void Runtime::popScope(ScopeState*) {}
 
+ArrayBuffer Runtime::createArrayBuffer(std::shared_ptr<MutableBuffer>) {
+  throw JSINativeException(
+      "This runtime cannot create ArrayBuffers of native memory");
+}
+
 JSError::JSError(Runtime& rt, Value&& value) {
   setValue(rt, std::move(value));
 }
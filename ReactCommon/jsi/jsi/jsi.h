@@ -38,7 +38,24 @@ class JSI_EXPORT Buffer {
   virtual const uint8_t* data() const = 0;
 };
 
-class JSI_EXPORT StringBuffer : public Buffer {
+/// A Buffer whose data is followed by a '\0' byte which is not included in
+/// size().  Runtimes which consume C strings can use such a buffer in place
+/// instead of copying it to append a terminator.
+class JSI_EXPORT NullTerminatedBuffer : public Buffer {};
+
+/// A Buffer which knows facts about its contents that runtimes would otherwise
+/// have to read all of them to find out, e.g. a memory-mapped bundle.
+class JSI_EXPORT DescribedBuffer : public Buffer {
+ public:
+  /// Whether the contents are 7-bit ASCII text.
+  virtual bool isAscii() const = 0;
+  /// Buffers of the same source and size which have the same non-zero version
+  /// have the same contents (e.g. the version identifies the file a buffer
+  /// maps and its modification time).  0 if the version is unknown.
+  virtual uint64_t version() const = 0;
+};
+
+class JSI_EXPORT StringBuffer : public NullTerminatedBuffer {
  public:
   StringBuffer(std::string s) : s_(std::move(s)) {}
   size_t size() const override {
@@ -52,6 +69,18 @@ class JSI_EXPORT StringBuffer : public Buffer {
   std::string s_;
 };
 
+/// Base class for buffers of data which are handed over to the runtime, e.g.
+/// as the backing store of an ArrayBuffer.  The result of size() and data()
+/// must not change after construction, but the contents of the region pointed
+/// to by data() may be modified by both native code and JavaScript; any
+/// synchronization of those accesses is the responsibility of the user.
+class JSI_EXPORT MutableBuffer {
+ public:
+  virtual ~MutableBuffer();
+  virtual size_t size() const = 0;
+  virtual uint8_t* data() = 0;
+};
+
 /// PreparedJavaScript is a base class representing JavaScript which is in a
 /// form optimized for execution, in a runtime-specific way. Construct one via
 /// jsi::Runtime::prepareJavaScript().
@@ -312,6 +341,23 @@ class JSI_EXPORT Runtime {
 
   virtual bool instanceOf(const Object& o, const Function& f) = 0;
 
+  /// \return an ArrayBuffer which exposes the memory of \c buffer without
+  /// copying it.  The default implementation throws a JSINativeException;
+  /// runtimes which can wrap external memory override it.
+  virtual ArrayBuffer createArrayBuffer(std::shared_ptr<MutableBuffer> buffer);
+
+  /// Calls \c cb with the characters of a string or a PropNameID, without
+  /// copying them to the heap if the runtime can avoid it.  \c data points
+  /// to \c num ASCII characters if \c ascii is true, and to \c num UTF-16
+  /// code units otherwise; it is only valid during the call.  The default
+  /// implementations convert the result of utf8().
+  using StringDataCallback =
+      void (*)(void* ctx, bool ascii, const void* data, size_t num);
+  virtual void
+  getStringData(const String& str, void* ctx, StringDataCallback cb);
+  virtual void
+  getPropNameIdData(const PropNameID& sym, void* ctx, StringDataCallback cb);
+
   // These exist so derived classes can access the private parts of
   // Value, Symbol, String, and Object, which are all friends of Runtime.
   template <typename T>
@@ -407,6 +453,27 @@ class JSI_EXPORT PropNameID : public Pointer {
     return runtime.utf8(*this);
   }
 
+  /// Copies the data in a PropNameID as utf8 into \c buffer, reusing its
+  /// capacity.
+  void utf8(Runtime& runtime, std::string& buffer) const;
+
+  /// Calls \c cb(bool ascii, const void* data, size_t num) with a view of the
+  /// characters of the PropNameID (see Runtime::getPropNameIdData).
+  template <typename CB>
+  void getPropNameIdData(Runtime& runtime, CB& cb) const {
+    runtime.getPropNameIdData(
+        *this, &cb, [](void* ctx, bool ascii, const void* data, size_t num) {
+          (*static_cast<CB*>(ctx))(ascii, data, num);
+        });
+  }
+
+  /// \return whether the PropNameID is equal to the given ASCII string.
+  /// Does not allocate.
+  bool equalsAscii(Runtime& runtime, const char* str, size_t length) const;
+  bool equalsAscii(Runtime& runtime, const char* str) const {
+    return equalsAscii(runtime, str, strlen(str));
+  }
+
   static bool compare(
       Runtime& runtime,
       const jsi::PropNameID& a,
@@ -496,6 +563,20 @@ class JSI_EXPORT String : public Pointer {
     return runtime.utf8(*this);
   }
 
+  /// Copies the data in a JS string as utf8 into \c buffer, reusing its
+  /// capacity.
+  void utf8(Runtime& runtime, std::string& buffer) const;
+
+  /// Calls \c cb(bool ascii, const void* data, size_t num) with a view of the
+  /// characters of the string (see Runtime::getStringData).
+  template <typename CB>
+  void getStringData(Runtime& runtime, CB& cb) const {
+    runtime.getStringData(
+        *this, &cb, [](void* ctx, bool ascii, const void* data, size_t num) {
+          (*static_cast<CB*>(ctx))(ascii, data, num);
+        });
+  }
+
   friend class Runtime;
   friend class Value;
 };
@@ -774,6 +855,13 @@ class JSI_EXPORT ArrayBuffer : public Object {
   ArrayBuffer(ArrayBuffer&&) = default;
   ArrayBuffer& operator=(ArrayBuffer&&) = default;
 
+  /// Creates an ArrayBuffer which exposes the memory of \c buffer to
+  /// JavaScript without copying it.  The runtime keeps \c buffer alive until
+  /// the ArrayBuffer is garbage collected.  Throws a JSINativeException if
+  /// the runtime does not support it.
+  ArrayBuffer(Runtime& runtime, std::shared_ptr<MutableBuffer> buffer)
+      : ArrayBuffer(runtime.createArrayBuffer(std::move(buffer))) {}
+
   /// \return the size of the ArrayBuffer, according to its byteLength property.
   /// (C++ naming convention)
   size_t size(Runtime& runtime) const {
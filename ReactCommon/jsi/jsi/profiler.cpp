@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/profiler.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include <jsi/decorator.h>
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+using Clock = HostFunctionProfiler::Clock;
+using Entry = HostFunctionProfiler::Entry;
+
+// A host function or host object call which is being timed.
+struct SampledCall {
+  // Depth of the JSI calls made by the host code; the conversion timer
+  // only runs while it is non-zero.
+  unsigned jsiDepth{0};
+  Clock::time_point jsiStart;
+  Clock::duration conversionTime{0};
+};
+
+// Per runtime state of the profiler.  It is also the "With" type of the
+// decorator, so before() and after() bracket every JSI call made through
+// the profiling runtime.
+struct ProfilingState {
+  void before() {
+    if (activeCall && activeCall->jsiDepth++ == 0) {
+      activeCall->jsiStart = Clock::now();
+    }
+  }
+
+  void after() {
+    if (activeCall && --activeCall->jsiDepth == 0) {
+      activeCall->conversionTime += Clock::now() - activeCall->jsiStart;
+    }
+  }
+
+  // Innermost call being timed, if any.  A nested host call replaces it
+  // for its duration and restores it before the enclosing JSI call
+  // returns, so before() and after() always see the same call.
+  SampledCall* activeCall{nullptr};
+  // Label of the host object whose get() is running, if any.
+  std::string const* owner{nullptr};
+};
+
+class SampledCallScope {
+ public:
+  SampledCallScope(
+      ProfilingState& state,
+      HostFunctionProfiler& profiler,
+      Entry& entry)
+      : state_(state),
+        profiler_(profiler),
+        entry_(entry),
+        previousCall_(state.activeCall),
+        start_(Clock::now()) {
+    state_.activeCall = &call_;
+  }
+
+  ~SampledCallScope() {
+    auto end = Clock::now();
+    state_.activeCall = previousCall_;
+    profiler_.didCall(entry_, start_, end, call_.conversionTime);
+  }
+
+ private:
+  ProfilingState& state_;
+  HostFunctionProfiler& profiler_;
+  Entry& entry_;
+  SampledCall call_;
+  SampledCall* previousCall_;
+  Clock::time_point start_;
+};
+
+class ProfilingRuntime;
+
+class ProfilingHostObject : public DecoratedHostObject {
+ public:
+  ProfilingHostObject(
+      ProfilingRuntime& runtime,
+      std::shared_ptr<HostObject> plainHO);
+
+  Value get(Runtime& rt, const PropNameID& name) override;
+
+  bool hasLabel() const {
+    return !label_.empty();
+  }
+
+  void setLabel(std::string label) {
+    label_ = std::move(label);
+    entry_ = nullptr;
+  }
+
+ private:
+  ProfilingRuntime& runtime_;
+  std::string label_;
+  Entry* entry_{nullptr};
+};
+
+// Stored inside a DecoratedHostFunction, so getHostFunction() can still
+// return the function which was passed to the runtime.
+struct ProfiledHostFunction {
+  Value operator()(
+      Runtime& rt,
+      const Value& thisVal,
+      const Value* args,
+      size_t count);
+
+  ProfilingRuntime& runtime;
+  Entry& entry;
+  HostFunctionType func;
+};
+
+class ProfilingRuntime : public WithRuntimeDecorator<ProfilingState> {
+  using Base = WithRuntimeDecorator<ProfilingState>;
+
+ public:
+  ProfilingRuntime(
+      std::shared_ptr<Runtime> runtime,
+      std::shared_ptr<HostFunctionProfiler> profiler)
+      : Base(*runtime, state_),
+        runtime_(std::move(runtime)),
+        profiler_(std::move(profiler)) {}
+
+  ProfilingState& state() {
+    return state_;
+  }
+
+  HostFunctionProfiler& profiler() {
+    return *profiler_;
+  }
+
+  // Labels `value` with the result of `makeLabel()` if it is a profiled
+  // host object which has not been labelled yet.
+  template <typename MakeLabel>
+  void labelHostObject(const Value& value, MakeLabel&& makeLabel) {
+    if (!value.isObject()) {
+      return;
+    }
+    auto object = value.getObject(plain());
+    if (!object.isHostObject<ProfilingHostObject>(plain())) {
+      return;
+    }
+    auto hostObject = object.getHostObject<ProfilingHostObject>(plain());
+    if (!hostObject->hasLabel()) {
+      hostObject->setLabel(makeLabel());
+    }
+  }
+
+ protected:
+  Object createObject(std::shared_ptr<HostObject> ho) override {
+    return Object::createFromHostObject(
+        plain(), std::make_shared<ProfilingHostObject>(*this, std::move(ho)));
+  }
+
+  HostFunctionType& getHostFunction(const jsi::Function& f) override {
+    HostFunctionType& hf = Base::getHostFunction(f);
+    if (auto profiled = hf.target<ProfiledHostFunction>()) {
+      return profiled->func;
+    }
+    return hf;
+  }
+
+  void setPropertyValue(Object& o, const PropNameID& name, const Value& value)
+      override {
+    Base::setPropertyValue(o, name, value);
+    labelHostObject(value, [&] { return name.utf8(plain()); });
+  }
+
+  void setPropertyValue(Object& o, const String& name, const Value& value)
+      override {
+    Base::setPropertyValue(o, name, value);
+    labelHostObject(value, [&] { return name.utf8(plain()); });
+  }
+
+  Function createFunctionFromHostFunction(
+      const PropNameID& name,
+      unsigned int paramCount,
+      HostFunctionType func) override {
+    auto functionName = name.utf8(plain());
+    auto& entry = profiler_->getEntry(
+        state_.owner ? *state_.owner + "." + functionName : functionName);
+    return Function::createFromHostFunction(
+        plain(),
+        name,
+        paramCount,
+        DecoratedHostFunction(
+            *this, ProfiledHostFunction{*this, entry, std::move(func)}));
+  }
+
+ private:
+  // Keeps the plain runtime alive; the base class only holds a reference.
+  std::shared_ptr<Runtime> runtime_;
+  std::shared_ptr<HostFunctionProfiler> profiler_;
+  ProfilingState state_;
+};
+
+ProfilingHostObject::ProfilingHostObject(
+    ProfilingRuntime& runtime,
+    std::shared_ptr<HostObject> plainHO)
+    : DecoratedHostObject(runtime, std::move(plainHO)), runtime_(runtime) {}
+
+Value ProfilingHostObject::get(Runtime& rt, const PropNameID& name) {
+  auto& state = runtime_.state();
+  auto& profiler = runtime_.profiler();
+
+  // Functions created while resolving a property are attributed to this
+  // host object.
+  struct OwnerScope {
+    OwnerScope(ProfilingState& state, std::string const* owner)
+        : state(state), previousOwner(state.owner) {
+      state.owner = owner;
+    }
+    ~OwnerScope() {
+      state.owner = previousOwner;
+    }
+    ProfilingState& state;
+    std::string const* previousOwner;
+  } ownerScope{state, hasLabel() ? &label_ : nullptr};
+
+  if (!entry_) {
+    entry_ = &profiler.getEntry(
+        (hasLabel() ? label_ : std::string{"HostObject"}) + "[get]");
+  }
+  entry_->numberOfCalls.fetch_add(1, std::memory_order_relaxed);
+
+  if (!profiler.shouldSample()) {
+    return DecoratedHostObject::get(rt, name);
+  }
+
+  SampledCallScope scope{state, profiler, *entry_};
+  return DecoratedHostObject::get(rt, name);
+}
+
+Value ProfiledHostFunction::operator()(
+    Runtime& rt,
+    const Value& thisVal,
+    const Value* args,
+    size_t count) {
+  entry.numberOfCalls.fetch_add(1, std::memory_order_relaxed);
+
+  auto result = [&] {
+    if (!runtime.profiler().shouldSample()) {
+      return func(rt, thisVal, args, count);
+    }
+    SampledCallScope scope{runtime.state(), runtime.profiler(), entry};
+    return func(rt, thisVal, args, count);
+  }();
+
+  // Host objects returned by lookup functions such as __turboModuleProxy
+  // are labelled by the name they were looked up with.
+  if (count > 0 && args[0].isString()) {
+    runtime.labelHostObject(
+        result, [&] { return args[0].getString(rt).utf8(runtime.plain()); });
+  }
+
+  return result;
+}
+
+int64_t toNanoseconds(Clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+      .count();
+}
+
+double toMicroseconds(Clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void writeJsonString(std::ostream& os, std::string const& string) {
+  os << '"';
+  for (char c : string) {
+    switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[7];
+          snprintf(
+              escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+          os << escaped;
+        } else {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+} // namespace
+
+HostFunctionProfiler::HostFunctionProfiler()
+    : HostFunctionProfiler(Config{}) {}
+
+HostFunctionProfiler::HostFunctionProfiler(Config config)
+    : config_(config), epoch_(Clock::now()) {}
+
+HostFunctionProfiler::Entry& HostFunctionProfiler::getEntry(
+    std::string const& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& entry = entries_[name];
+  if (!entry) {
+    entry = std::make_unique<Entry>(name);
+  }
+  return *entry;
+}
+
+void HostFunctionProfiler::didCall(
+    Entry& entry,
+    Clock::time_point start,
+    Clock::time_point end,
+    Clock::duration conversionTime) {
+  entry.numberOfSampledCalls.fetch_add(1, std::memory_order_relaxed);
+  entry.totalTime.fetch_add(
+      toNanoseconds(end - start), std::memory_order_relaxed);
+  entry.conversionTime.fetch_add(
+      toNanoseconds(conversionTime), std::memory_order_relaxed);
+
+  if (!config_.recordTraceEvents) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (traceEvents_.size() < config_.maxTraceEvents) {
+    traceEvents_.push_back({&entry, start, end - start, conversionTime});
+  }
+}
+
+std::vector<HostFunctionProfiler::Stats> HostFunctionProfiler::getStats()
+    const {
+  std::vector<Stats> stats;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.reserve(entries_.size());
+    for (auto const& pair : entries_) {
+      auto const& entry = *pair.second;
+      auto numberOfCalls = entry.numberOfCalls.load(std::memory_order_relaxed);
+      if (numberOfCalls == 0) {
+        continue;
+      }
+      stats.push_back(
+          {entry.name,
+           numberOfCalls,
+           entry.numberOfSampledCalls.load(std::memory_order_relaxed),
+           std::chrono::nanoseconds(
+               entry.totalTime.load(std::memory_order_relaxed)),
+           std::chrono::nanoseconds(
+               entry.conversionTime.load(std::memory_order_relaxed))});
+    }
+  }
+
+  std::sort(stats.begin(), stats.end(), [](Stats const& a, Stats const& b) {
+    return a.totalTime > b.totalTime;
+  });
+  return stats;
+}
+
+void HostFunctionProfiler::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto const& pair : entries_) {
+    auto& entry = *pair.second;
+    entry.numberOfCalls.store(0, std::memory_order_relaxed);
+    entry.numberOfSampledCalls.store(0, std::memory_order_relaxed);
+    entry.totalTime.store(0, std::memory_order_relaxed);
+    entry.conversionTime.store(0, std::memory_order_relaxed);
+  }
+  traceEvents_.clear();
+}
+
+void HostFunctionProfiler::writeChromeTrace(std::ostream& os) const {
+  auto stats = getStats();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  os << "{\"traceEvents\":[";
+  auto separator = "";
+  for (auto const& event : traceEvents_) {
+    os << separator << "{\"name\":";
+    writeJsonString(os, event.entry->name);
+    os << ",\"cat\":\"jsi\",\"ph\":\"X\",\"pid\":0,\"tid\":0"
+       << ",\"ts\":" << toMicroseconds(event.start - epoch_)
+       << ",\"dur\":" << toMicroseconds(event.duration)
+       << ",\"args\":{\"conversionTime\":"
+       << toMicroseconds(event.conversionTime) << "}}";
+    separator = ",";
+  }
+  os << "],\"displayTimeUnit\":\"ms\",\"hostFunctionStats\":[";
+  separator = "";
+  for (auto const& item : stats) {
+    os << separator << "{\"name\":";
+    writeJsonString(os, item.name);
+    os << ",\"numberOfCalls\":" << item.numberOfCalls
+       << ",\"numberOfSampledCalls\":" << item.numberOfSampledCalls
+       << ",\"totalTime\":" << toMicroseconds(item.totalTime)
+       << ",\"conversionTime\":" << toMicroseconds(item.conversionTime)
+       << "}";
+    separator = ",";
+  }
+  os << "]}\n";
+}
+
+bool HostFunctionProfiler::dumpChromeTrace(std::string const& path) const {
+  std::ofstream file(path);
+  if (!file) {
+    return false;
+  }
+  writeChromeTrace(file);
+  return static_cast<bool>(file);
+}
+
+std::shared_ptr<Runtime> makeProfilingRuntime(
+    std::shared_ptr<Runtime> runtime,
+    std::shared_ptr<HostFunctionProfiler> profiler) {
+  return std::make_shared<ProfilingRuntime>(
+      std::move(runtime), std::move(profiler));
+}
+
+} // namespace jsi
+} // namespace facebook
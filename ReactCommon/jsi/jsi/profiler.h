@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace jsi {
+
+/// Collects per host function latency statistics for a Runtime created
+/// with makeProfilingRuntime().
+///
+/// Host functions are attributed to the name they were created with.  If
+/// a function is created while a host object resolves a property, the
+/// name is prefixed with the label of that host object, for instance
+/// "nativeFabricUIManager.completeRoot".  Host objects are labelled by
+/// the property they are first stored under (e.g. a global) or by the
+/// string argument of the host function which returned them (e.g.
+/// __turboModuleProxy).
+///
+/// Time spent in JSI calls made by a host function (converting
+/// arguments, creating return values, calling back into JS) is reported
+/// separately as conversion time; it is included in the total time.
+class JSI_EXPORT HostFunctionProfiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Config {
+    /// Only one out of this many calls is timed; the others are just
+    /// counted.  1 times every call.
+    uint32_t samplingInterval{1};
+    /// Whether every timed call is recorded for dumpChromeTrace().
+    bool recordTraceEvents{false};
+    /// Upper bound on the number of recorded trace events; calls made
+    /// after the bound is reached are only aggregated.
+    size_t maxTraceEvents{100000};
+  };
+
+  struct Stats {
+    std::string name;
+    /// Number of times the host function was called.
+    uint64_t numberOfCalls;
+    /// Number of calls which were timed.
+    uint64_t numberOfSampledCalls;
+    /// Time spent in the timed calls, including conversion time.
+    std::chrono::nanoseconds totalTime;
+    /// Part of `totalTime` spent in JSI calls made by the host function.
+    std::chrono::nanoseconds conversionTime;
+  };
+
+  /// Aggregated counters of a single host function.  Instances are
+  /// created once per name and are never destroyed before the profiler.
+  struct Entry {
+    explicit Entry(std::string name) : name(std::move(name)) {}
+
+    std::string const name;
+    std::atomic<uint64_t> numberOfCalls{0};
+    std::atomic<uint64_t> numberOfSampledCalls{0};
+    std::atomic<int64_t> totalTime{0};
+    std::atomic<int64_t> conversionTime{0};
+  };
+
+  HostFunctionProfiler();
+  explicit HostFunctionProfiler(Config config);
+
+  Config const& getConfig() const {
+    return config_;
+  }
+
+  /// Returns the statistics of every host function called so far,
+  /// ordered by decreasing total time.  Thread safe.
+  std::vector<Stats> getStats() const;
+
+  /// Resets all counters and drops the recorded trace events.
+  void reset();
+
+  /// Writes statistics and recorded calls in the Chrome trace-event
+  /// format, which can be loaded in chrome://tracing or Perfetto.
+  void writeChromeTrace(std::ostream& os) const;
+
+  /// Same as writeChromeTrace(), writing to the file at `path`.  Returns
+  /// false if the file cannot be written.
+  bool dumpChromeTrace(std::string const& path) const;
+
+  /// Returns the entry for `name`, creating it if needed.
+  Entry& getEntry(std::string const& name);
+
+  /// Returns true if the next call should be timed.
+  bool shouldSample() {
+    return config_.samplingInterval <= 1 ||
+        callCounter_.fetch_add(1, std::memory_order_relaxed) %
+            config_.samplingInterval ==
+        0;
+  }
+
+  void didCall(
+      Entry& entry,
+      Clock::time_point start,
+      Clock::time_point end,
+      Clock::duration conversionTime);
+
+ private:
+  struct TraceEvent {
+    Entry const* entry;
+    Clock::time_point start;
+    Clock::duration duration;
+    Clock::duration conversionTime;
+  };
+
+  Config const config_;
+  Clock::time_point const epoch_;
+  std::atomic<uint64_t> callCounter_{0};
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<Entry>> entries_;
+  std::vector<TraceEvent> traceEvents_;
+};
+
+/// Returns a Runtime which forwards to `runtime` and reports all host
+/// functions and host objects created through it to `profiler`.
+/// Decorate `runtime` before installing any host object on it: like any
+/// RuntimeDecorator, the returned runtime cannot read back host objects
+/// which were created directly on `runtime`.
+std::shared_ptr<Runtime> makeProfilingRuntime(
+    std::shared_ptr<Runtime> runtime,
+    std::shared_ptr<HostFunctionProfiler> profiler);
+
+} // namespace jsi
+} // namespace facebook
@@ -9,6 +9,7 @@
 #include <gtest/gtest.h>
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
+#include <jsi/profiler.h>
 
 #include <stdlib.h>
 #include <chrono>
@@ -16,6 +17,7 @@
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 using namespace facebook::jsi;
 
@@ -92,6 +94,48 @@ TEST_P(JSITest, StringTest) {
   EXPECT_EQ(movedQuux.utf8(rt), "quux2");
 }
 
+TEST_P(JSITest, StringDataTest) {
+  struct Collector {
+    bool ascii;
+    std::u16string characters;
+
+    void operator()(bool isAscii, const void* data, size_t num) {
+      ascii = isAscii;
+      characters.clear();
+      for (size_t i = 0; i < num; ++i) {
+        characters.push_back(
+            isAscii ? static_cast<const char*>(data)[i]
+                    : static_cast<const char16_t*>(data)[i]);
+      }
+    }
+  };
+
+  Collector collector;
+  String::createFromAscii(rt, "hello").getStringData(rt, collector);
+  EXPECT_EQ(collector.characters, u"hello");
+  String::createFromUtf8(rt, u8"h\u00e9llo \U0001F600")
+      .getStringData(rt, collector);
+  EXPECT_FALSE(collector.ascii);
+  EXPECT_EQ(collector.characters, u"h\u00e9llo \U0001F600");
+  PropNameID::forAscii(rt, "name").getPropNameIdData(rt, collector);
+  EXPECT_EQ(collector.characters, u"name");
+
+  std::string buffer = "previous contents";
+  String::createFromAscii(rt, "ascii").utf8(rt, buffer);
+  EXPECT_EQ(buffer, "ascii");
+  String::createFromUtf8(rt, u8"h\u00e9llo \U0001F600").utf8(rt, buffer);
+  EXPECT_EQ(buffer, u8"h\u00e9llo \U0001F600");
+  PropNameID::forUtf8(rt, u8"\u00e9t\u00e9").utf8(rt, buffer);
+  EXPECT_EQ(buffer, u8"\u00e9t\u00e9");
+
+  auto name = PropNameID::forAscii(rt, "createNode");
+  EXPECT_TRUE(name.equalsAscii(rt, "createNode"));
+  EXPECT_FALSE(name.equalsAscii(rt, "createNod"));
+  EXPECT_FALSE(name.equalsAscii(rt, "createNodes"));
+  EXPECT_FALSE(name.equalsAscii(rt, "cloneNode"));
+  EXPECT_FALSE(PropNameID::forUtf8(rt, u8"\u00e9").equalsAscii(rt, "e"));
+}
+
 TEST_P(JSITest, ObjectTest) {
   eval("x = {1:2, '3':4, 5:'six', 'seven':['eight', 'nine']}");
   Object x = rt.global().getPropertyAsObject(rt, "x");
@@ -479,6 +523,55 @@ TEST_P(JSITest, ArrayTest) {
   EXPECT_EQ(alpha2.size(rt), 4);
 }
 
+TEST_P(JSITest, ArrayBufferTest) {
+  class VectorBuffer : public MutableBuffer {
+   public:
+    VectorBuffer(std::vector<uint8_t> vector, bool& destroyed)
+        : vector_(std::move(vector)), destroyed_(destroyed) {}
+    ~VectorBuffer() override {
+      destroyed_ = true;
+    }
+    size_t size() const override {
+      return vector_.size();
+    }
+    uint8_t* data() override {
+      return vector_.data();
+    }
+
+   private:
+    std::vector<uint8_t> vector_;
+    bool& destroyed_;
+  };
+
+  bool destroyed = false;
+  auto buffer = std::make_shared<VectorBuffer>(
+      std::vector<uint8_t>{1, 2, 3, 4}, destroyed);
+  Value value;
+  try {
+    value = Value(rt, ArrayBuffer(rt, buffer));
+  } catch (const JSINativeException&) {
+    // The runtime does not support ArrayBuffers of native memory.
+    return;
+  }
+  ArrayBuffer arrayBuffer = value.getObject(rt).getArrayBuffer(rt);
+  EXPECT_EQ(arrayBuffer.size(rt), 4);
+  // The memory is shared, not copied.
+  EXPECT_EQ(arrayBuffer.data(rt), buffer->data());
+
+  EXPECT_TRUE(function("function (buf) {"
+                       "  var view = new Uint8Array(buf);"
+                       "  view[0] = 42;"
+                       "  return view.length == 4 && view[3] == 4; }")
+                  .call(rt, arrayBuffer)
+                  .getBool());
+  EXPECT_EQ(buffer->data()[0], 42);
+
+  // Native code gives up its reference; the runtime keeps the buffer alive.
+  buffer.reset();
+  EXPECT_FALSE(destroyed);
+  EXPECT_EQ(arrayBuffer.data(rt)[0], 42);
+}
+
 TEST_P(JSITest, FunctionTest) {
   // test move ctor
   Function fmove = function("function() { return 1 }");
@@ -1240,6 +1333,48 @@ TEST_P(JSITest, MultiDecoratorTest) {
   EXPECT_EQ(mrt.nest(), 0);
 }
 
+TEST_P(JSITest, HostFunctionProfilerTest) {
+  class Module : public HostObject {
+   public:
+    Value get(Runtime& rt, const PropNameID& name) override {
+      return Function::createFromHostFunction(
+          rt,
+          name,
+          0,
+          [](Runtime& rt, const Value&, const Value*, size_t) {
+            return String::createFromAscii(rt, "done");
+          });
+    }
+  };
+
+  auto profiler = std::make_shared<HostFunctionProfiler>();
+  auto prt = makeProfilingRuntime(factory(), profiler);
+
+  auto module = Object::createFromHostObject(*prt, std::make_shared<Module>());
+  prt->global().setProperty(*prt, "nativeModule", module);
+  EXPECT_TRUE(module.isHostObject<Module>(*prt));
+
+  prt->global().getPropertyAsFunction(*prt, "eval").call(
+      *prt, "nativeModule.run(); nativeModule.run();");
+
+  std::unordered_map<std::string, HostFunctionProfiler::Stats> stats;
+  for (auto const& item : profiler->getStats()) {
+    stats.emplace(item.name, item);
+  }
+  ASSERT_EQ(stats.count("nativeModule.run"), 1);
+  EXPECT_EQ(stats.at("nativeModule.run").numberOfCalls, 2);
+  EXPECT_EQ(stats.at("nativeModule.run").numberOfSampledCalls, 2);
+  EXPECT_GT(stats.at("nativeModule.run").conversionTime.count(), 0);
+  EXPECT_LE(
+      stats.at("nativeModule.run").conversionTime,
+      stats.at("nativeModule.run").totalTime);
+  ASSERT_EQ(stats.count("nativeModule[get]"), 1);
+  EXPECT_EQ(stats.at("nativeModule[get]").numberOfCalls, 2);
+
+  profiler->reset();
+  EXPECT_TRUE(profiler->getStats().empty());
+}
+
 TEST_P(JSITest, SymbolTest) {
   if (!rt.global().hasProperty(rt, "Symbol")) {
     // Symbol is an es6 feature which doesn't exist in older VMs.  So
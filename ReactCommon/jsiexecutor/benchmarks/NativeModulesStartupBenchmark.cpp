@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+#include <jsi/JSCRuntime.h>
+#include <jsi/JSIDynamic.h>
+#include <jsireact/JSINativeModules.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Measures what a bridge app goes through between
+// `JSIExecutor::initializeRuntime` and its first render: creating the
+// runtime, installing `nativeModuleProxy` and requiring every module from JS,
+// which generates the JS module objects through `__fbGenNativeModule`.
+
+static constexpr int kNumberOfModules = 60;
+static constexpr int kNumberOfMethods = 20;
+static constexpr int kNumberOfConstants = 10;
+
+class FakeModule : public NativeModule {
+ public:
+  explicit FakeModule(int index) : name_("RCTModule" + std::to_string(index)) {
+    for (int i = 0; i < kNumberOfMethods; i++) {
+      auto type = i % 5 == 0 ? "promise" : i % 7 == 0 ? "sync" : "async";
+      methods_.emplace_back("method" + std::to_string(i), type);
+    }
+    constants_ = folly::dynamic::object;
+    for (int i = 0; i < kNumberOfConstants; i++) {
+      constants_["CONSTANT_" + std::to_string(i)] = "value" + std::to_string(i);
+    }
+  }
+
+  std::string getName() override {
+    return name_;
+  }
+  std::string getSyncMethodName(unsigned int methodId) override {
+    return methods_[methodId].name;
+  }
+  std::vector<MethodDescriptor> getMethods() override {
+    return methods_;
+  }
+  folly::dynamic getConstants() override {
+    return constants_;
+  }
+  void invoke(unsigned int, folly::dynamic &&, int) override {}
+  MethodCallResult callSerializableNativeHook(unsigned int, folly::dynamic &&)
+      override {
+    return folly::none;
+  }
+
+ private:
+  std::string name_;
+  std::vector<MethodDescriptor> methods_;
+  folly::dynamic constants_;
+};
+
+static std::shared_ptr<ModuleRegistry> makeModuleRegistry() {
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  for (int i = 0; i < kNumberOfModules; i++) {
+    modules.push_back(std::make_unique<FakeModule>(i));
+  }
+  return std::make_shared<ModuleRegistry>(std::move(modules));
+}
+
+// Same work as `genModule` in NativeModules.js, minus the bridge calls.
+static char const *const kGenNativeModule = R"JS(
+__fbGenNativeModule = function(config, moduleID) {
+  var constants = config[1], methods = config[2];
+  var promiseMethods = config[3], syncMethods = config[4];
+  var module = {};
+  methods && methods.forEach(function(methodName, methodID) {
+    var isPromise = promiseMethods && promiseMethods.indexOf(methodID) !== -1;
+    var isSync = syncMethods && syncMethods.indexOf(methodID) !== -1;
+    var fn = function() { return [moduleID, methodID]; };
+    fn.type = isPromise ? 'promise' : isSync ? 'sync' : 'async';
+    module[methodName] = fn;
+  });
+  Object.assign(module, constants);
+  return {name: config[0], module: module};
+};
+)JS";
+
+static char const *const kRequireAllModules = R"JS(
+for (var i = 0; i < 60; i++) {
+  nativeModuleProxy['Module' + i].method0;
+}
+)JS";
+
+// Resolves modules through JSINativeModules, i.e. the interned method tables.
+class MethodTableProxy : public jsi::HostObject {
+ public:
+  explicit MethodTableProxy(std::shared_ptr<ModuleRegistry> registry)
+      : nativeModules_(std::move(registry)) {}
+
+  jsi::Value get(jsi::Runtime &rt, const jsi::PropNameID &name) override {
+    return nativeModules_.getModule(rt, name);
+  }
+
+ private:
+  JSINativeModules nativeModules_;
+};
+
+// Resolves modules the way JSINativeModules used to, by converting the
+// folly::dynamic config returned by ModuleRegistry::getConfig.
+class DynamicConfigProxy : public jsi::HostObject {
+ public:
+  explicit DynamicConfigProxy(std::shared_ptr<ModuleRegistry> registry)
+      : registry_(std::move(registry)) {}
+
+  jsi::Value get(jsi::Runtime &rt, const jsi::PropNameID &name) override {
+    auto moduleName = name.utf8(rt);
+    auto config = registry_->getConfig(moduleName);
+    if (!config.hasValue()) {
+      return nullptr;
+    }
+    auto genNativeModule =
+        rt.global().getPropertyAsFunction(rt, "__fbGenNativeModule");
+    return genNativeModule
+        .call(
+            rt,
+            jsi::valueFromDynamic(rt, config->config),
+            static_cast<double>(config->index))
+        .asObject(rt)
+        .getProperty(rt, "module");
+  }
+
+ private:
+  std::shared_ptr<ModuleRegistry> registry_;
+};
+
+template <typename Proxy>
+static void startup(benchmark::State &state) {
+  for (auto _ : state) {
+    // Apps create a fresh registry and runtime for every instance.
+    auto registry = makeModuleRegistry();
+    auto runtime = jsc::makeJSCRuntime();
+    runtime->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(kGenNativeModule), "");
+
+    runtime->global().setProperty(
+        *runtime,
+        "nativeModuleProxy",
+        jsi::Object::createFromHostObject(
+            *runtime, std::make_shared<Proxy>(registry)));
+    runtime->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(kRequireAllModules), "");
+  }
+}
+
+static void startupWithMethodTables(benchmark::State &state) {
+  startup<MethodTableProxy>(state);
+}
+BENCHMARK(startupWithMethodTables);
+
+static void startupWithDynamicConfigs(benchmark::State &state) {
+  startup<DynamicConfigProxy>(state);
+}
+BENCHMARK(startupWithDynamicConfigs);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -18,6 +18,7 @@
 #include <jsi/instrumentation.h>
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
 
+#include <sys/stat.h>
 #include <sstream>
 #include <stdexcept>
 
@@ -138,10 +139,27 @@ void JSIExecutor::initializeRuntime() {
   if (runtimeInstaller_) {
     runtimeInstaller_(*runtime_);
   }
-  bool hasLogger(ReactMarker::logTaggedMarker);
-  if (hasLogger) {
-    ReactMarker::logMarker(ReactMarker::CREATE_REACT_CONTEXT_STOP);
+  ReactMarker::logMarker(ReactMarker::CREATE_REACT_CONTEXT_STOP);
+}
+
+FileBigStringBuffer::FileBigStringBuffer(
+    std::unique_ptr<const JSBigFileString> script)
+    : script_(std::move(script)), version_(0) {
+  struct stat fileStat;
+  if (fstat(script_->fd(), &fileStat) == 0) {
+    version_ = (uint64_t(fileStat.st_dev) << 48) ^
+        (uint64_t(fileStat.st_ino) << 24) ^ uint64_t(fileStat.st_mtime);
+  }
+}
+
+static std::shared_ptr<const jsi::Buffer> makeScriptBuffer(
+    std::unique_ptr<const JSBigString> script) {
+  if (auto fileScript = dynamic_cast<const JSBigFileString *>(script.get())) {
+    script.release();
+    return std::make_shared<FileBigStringBuffer>(
+        std::unique_ptr<const JSBigFileString>(fileScript));
   }
+  return std::make_shared<NullTerminatedBigStringBuffer>(std::move(script));
 }
 
 void JSIExecutor::loadBundle(
@@ -149,19 +167,11 @@ void JSIExecutor::loadBundle(
     std::string sourceURL) {
   SystraceSection s("JSIExecutor::loadBundle");
 
-  bool hasLogger(ReactMarker::logTaggedMarker);
   std::string scriptName = simpleBasename(sourceURL);
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
-  }
-  runtime_->evaluateJavaScript(
-      std::make_unique<BigStringBuffer>(std::move(script)), sourceURL);
+  ReactMarker::logMarker(ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
+  runtime_->evaluateJavaScript(makeScriptBuffer(std::move(script)), sourceURL);
   flush();
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
 }
 
 void JSIExecutor::setBundleRegistry(std::unique_ptr<RAMBundleRegistry> r) {
@@ -186,8 +196,7 @@ void JSIExecutor::registerBundle(
     uint32_t bundleId,
     const std::string &bundlePath) {
   const auto tag = folly::to<std::string>(bundleId);
-  ReactMarker::logTaggedMarker(
-      ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
+  ReactMarker::logMarker(ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
   if (bundleRegistry_) {
     bundleRegistry_->registerBundle(bundleId, bundlePath);
   } else {
@@ -200,8 +209,7 @@ void JSIExecutor::registerBundle(
         std::make_unique<BigStringBuffer>(std::move(script)),
         JSExecutor::getSyntheticBundlePath(bundleId, bundlePath));
   }
-  ReactMarker::logTaggedMarker(
-      ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
+  ReactMarker::logMarker(ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
 }
 
 void JSIExecutor::callFunction(
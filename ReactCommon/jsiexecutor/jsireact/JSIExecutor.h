@@ -68,6 +68,55 @@ class BigStringBuffer : public jsi::Buffer {
   std::unique_ptr<const JSBigString> script_;
 };
 
+// Same as BigStringBuffer, for JSBigStrings which own their storage and are
+// therefore followed by a NUL byte, so runtimes can read them in place.
+// Memory-mapped JSBigFileStrings give no such guarantee (the mapping may end
+// right after the last byte) and use FileBigStringBuffer.
+class NullTerminatedBigStringBuffer : public jsi::NullTerminatedBuffer {
+ public:
+  NullTerminatedBigStringBuffer(std::unique_ptr<const JSBigString> script)
+      : script_(std::move(script)) {}
+
+  size_t size() const override {
+    return script_->size();
+  }
+
+  const uint8_t *data() const override {
+    return reinterpret_cast<const uint8_t *>(script_->c_str());
+  }
+
+ private:
+  std::unique_ptr<const JSBigString> script_;
+};
+
+// Same as BigStringBuffer, for memory-mapped JSBigFileStrings. Its version is
+// derived from the identity and the modification time of the file, so
+// runtimes can tell an unchanged bundle without reading it.
+class FileBigStringBuffer : public jsi::DescribedBuffer {
+ public:
+  FileBigStringBuffer(std::unique_ptr<const JSBigFileString> script);
+
+  size_t size() const override {
+    return script_->size();
+  }
+
+  const uint8_t *data() const override {
+    return reinterpret_cast<const uint8_t *>(script_->c_str());
+  }
+
+  bool isAscii() const override {
+    return script_->isAscii();
+  }
+
+  uint64_t version() const override {
+    return version_;
+  }
+
+ private:
+  std::unique_ptr<const JSBigFileString> script_;
+  uint64_t version_;
+};
+
 class JSIExecutor : public JSExecutor {
  public:
   using RuntimeInstaller = std::function<void(jsi::Runtime &runtime)>;
@@ -21,6 +21,89 @@ using namespace facebook::jsi;
 namespace facebook {
 namespace react {
 
+namespace {
+
+// Builds the config array __fbGenNativeModule expects, i.e. [string name,
+// object constants, array methodNames (methodId is index), [array
+// promiseMethodIds], [array syncMethodIds]], straight from the interned
+// method table instead of going through folly::dynamic.
+Array createModuleConfig(
+    Runtime &rt,
+    const std::string &name,
+    const ModuleDescription &description) {
+  auto const &methods = *description.methods;
+
+  size_t numberOfPromiseMethods = 0;
+  size_t numberOfSyncMethods = 0;
+  for (size_t methodId = 0; methodId < methods.size(); methodId++) {
+    switch (methods.getType(methodId)) {
+      case ModuleMethodTable::MethodType::Promise:
+        numberOfPromiseMethods++;
+        break;
+      case ModuleMethodTable::MethodType::Sync:
+        numberOfSyncMethods++;
+        break;
+      case ModuleMethodTable::MethodType::Async:
+        break;
+    }
+  }
+
+  size_t configSize = 2;
+  if (numberOfSyncMethods > 0) {
+    configSize = 5;
+  } else if (numberOfPromiseMethods > 0) {
+    configSize = 4;
+  } else if (!methods.empty()) {
+    configSize = 3;
+  }
+
+  Array config(rt, configSize);
+  config.setValueAtIndex(rt, 0, String::createFromUtf8(rt, name));
+  config.setValueAtIndex(rt, 1, valueFromDynamic(rt, description.constants));
+  if (methods.empty()) {
+    return config;
+  }
+
+  Array methodNames(rt, methods.size());
+  Array promiseMethodIds(rt, numberOfPromiseMethods);
+  Array syncMethodIds(rt, numberOfSyncMethods);
+  size_t promiseIndex = 0;
+  size_t syncIndex = 0;
+  for (size_t methodId = 0; methodId < methods.size(); methodId++) {
+    auto methodName = methods.getName(methodId);
+    methodNames.setValueAtIndex(
+        rt,
+        methodId,
+        String::createFromUtf8(
+            rt,
+            reinterpret_cast<const uint8_t *>(methodName.data()),
+            methodName.size()));
+    switch (methods.getType(methodId)) {
+      case ModuleMethodTable::MethodType::Promise:
+        promiseMethodIds.setValueAtIndex(
+            rt, promiseIndex++, static_cast<double>(methodId));
+        break;
+      case ModuleMethodTable::MethodType::Sync:
+        syncMethodIds.setValueAtIndex(
+            rt, syncIndex++, static_cast<double>(methodId));
+        break;
+      case ModuleMethodTable::MethodType::Async:
+        break;
+    }
+  }
+
+  config.setValueAtIndex(rt, 2, std::move(methodNames));
+  if (configSize > 3) {
+    config.setValueAtIndex(rt, 3, std::move(promiseMethodIds));
+  }
+  if (configSize > 4) {
+    config.setValueAtIndex(rt, 4, std::move(syncMethodIds));
+  }
+  return config;
+}
+
+} // namespace
+
 JSINativeModules::JSINativeModules(
     std::shared_ptr<ModuleRegistry> moduleRegistry)
     : m_moduleRegistry(std::move(moduleRegistry)) {}
@@ -30,20 +113,25 @@ Value JSINativeModules::getModule(Runtime &rt, const PropNameID &name) {
     return nullptr;
   }
 
-  std::string moduleName = name.utf8(rt);
+  // Reused across calls to avoid allocating a string on every lookup.
+  static thread_local std::string moduleNameBuffer;
+  name.utf8(rt, moduleNameBuffer);
 
   BridgeNativeModulePerfLogger::moduleJSRequireBeginningStart(
-      moduleName.c_str());
+      moduleNameBuffer.c_str());
 
-  const auto it = m_objects.find(moduleName);
+  const auto it = m_objects.find(moduleNameBuffer);
   if (it != m_objects.end()) {
     BridgeNativeModulePerfLogger::moduleJSRequireBeginningCacheHit(
-        moduleName.c_str());
+        moduleNameBuffer.c_str());
     BridgeNativeModulePerfLogger::moduleJSRequireBeginningEnd(
-        moduleName.c_str());
+        moduleNameBuffer.c_str());
     return Value(rt, it->second);
   }
 
+  // Creating the module calls into JavaScript, which may require other
+  // modules and reuse the buffer.
+  std::string moduleName = moduleNameBuffer;
   auto module = createModule(rt, moduleName);
   if (!module.hasValue()) {
     BridgeNativeModulePerfLogger::moduleJSRequireEndingFail(moduleName.c_str());
@@ -56,7 +144,8 @@ Value JSINativeModules::getModule(Runtime &rt, const PropNameID &name) {
       m_objects.emplace(std::move(moduleName), std::move(*module)).first;
 
   Value ret = Value(rt, result->second);
-  BridgeNativeModulePerfLogger::moduleJSRequireEndingEnd(moduleName.c_str());
+  BridgeNativeModulePerfLogger::moduleJSRequireEndingEnd(
+      result->first.c_str());
   return ret;
 }
 
@@ -68,35 +157,28 @@ void JSINativeModules::reset() {
 folly::Optional<Object> JSINativeModules::createModule(
     Runtime &rt,
     const std::string &name) {
-  bool hasLogger(ReactMarker::logTaggedMarker);
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
 
   if (!m_genNativeModuleJS) {
     m_genNativeModuleJS =
         rt.global().getPropertyAsFunction(rt, "__fbGenNativeModule");
   }
 
-  auto result = m_moduleRegistry->getConfig(name);
+  auto result = m_moduleRegistry->getModuleDescription(name);
   if (!result.hasValue()) {
     return folly::none;
   }
 
   Value moduleInfo = m_genNativeModuleJS->call(
       rt,
-      valueFromDynamic(rt, result->config),
+      createModuleConfig(rt, name, *result),
       static_cast<double>(result->index));
   CHECK(!moduleInfo.isNull()) << "Module returned from genNativeModule is null";
 
   folly::Optional<Object> module(
       moduleInfo.asObject(rt).getPropertyAsObject(rt, "module"));
 
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
 
   return module;
 }
@@ -22,7 +22,9 @@ TurboModule::~TurboModule() {}
 jsi::Value TurboModule::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &propName) {
-  std::string propNameUtf8 = propName.utf8(runtime);
+  // Reused across calls to avoid allocating a string on every lookup.
+  static thread_local std::string propNameUtf8;
+  propName.utf8(runtime, propNameUtf8);
   auto p = methodMap_.find(propNameUtf8);
   if (p == methodMap_.end()) {
     // Method was not found, let JS decide what to do.
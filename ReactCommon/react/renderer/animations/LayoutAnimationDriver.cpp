@@ -41,7 +41,22 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       continue;
     }
 
+    // The contract with the "keyframes generation" phase is that any animated
+    // node will have a valid configuration. Progress only depends on the
+    // configuration, so it's computed once per configuration type.
+    auto const &layoutAnimationConfig = animation.layoutAnimationConfig;
+    auto const createProgress = calculateAnimationProgress(
+        now, animation, layoutAnimationConfig.createConfig);
+    auto const updateProgress = calculateAnimationProgress(
+        now, animation, layoutAnimationConfig.updateConfig);
+    auto const deleteProgress = calculateAnimationProgress(
+        now, animation, layoutAnimationConfig.deleteConfig);
+
+    // First, collect all animated keyframes and interpolate their frames in
+    // one batch.
     int incompleteAnimations = 0;
+    animatedKeyFrames_.clear();
+    animatedFrames_.clear();
     for (auto &keyframe : animation.keyFrames) {
       if (keyframe.type == AnimationConfigurationType::Noop) {
         continue;
@@ -50,27 +65,44 @@ void LayoutAnimationDriver::animationMutationsForFrame(
         continue;
       }
 
-      auto const &baselineShadowView = keyframe.viewStart;
-      auto const &finalShadowView = keyframe.viewEnd;
-
-      // The contract with the "keyframes generation" phase is that any animated
-      // node will have a valid configuration.
-      auto const layoutAnimationConfig = animation.layoutAnimationConfig;
-      auto const &mutationConfig =
+      std::pair<double, double> const &progress =
           (keyframe.type == AnimationConfigurationType::Delete
-               ? layoutAnimationConfig.deleteConfig
+               ? deleteProgress
                : (keyframe.type == AnimationConfigurationType::Create
-                      ? layoutAnimationConfig.createConfig
-                      : layoutAnimationConfig.updateConfig));
-
-      // Interpolate
-      std::pair<double, double> progress =
-          calculateAnimationProgress(now, animation, mutationConfig);
+                      ? createProgress
+                      : updateProgress));
       double animationTimeProgressLinear = progress.first;
       double animationInterpolationFactor = progress.second;
 
+      if (animationTimeProgressLinear < 1) {
+        incompleteAnimations++;
+      }
+
+      // Nothing changed for this keyframe since the previous frame (e.g. it's
+      // delayed or already finished), so there is nothing to mount.
+      if (keyframe.interpolationFactorPrev == animationInterpolationFactor) {
+        continue;
+      }
+
+      animatedKeyFrames_.push_back({&keyframe, animationInterpolationFactor});
+      animatedFrames_.add(
+          animationInterpolationFactor,
+          keyframe.viewStart.layoutMetrics.frame,
+          keyframe.viewEnd.layoutMetrics.frame);
+    }
+
+    animatedFrames_.interpolate();
+
+    // Then, materialize views (and props) only for keyframes that changed.
+    for (size_t i = 0; i < animatedKeyFrames_.size(); i++) {
+      auto &keyframe = *animatedKeyFrames_[i].first;
+      auto animationInterpolationFactor = animatedKeyFrames_[i].second;
+
       auto mutatedShadowView = createInterpolatedShadowView(
-          animationInterpolationFactor, baselineShadowView, finalShadowView);
+          animationInterpolationFactor,
+          keyframe.viewStart,
+          keyframe.viewEnd,
+          animatedFrames_.getInterpolatedFrame(i));
 
       // Create the mutation instruction
       auto updateMutation = ShadowViewMutation::UpdateMutation(
@@ -86,10 +118,7 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       PrintMutationInstruction("Animation Progress:", updateMutation);
 
       keyframe.viewPrev = mutatedShadowView;
-
-      if (animationTimeProgressLinear < 1) {
-        incompleteAnimations++;
-      }
+      keyframe.interpolationFactorPrev = animationInterpolationFactor;
     }
 
     // Are there no ongoing mutations left in this animation?
@@ -35,6 +35,16 @@ class LayoutAnimationDriver : public LayoutAnimationKeyFrameManager {
       SurfaceId surfaceId,
       ShadowViewMutation::List &mutationsList,
       uint64_t now) const override;
+
+ private:
+  /*
+   * Scratch storage for `animationMutationsForFrame`, reused between frames
+   * to avoid allocations. Like `inflightAnimations_`, only accessed within
+   * `pullTransaction`.
+   */
+  mutable std::vector<std::pair<AnimationKeyFrame *, double>>
+      animatedKeyFrames_{};
+  mutable AnimationKeyFrameFrames animatedFrames_{};
 };
 
 } // namespace react
@@ -332,6 +332,65 @@ interpolateFloats(float coefficient, float oldValue, float newValue) {
   return oldValue + (newValue - oldValue) * coefficient;
 }
 
+#pragma mark - AnimationKeyFrameFrames
+
+void AnimationKeyFrameFrames::clear() {
+  coefficients_.clear();
+  for (auto component = 0; component < NumberOfComponents; component++) {
+    startValues_[component].clear();
+    finalValues_[component].clear();
+  }
+}
+
+size_t AnimationKeyFrameFrames::size() const {
+  return coefficients_.size();
+}
+
+void AnimationKeyFrameFrames::add(
+    Float coefficient,
+    Rect const &startFrame,
+    Rect const &finalFrame) {
+  coefficients_.push_back(coefficient);
+  startValues_[X].push_back(startFrame.origin.x);
+  startValues_[Y].push_back(startFrame.origin.y);
+  startValues_[Width].push_back(startFrame.size.width);
+  startValues_[Height].push_back(startFrame.size.height);
+  finalValues_[X].push_back(finalFrame.origin.x);
+  finalValues_[Y].push_back(finalFrame.origin.y);
+  finalValues_[Width].push_back(finalFrame.size.width);
+  finalValues_[Height].push_back(finalFrame.size.height);
+}
+
+void AnimationKeyFrameFrames::interpolate() {
+  auto size = coefficients_.size();
+  auto coefficients = coefficients_.data();
+
+  for (auto component = 0; component < NumberOfComponents; component++) {
+    auto &interpolatedValues = interpolatedValues_[component];
+    interpolatedValues.resize(size);
+
+    auto startValues = startValues_[component].data();
+    auto finalValues = finalValues_[component].data();
+    auto values = interpolatedValues.data();
+
+    // Same formula as `interpolateFloats`, applied to contiguous arrays.
+    for (size_t i = 0; i < size; i++) {
+      values[i] =
+          startValues[i] + (finalValues[i] - startValues[i]) * coefficients[i];
+    }
+  }
+}
+
+Rect AnimationKeyFrameFrames::getInterpolatedFrame(size_t index) const {
+  return Rect{
+      Point{interpolatedValues_[X][index], interpolatedValues_[Y][index]},
+      Size{
+          interpolatedValues_[Width][index],
+          interpolatedValues_[Height][index]}};
+}
+
+#pragma mark - LayoutAnimationKeyFrameManager
+
 std::pair<double, double>
 LayoutAnimationKeyFrameManager::calculateAnimationProgress(
     uint64_t now,
@@ -965,6 +1024,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
                 keyframe.viewPrev = mutation.newChildShadowView.tag != 0
                     ? mutation.newChildShadowView
                     : mutation.oldChildShadowView;
+                keyframe.interpolationFactorPrev = -1;
               }
             }
           }
@@ -1203,6 +1263,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
               // The animation will continue from the current position - we
               // restart viewStart to make sure there are no sudden jumps
               keyFrame.viewStart = keyFrame.viewPrev;
+              keyFrame.interpolationFactorPrev = -1;
 
               // Find the insert mutation that conflicted with this update
               for (auto &mutation : immediateMutations) {
@@ -1618,6 +1679,28 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
     double progress,
     ShadowView startingView,
     ShadowView finalView) const {
+  // Interpolate LayoutMetrics
+  Rect const &finalFrame = finalView.layoutMetrics.frame;
+  Rect const &baselineFrame = startingView.layoutMetrics.frame;
+  Rect interpolatedFrame;
+  interpolatedFrame.origin.x =
+      interpolateFloats(progress, baselineFrame.origin.x, finalFrame.origin.x);
+  interpolatedFrame.origin.y =
+      interpolateFloats(progress, baselineFrame.origin.y, finalFrame.origin.y);
+  interpolatedFrame.size.width = interpolateFloats(
+      progress, baselineFrame.size.width, finalFrame.size.width);
+  interpolatedFrame.size.height = interpolateFloats(
+      progress, baselineFrame.size.height, finalFrame.size.height);
+
+  return createInterpolatedShadowView(
+      progress, startingView, finalView, interpolatedFrame);
+}
+
+ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
+    double progress,
+    ShadowView const &startingView,
+    ShadowView const &finalView,
+    Rect const &interpolatedFrame) const {
   if (!hasComponentDescriptorForShadowView(startingView)) {
     return finalView;
   }
@@ -1629,31 +1712,15 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
     return finalView;
   }
 
-  // Animate opacity or scale/transform
-  mutatedShadowView.props = componentDescriptor.interpolateProps(
-      progress, startingView.props, finalView.props);
+  // Animate opacity or scale/transform. There is nothing to interpolate (and
+  // no need to allocate a new props object) if both ends share the same props.
+  mutatedShadowView.props = startingView.props == finalView.props
+      ? finalView.props
+      : componentDescriptor.interpolateProps(
+            progress, startingView.props, finalView.props);
 
-  // Interpolate LayoutMetrics
-  LayoutMetrics const &finalLayoutMetrics = finalView.layoutMetrics;
-  LayoutMetrics const &baselineLayoutMetrics = startingView.layoutMetrics;
-  LayoutMetrics interpolatedLayoutMetrics = finalLayoutMetrics;
-  interpolatedLayoutMetrics.frame.origin.x = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.x,
-      finalLayoutMetrics.frame.origin.x);
-  interpolatedLayoutMetrics.frame.origin.y = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.y,
-      finalLayoutMetrics.frame.origin.y);
-  interpolatedLayoutMetrics.frame.size.width = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.width,
-      finalLayoutMetrics.frame.size.width);
-  interpolatedLayoutMetrics.frame.size.height = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.height,
-      finalLayoutMetrics.frame.size.height);
-  mutatedShadowView.layoutMetrics = interpolatedLayoutMetrics;
+  mutatedShadowView.layoutMetrics = finalView.layoutMetrics;
+  mutatedShadowView.layoutMetrics.frame = interpolatedFrame;
 
   return mutatedShadowView;
 }
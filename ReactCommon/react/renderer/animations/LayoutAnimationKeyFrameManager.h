@@ -13,6 +13,9 @@
 //#define RN_SHADOW_TREE_INTROSPECTION
 //#define RN_DEBUG_STRING_CONVERTIBLE 1
 
+#include <array>
+#include <vector>
+
 #include <ReactCommon/RuntimeExecutor.h>
 #include <better/optional.h>
 #include <react/renderer/core/EventTarget.h>
@@ -111,6 +114,40 @@ struct AnimationKeyFrame {
   double initialProgress;
 
   bool invalidated{false};
+
+  // Interpolation factor `viewPrev` was computed for by the animation driver,
+  // or a negative value if `viewPrev` was produced in some other way. Allows
+  // the driver to skip frames where nothing changed for this keyframe.
+  double interpolationFactorPrev{-1};
+};
+
+/*
+ * Frames of all keyframes animated during one animation frame, stored as a
+ * structure of arrays so that all of them are interpolated in a single tight
+ * loop per component that the compiler can vectorize.
+ */
+class AnimationKeyFrameFrames {
+ public:
+  void clear();
+  size_t size() const;
+
+  void add(Float coefficient, Rect const &startFrame, Rect const &finalFrame);
+
+  /*
+   * Computes interpolated frames for all added keyframes.
+   */
+  void interpolate();
+
+  Rect getInterpolatedFrame(size_t index) const;
+
+ private:
+  // Indices of frame components in the arrays below.
+  enum Component { X, Y, Width, Height, NumberOfComponents };
+
+  std::vector<Float> coefficients_;
+  std::array<std::vector<Float>, NumberOfComponents> startValues_;
+  std::array<std::vector<Float>, NumberOfComponents> finalValues_;
+  std::array<std::vector<Float>, NumberOfComponents> interpolatedValues_;
 };
 
 class LayoutAnimationCallbackWrapper {
@@ -247,6 +284,16 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       ShadowView startingView,
       ShadowView finalView) const;
 
+  /*
+   * Same as above, but uses an already interpolated frame (see
+   * `AnimationKeyFrameFrames`) instead of interpolating it.
+   */
+  ShadowView createInterpolatedShadowView(
+      double progress,
+      ShadowView const &startingView,
+      ShadowView const &finalView,
+      Rect const &interpolatedFrame) const;
+
   void callCallback(const LayoutAnimationCallbackWrapper &callback) const;
 
   virtual void animationMutationsForFrame(
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/animations/LayoutAnimationDriver.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Drives frames of given animations directly, bypassing the keyframe
+ * generation phase.
+ */
+class TestLayoutAnimationDriver : public LayoutAnimationDriver {
+ public:
+  TestLayoutAnimationDriver()
+      : LayoutAnimationDriver(
+            [](std::function<void(jsi::Runtime & runtime)> &&) {},
+            nullptr) {
+    auto eventDispatcher = EventDispatcher::Shared{};
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    setComponentDescriptorRegistry(
+        componentDescriptorProviderRegistry_.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr}));
+  }
+
+  void startAnimation(LayoutAnimation &&animation) {
+    inflightAnimations_.push_back(std::move(animation));
+  }
+
+  ShadowViewMutation::List animateFrame(uint64_t now) {
+    auto mutations = ShadowViewMutation::List{};
+    animationMutationsForFrame(1, mutations, now);
+    return mutations;
+  }
+
+  bool isAnimating() const {
+    return !inflightAnimations_.empty();
+  }
+
+ private:
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_{};
+};
+
+static AnimationConfig linearConfig(double duration, double delay = 0) {
+  return AnimationConfig{
+      AnimationType::Linear, AnimationProperty::Opacity, duration, delay};
+}
+
+static LayoutAnimation createAnimation(
+    AnimationConfig createConfig,
+    AnimationConfig updateConfig) {
+  auto animation = LayoutAnimation{};
+  animation.surfaceId = 1;
+  animation.startTime = 0;
+  animation.layoutAnimationConfig =
+      LayoutAnimationConfig{100, createConfig, updateConfig, updateConfig};
+  return animation;
+}
+
+// Moves a view from x = 0 to x = 100 and fades it out.
+static AnimationKeyFrame createKeyFrame(
+    Tag tag,
+    AnimationConfigurationType type) {
+  auto shadowView = ShadowView{};
+  shadowView.componentName = ViewShadowNode::Name();
+  shadowView.componentHandle = ViewShadowNode::Handle();
+  shadowView.tag = tag;
+
+  auto viewStart = shadowView;
+  viewStart.props = std::make_shared<ViewProps>();
+  viewStart.layoutMetrics.frame = Rect{Point{0, 0}, Size{10, 10}};
+
+  auto finalProps = std::make_shared<ViewProps>();
+  finalProps->opacity = 0;
+  auto viewEnd = shadowView;
+  viewEnd.props = finalProps;
+  viewEnd.layoutMetrics.frame = Rect{Point{100, 0}, Size{10, 10}};
+
+  return AnimationKeyFrame{
+      {}, type, tag, ShadowView{}, viewStart, viewEnd, viewStart, 0};
+}
+
+static std::vector<ShadowViewMutation> mutationsOfView(
+    ShadowViewMutation::List const &mutations,
+    Tag tag) {
+  auto result = std::vector<ShadowViewMutation>{};
+  for (auto const &mutation : mutations) {
+    if (mutation.newChildShadowView.tag == tag ||
+        mutation.oldChildShadowView.tag == tag) {
+      result.push_back(mutation);
+    }
+  }
+  return result;
+}
+
+TEST(LayoutAnimationDriverTest, emitsEveryFrameAndTheFinalOne) {
+  TestLayoutAnimationDriver driver;
+  auto animation = createAnimation(linearConfig(100), linearConfig(100));
+  animation.keyFrames.push_back(
+      createKeyFrame(1, AnimationConfigurationType::Update));
+  auto viewEnd = animation.keyFrames.back().viewEnd;
+  driver.startAnimation(std::move(animation));
+
+  auto viewPrev = ShadowView{};
+  for (uint64_t now = 0; now < 100; now += 16) {
+    auto mutations = driver.animateFrame(now);
+
+    ASSERT_EQ(mutations.size(), 1);
+    EXPECT_EQ(mutations[0].type, ShadowViewMutation::Update);
+    EXPECT_FLOAT_EQ(
+        mutations[0].newChildShadowView.layoutMetrics.frame.origin.x, now);
+    if (now > 0) {
+      EXPECT_EQ(mutations[0].oldChildShadowView, viewPrev);
+    }
+    viewPrev = mutations[0].newChildShadowView;
+  }
+
+  auto mutations = driver.animateFrame(100);
+
+  // The last interpolated frame, then the final state of the view.
+  ASSERT_EQ(mutations.size(), 2);
+  EXPECT_EQ(mutations[0].oldChildShadowView, viewPrev);
+  EXPECT_FLOAT_EQ(
+      mutations[0].newChildShadowView.layoutMetrics.frame.origin.x, 100);
+  EXPECT_EQ(mutations[1].oldChildShadowView, mutations[0].newChildShadowView);
+  EXPECT_EQ(mutations[1].newChildShadowView, viewEnd);
+  EXPECT_FALSE(driver.isAnimating());
+}
+
+TEST(LayoutAnimationDriverTest, skipsFramesWhenTimeDidNotAdvance) {
+  TestLayoutAnimationDriver driver;
+  auto animation = createAnimation(linearConfig(100), linearConfig(100));
+  animation.keyFrames.push_back(
+      createKeyFrame(1, AnimationConfigurationType::Update));
+  driver.startAnimation(std::move(animation));
+
+  EXPECT_EQ(driver.animateFrame(0).size(), 1);
+  EXPECT_EQ(driver.animateFrame(0).size(), 0);
+  EXPECT_EQ(driver.animateFrame(16).size(), 1);
+  EXPECT_EQ(driver.animateFrame(16).size(), 0);
+  EXPECT_EQ(driver.animateFrame(32).size(), 1);
+  EXPECT_EQ(driver.animateFrame(100).size(), 2);
+  EXPECT_FALSE(driver.isAnimating());
+}
+
+TEST(LayoutAnimationDriverTest, emitsFinalMutationsOfKeyFramesFinishedEarly) {
+  TestLayoutAnimationDriver driver;
+  auto animation = createAnimation(linearConfig(30), linearConfig(100));
+  animation.keyFrames.push_back(
+      createKeyFrame(1, AnimationConfigurationType::Create));
+  animation.keyFrames.push_back(
+      createKeyFrame(2, AnimationConfigurationType::Update));
+  auto createdViewEnd = animation.keyFrames.front().viewEnd;
+  driver.startAnimation(std::move(animation));
+
+  auto lastMutationOfCreatedView = ShadowViewMutation{};
+  for (uint64_t now = 0; now < 100; now += 16) {
+    auto mutations = driver.animateFrame(now);
+
+    EXPECT_EQ(mutationsOfView(mutations, 2).size(), 1);
+
+    auto mutationsOfCreatedView = mutationsOfView(mutations, 1);
+    if (now <= 32) {
+      // Frames until the view reaches its end state.
+      ASSERT_EQ(mutationsOfCreatedView.size(), 1);
+      lastMutationOfCreatedView = mutationsOfCreatedView[0];
+    } else {
+      EXPECT_EQ(mutationsOfCreatedView.size(), 0);
+    }
+  }
+  EXPECT_FLOAT_EQ(
+      lastMutationOfCreatedView.newChildShadowView.layoutMetrics.frame.origin
+          .x,
+      100);
+
+  auto mutations = driver.animateFrame(100);
+
+  EXPECT_EQ(mutationsOfView(mutations, 2).size(), 2);
+  auto mutationsOfCreatedView = mutationsOfView(mutations, 1);
+  ASSERT_EQ(mutationsOfCreatedView.size(), 1);
+  EXPECT_EQ(
+      mutationsOfCreatedView[0].oldChildShadowView,
+      lastMutationOfCreatedView.newChildShadowView);
+  EXPECT_EQ(mutationsOfCreatedView[0].newChildShadowView, createdViewEnd);
+  EXPECT_FALSE(driver.isAnimating());
+}
+
+TEST(LayoutAnimationDriverTest, emitsFinalMutationOfDeletedView) {
+  TestLayoutAnimationDriver driver;
+  auto animation = createAnimation(linearConfig(100), linearConfig(100));
+  animation.keyFrames.push_back(
+      createKeyFrame(1, AnimationConfigurationType::Delete));
+  auto &keyFrame = animation.keyFrames.back();
+  auto parentView = ShadowView{};
+  parentView.tag = 2;
+  keyFrame.finalMutationForKeyFrame =
+      ShadowViewMutation::RemoveMutation(parentView, keyFrame.viewEnd, 0);
+  driver.startAnimation(std::move(animation));
+
+  for (uint64_t now = 0; now < 100; now += 16) {
+    EXPECT_EQ(driver.animateFrame(now).size(), 1);
+  }
+
+  auto mutations = driver.animateFrame(100);
+
+  ASSERT_EQ(mutations.size(), 2);
+  auto updateMutation =
+      mutations[0].type == ShadowViewMutation::Update ? mutations[0]
+                                                      : mutations[1];
+  auto removeMutation =
+      mutations[0].type == ShadowViewMutation::Remove ? mutations[0]
+                                                      : mutations[1];
+  EXPECT_EQ(updateMutation.type, ShadowViewMutation::Update);
+  EXPECT_EQ(removeMutation.type, ShadowViewMutation::Remove);
+  EXPECT_EQ(removeMutation.parentShadowView, parentView);
+  EXPECT_EQ(
+      removeMutation.oldChildShadowView, updateMutation.newChildShadowView);
+  EXPECT_FALSE(driver.isAnimating());
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/animations/LayoutAnimationDriver.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <memory>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Exposes a single animation frame of `LayoutAnimationDriver` for
+ * measurements, bypassing the keyframe generation phase.
+ */
+class LayoutAnimationDriverBenchmark : public LayoutAnimationDriver {
+ public:
+  LayoutAnimationDriverBenchmark(int numberOfViews)
+      : LayoutAnimationDriver(
+            [](std::function<void(jsi::Runtime & runtime)> &&) {},
+            nullptr) {
+    auto eventDispatcher = EventDispatcher::Shared{};
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    setComponentDescriptorRegistry(
+        componentDescriptorProviderRegistry_.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr}));
+
+    auto startProps = std::make_shared<ViewProps>();
+    auto finalProps = std::make_shared<ViewProps>();
+    finalProps->opacity = 0;
+
+    auto animationConfig = AnimationConfig{
+        AnimationType::EaseInEaseOut, AnimationProperty::Opacity, 1000000};
+    auto animation = LayoutAnimation{};
+    animation.surfaceId = 1;
+    animation.startTime = 0;
+    animation.layoutAnimationConfig = LayoutAnimationConfig{
+        1000000, animationConfig, animationConfig, animationConfig};
+
+    for (int tag = 1; tag <= numberOfViews; tag++) {
+      auto shadowView = ShadowView{};
+      shadowView.componentName = ViewShadowNode::Name();
+      shadowView.componentHandle = ViewShadowNode::Handle();
+      shadowView.tag = tag;
+
+      auto viewStart = shadowView;
+      viewStart.props = startProps;
+      viewStart.layoutMetrics.frame = Rect{Point{0, Float(tag)}, Size{10, 10}};
+
+      auto viewEnd = shadowView;
+      viewEnd.props = finalProps;
+      viewEnd.layoutMetrics.frame =
+          Rect{Point{100, Float(tag) * 2}, Size{20, 40}};
+
+      animation.keyFrames.push_back(AnimationKeyFrame{
+          {},
+          AnimationConfigurationType::Update,
+          tag,
+          ShadowView{},
+          viewStart,
+          viewEnd,
+          viewStart,
+          0});
+    }
+
+    inflightAnimations_.push_back(std::move(animation));
+  }
+
+  void animateFrame(uint64_t now) {
+    mutations_.clear();
+    animationMutationsForFrame(1, mutations_, now);
+  }
+
+ private:
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_{};
+  ShadowViewMutation::List mutations_{};
+};
+
+static void animatingFrame(benchmark::State &state) {
+  LayoutAnimationDriverBenchmark driver(state.range(0));
+  auto now = uint64_t{0};
+  for (auto _ : state) {
+    // 60 frames per second.
+    now += 16;
+    driver.animateFrame(now);
+  }
+}
+BENCHMARK(animatingFrame)->Arg(100)->Arg(1000)->Arg(5000);
+
+static void animatingStationaryFrame(benchmark::State &state) {
+  // Time does not advance, so none of the keyframes changes between frames
+  // (which is what happens while animations wait for their delay to pass).
+  LayoutAnimationDriverBenchmark driver(state.range(0));
+  for (auto _ : state) {
+    driver.animateFrame(0);
+  }
+}
+BENCHMARK(animatingStationaryFrame)->Arg(100)->Arg(1000)->Arg(5000);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -7,53 +7,77 @@
 
 #include "ScrollViewEventEmitter.h"
 
+#include <react/renderer/core/EventPayload.h>
+
 namespace facebook {
 namespace react {
 
 static jsi::Value scrollViewMetricsPayload(
     jsi::Runtime &runtime,
     const ScrollViewMetrics &scrollViewMetrics) {
+  auto builder = EventPayloadBuilder{runtime};
   auto payload = jsi::Object(runtime);
 
   {
     auto contentOffset = jsi::Object(runtime);
-    contentOffset.setProperty(runtime, "x", scrollViewMetrics.contentOffset.x);
-    contentOffset.setProperty(runtime, "y", scrollViewMetrics.contentOffset.y);
-    payload.setProperty(runtime, "contentOffset", contentOffset);
+    builder.setProperty(
+        contentOffset, EventPayloadKey::X, scrollViewMetrics.contentOffset.x);
+    builder.setProperty(
+        contentOffset, EventPayloadKey::Y, scrollViewMetrics.contentOffset.y);
+    builder.setProperty(
+        payload, EventPayloadKey::ContentOffset, std::move(contentOffset));
   }
 
   {
     auto contentInset = jsi::Object(runtime);
-    contentInset.setProperty(
-        runtime, "top", scrollViewMetrics.contentInset.top);
-    contentInset.setProperty(
-        runtime, "left", scrollViewMetrics.contentInset.left);
-    contentInset.setProperty(
-        runtime, "bottom", scrollViewMetrics.contentInset.bottom);
-    contentInset.setProperty(
-        runtime, "right", scrollViewMetrics.contentInset.right);
-    payload.setProperty(runtime, "contentInset", contentInset);
+    builder.setProperty(
+        contentInset, EventPayloadKey::Top, scrollViewMetrics.contentInset.top);
+    builder.setProperty(
+        contentInset,
+        EventPayloadKey::Left,
+        scrollViewMetrics.contentInset.left);
+    builder.setProperty(
+        contentInset,
+        EventPayloadKey::Bottom,
+        scrollViewMetrics.contentInset.bottom);
+    builder.setProperty(
+        contentInset,
+        EventPayloadKey::Right,
+        scrollViewMetrics.contentInset.right);
+    builder.setProperty(
+        payload, EventPayloadKey::ContentInset, std::move(contentInset));
   }
 
   {
     auto contentSize = jsi::Object(runtime);
-    contentSize.setProperty(
-        runtime, "width", scrollViewMetrics.contentSize.width);
-    contentSize.setProperty(
-        runtime, "height", scrollViewMetrics.contentSize.height);
-    payload.setProperty(runtime, "contentSize", contentSize);
+    builder.setProperty(
+        contentSize,
+        EventPayloadKey::Width,
+        scrollViewMetrics.contentSize.width);
+    builder.setProperty(
+        contentSize,
+        EventPayloadKey::Height,
+        scrollViewMetrics.contentSize.height);
+    builder.setProperty(
+        payload, EventPayloadKey::ContentSize, std::move(contentSize));
   }
 
   {
     auto containerSize = jsi::Object(runtime);
-    containerSize.setProperty(
-        runtime, "width", scrollViewMetrics.containerSize.width);
-    containerSize.setProperty(
-        runtime, "height", scrollViewMetrics.containerSize.height);
-    payload.setProperty(runtime, "layoutMeasurement", containerSize);
+    builder.setProperty(
+        containerSize,
+        EventPayloadKey::Width,
+        scrollViewMetrics.containerSize.width);
+    builder.setProperty(
+        containerSize,
+        EventPayloadKey::Height,
+        scrollViewMetrics.containerSize.height);
+    builder.setProperty(
+        payload, EventPayloadKey::LayoutMeasurement, std::move(containerSize));
   }
 
-  payload.setProperty(runtime, "zoomScale", scrollViewMetrics.zoomScale);
+  builder.setProperty(
+      payload, EventPayloadKey::ZoomScale, scrollViewMetrics.zoomScale);
 
   return payload;
 }
@@ -24,14 +24,8 @@ using Content = ParagraphShadowNode::Content;
 
 char const ParagraphComponentName[] = "Paragraph";
 
-Content const &ParagraphShadowNode::getContent(
+Content ParagraphShadowNode::buildContent(
     LayoutContext const &layoutContext) const {
-  if (content_.has_value()) {
-    return content_.value();
-  }
-
-  ensureUnsealed();
-
   auto textAttributes = TextAttributes::defaultTextAttributes();
   textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
   textAttributes.apply(getConcreteProps().textAttributes);
@@ -43,8 +37,19 @@ Content const &ParagraphShadowNode::getContent(
   auto attachments = Attachments{};
   buildAttributedString(textAttributes, *this, attributedString, attachments);
 
-  content_ = Content{
+  return Content{
       attributedString, getConcreteProps().paragraphAttributes, attachments};
+}
+
+Content const &ParagraphShadowNode::getContent(
+    LayoutContext const &layoutContext) const {
+  if (content_.has_value()) {
+    return content_.value();
+  }
+
+  ensureUnsealed();
+
+  content_ = buildContent(layoutContext);
 
   return content_.value();
 }
@@ -138,11 +143,6 @@ Size ParagraphShadowNode::measureContent(
     attributedString.appendFragment({string, textAttributes, {}});
   }
 
-  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
-  if (telemetry) {
-    telemetry->didMeasureText();
-  }
-
   return textLayoutManager_
       ->measure(
           AttributedStringBox{attributedString},
@@ -151,6 +151,55 @@ Size ParagraphShadowNode::measureContent(
       .size;
 }
 
+bool ParagraphShadowNode::willMeasureContent(
+    LayoutContext const &layoutContext) const {
+  // Builds the content here, so `measureContent` on other threads only reads
+  // it. Measuring attachments lays them out, which relies on the thread-local
+  // state of the layout thread.
+  return getContent(layoutContext).attachments.empty();
+}
+
+void ParagraphShadowNode::didMeasureContent(
+    LayoutContext const &layoutContext) const {
+  // The measurement is counted here, on the layout thread, because the
+  // telemetry of the transaction is thread-local.
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  if (telemetry) {
+    telemetry->didMeasureText();
+  }
+}
+
+better::optional<size_t> ParagraphShadowNode::getMeasuredContentKey(
+    LayoutContext const &layoutContext) const {
+  // The content is not cached here: before the node is laid out, its layout
+  // direction is not known yet.
+  auto builtContent = better::optional<Content>{};
+  if (!content_.has_value()) {
+    builtContent = buildContent(layoutContext);
+  }
+  auto const &content = content_.has_value() ? *content_ : *builtContent;
+
+  if (!content.attachments.empty()) {
+    // Attachments are laid out by `layout`; their size is not a part of the
+    // key.
+    return {};
+  }
+
+  auto key = std::hash<ParagraphAttributes>{}(content.paragraphAttributes);
+  for (auto const &fragment : content.attributedString.getFragments()) {
+    if (fragment.isAttachment()) {
+      return {};
+    }
+
+    // The layout direction is defined by the Yoga style and the layout
+    // constraints, which are matched separately.
+    auto textAttributes = fragment.textAttributes;
+    textAttributes.layoutDirection = {};
+    key = folly::hash::hash_combine(key, fragment.string, textAttributes);
+  }
+  return key;
+}
+
 void ParagraphShadowNode::layout(LayoutContext layoutContext) {
   ensureUnsealed();
 
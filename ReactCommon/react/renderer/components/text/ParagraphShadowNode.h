@@ -41,6 +41,7 @@ class ParagraphShadowNode : public ConcreteViewShadowNode<
     auto traits = ConcreteViewShadowNode::BaseTraits();
     traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
     traits.set(ShadowNodeTraits::Trait::TextKind);
+    traits.set(ShadowNodeTraits::Trait::MeasurableConcurrently);
 
 #ifdef ANDROID
     // Unsetting `FormsStackingContext` trait is essential on Android where we
@@ -64,6 +65,13 @@ class ParagraphShadowNode : public ConcreteViewShadowNode<
   Size measureContent(
       LayoutContext const &layoutContext,
       LayoutConstraints const &layoutConstraints) const override;
+  bool willMeasureContent(LayoutContext const &layoutContext) const override;
+  void didMeasureContent(LayoutContext const &layoutContext) const override;
+
+#pragma mark - Layout Snapshots
+
+  better::optional<size_t> getMeasuredContentKey(
+      LayoutContext const &layoutContext) const override;
 
   /*
    * Internal representation of the nested content of the node in a format
@@ -77,6 +85,11 @@ class ParagraphShadowNode : public ConcreteViewShadowNode<
   };
 
  private:
+  /*
+   * Builds and returns a `Content` object without caching it.
+   */
+  Content buildContent(LayoutContext const &layoutContext) const;
+
   /*
    * Builds (if needed) and returns a reference to a `Content` object.
    */
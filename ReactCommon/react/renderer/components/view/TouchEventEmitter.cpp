@@ -7,6 +7,8 @@
 
 #include "TouchEventEmitter.h"
 
+#include <react/renderer/core/EventPayload.h>
+
 namespace facebook {
 namespace react {
 
@@ -14,28 +16,30 @@ namespace react {
 
 static void setTouchPayloadOnObject(
     jsi::Object &object,
-    jsi::Runtime &runtime,
+    EventPayloadBuilder const &builder,
     Touch const &touch) {
-  object.setProperty(runtime, "locationX", touch.offsetPoint.x);
-  object.setProperty(runtime, "locationY", touch.offsetPoint.y);
-  object.setProperty(runtime, "pageX", touch.pagePoint.x);
-  object.setProperty(runtime, "pageY", touch.pagePoint.y);
-  object.setProperty(runtime, "screenX", touch.screenPoint.x);
-  object.setProperty(runtime, "screenY", touch.screenPoint.y);
-  object.setProperty(runtime, "identifier", touch.identifier);
-  object.setProperty(runtime, "target", touch.target);
-  object.setProperty(runtime, "timestamp", touch.timestamp * 1000);
-  object.setProperty(runtime, "force", touch.force);
+  builder.setProperty(object, EventPayloadKey::LocationX, touch.offsetPoint.x);
+  builder.setProperty(object, EventPayloadKey::LocationY, touch.offsetPoint.y);
+  builder.setProperty(object, EventPayloadKey::PageX, touch.pagePoint.x);
+  builder.setProperty(object, EventPayloadKey::PageY, touch.pagePoint.y);
+  builder.setProperty(object, EventPayloadKey::ScreenX, touch.screenPoint.x);
+  builder.setProperty(object, EventPayloadKey::ScreenY, touch.screenPoint.y);
+  builder.setProperty(object, EventPayloadKey::Identifier, touch.identifier);
+  builder.setProperty(object, EventPayloadKey::Target, touch.target);
+  builder.setProperty(
+      object, EventPayloadKey::Timestamp, touch.timestamp * 1000);
+  builder.setProperty(object, EventPayloadKey::Force, touch.force);
 }
 
 static jsi::Value touchesPayload(
-    jsi::Runtime &runtime,
+    EventPayloadBuilder const &builder,
     Touches const &touches) {
+  auto &runtime = builder.getRuntime();
   auto array = jsi::Array(runtime, touches.size());
   int i = 0;
   for (auto const &touch : touches) {
     auto object = jsi::Object(runtime);
-    setTouchPayloadOnObject(object, runtime, touch);
+    setTouchPayloadOnObject(object, builder, touch);
     array.setValueAtIndex(runtime, i++, object);
   }
   return array;
@@ -44,17 +48,22 @@ static jsi::Value touchesPayload(
 static jsi::Value touchEventPayload(
     jsi::Runtime &runtime,
     TouchEvent const &event) {
+  auto builder = EventPayloadBuilder{runtime};
   auto object = jsi::Object(runtime);
-  object.setProperty(
-      runtime, "touches", touchesPayload(runtime, event.touches));
-  object.setProperty(
-      runtime, "changedTouches", touchesPayload(runtime, event.changedTouches));
-  object.setProperty(
-      runtime, "targetTouches", touchesPayload(runtime, event.targetTouches));
+  builder.setProperty(
+      object, EventPayloadKey::Touches, touchesPayload(builder, event.touches));
+  builder.setProperty(
+      object,
+      EventPayloadKey::ChangedTouches,
+      touchesPayload(builder, event.changedTouches));
+  builder.setProperty(
+      object,
+      EventPayloadKey::TargetTouches,
+      touchesPayload(builder, event.targetTouches));
 
   if (!event.changedTouches.empty()) {
     auto const &firstChangedTouch = *event.changedTouches.begin();
-    setTouchPayloadOnObject(object, runtime, firstChangedTouch);
+    setTouchPayloadOnObject(object, builder, firstChangedTouch);
   }
   return object;
 }
@@ -7,6 +7,8 @@
 
 #include "ViewEventEmitter.h"
 
+#include <react/renderer/core/EventPayload.h>
+
 namespace facebook {
 namespace react {
 
@@ -62,13 +64,15 @@ void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
           return jsi::Value::null();
         }
 
+        auto builder = EventPayloadBuilder{runtime};
         auto layout = jsi::Object(runtime);
-        layout.setProperty(runtime, "x", frame.origin.x);
-        layout.setProperty(runtime, "y", frame.origin.y);
-        layout.setProperty(runtime, "width", frame.size.width);
-        layout.setProperty(runtime, "height", frame.size.height);
+        builder.setProperty(layout, EventPayloadKey::X, frame.origin.x);
+        builder.setProperty(layout, EventPayloadKey::Y, frame.origin.y);
+        builder.setProperty(layout, EventPayloadKey::Width, frame.size.width);
+        builder.setProperty(
+            layout, EventPayloadKey::Height, frame.size.height);
         auto payload = jsi::Object(runtime);
-        payload.setProperty(runtime, "layout", std::move(layout));
+        builder.setProperty(payload, EventPayloadKey::Layout, std::move(layout));
         return jsi::Value(std::move(payload));
       });
 }
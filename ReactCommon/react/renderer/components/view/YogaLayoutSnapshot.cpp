@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YogaLayoutSnapshot.h"
+
+#include <folly/Hash.h>
+#include <react/renderer/components/view/YogaLayoutableShadowNode.h>
+#include <react/renderer/debug/SystraceSection.h>
+#include <yoga/YGNode.h>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Format (all values in the native byte order):
+ * - Header: `kMagic`, `kVersion`, the layout constraints and the parts of the
+ *   layout context which affect layout.
+ * - Records of the nodes in depth-first order, each followed by the records
+ *   of its Yoga children: the size of the record including its descendants,
+ *   the key of the node (see `getKey`), the number of children and whether
+ *   the record has the layout of the node (see `writeLayout`).
+ */
+static constexpr uint32_t kMagic = 0x534C4759; // "YGLS"
+static constexpr uint8_t kVersion = 2;
+
+template <typename T>
+static void write(std::vector<uint8_t> &data, T value) {
+  static_assert(std::is_trivially_copyable<T>::value, "");
+  auto offset = data.size();
+  data.resize(offset + sizeof(T));
+  std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+static void write(
+    std::vector<uint8_t> &data,
+    YGCachedMeasurement const &measurement) {
+  write(data, measurement.availableWidth);
+  write(data, measurement.availableHeight);
+  write(data, uint8_t(measurement.widthMeasureMode));
+  write(data, uint8_t(measurement.heightMeasureMode));
+  write(data, measurement.computedWidth);
+  write(data, measurement.computedHeight);
+}
+
+static void writeHeader(
+    std::vector<uint8_t> &data,
+    LayoutConstraints const &layoutConstraints,
+    LayoutContext const &layoutContext) {
+  write(data, kMagic);
+  write(data, kVersion);
+  write(data, layoutConstraints.minimumSize.width);
+  write(data, layoutConstraints.minimumSize.height);
+  write(data, layoutConstraints.maximumSize.width);
+  write(data, layoutConstraints.maximumSize.height);
+  write(data, uint8_t(layoutConstraints.layoutDirection));
+  write(data, layoutContext.pointScaleFactor);
+  write(data, layoutContext.fontSizeMultiplier);
+  write(data, uint8_t(layoutContext.swapLeftAndRightInRTL));
+}
+
+/*
+ * Writes the results of the layout and the cached measurements. Generation
+ * counts are not written: they are meaningful only in the process the
+ * snapshot was taken in, and restored nodes are not dirty anyway.
+ */
+static void writeLayout(std::vector<uint8_t> &data, YGLayout const &layout) {
+  for (auto value : layout.position) {
+    write(data, value);
+  }
+  for (auto value : layout.dimensions) {
+    write(data, value);
+  }
+  for (auto value : layout.margin) {
+    write(data, value);
+  }
+  for (auto value : layout.border) {
+    write(data, value);
+  }
+  for (auto value : layout.padding) {
+    write(data, value);
+  }
+  write(data, uint8_t(layout.direction()));
+  write(data, uint8_t(layout.hadOverflow()));
+  write(data, layout.computedFlexBasis.unwrap());
+  write(data, uint8_t(layout.lastOwnerDirection));
+  write(data, layout.roundedPointScaleFactor);
+  for (auto value : layout.unroundedPosition) {
+    write(data, value);
+  }
+  for (auto value : layout.unroundedDimensions) {
+    write(data, value);
+  }
+  for (auto value : layout.roundedOwnerPosition) {
+    write(data, value);
+  }
+  for (auto value : layout.measuredDimensions) {
+    write(data, value);
+  }
+  write(data, layout.cachedLayout);
+
+  // Only the entries in use are written.
+  auto cachedMeasurementCount = layout.didEvictCachedMeasurements()
+      ? YG_MAX_CACHED_RESULT_COUNT
+      : layout.nextCachedMeasurementsIndex;
+  write(data, uint8_t(layout.nextCachedMeasurementsIndex));
+  write(data, uint8_t(layout.didEvictCachedMeasurements()));
+  for (size_t i = 0; i < cachedMeasurementCount; i++) {
+    write(data, layout.cachedMeasurements[i]);
+  }
+}
+
+/*
+ * Reads values written by `write`. Reading past the end of the data makes
+ * the reader fail, which makes all further reads fail as well.
+ */
+class YogaLayoutSnapshot::Reader final {
+ public:
+  explicit Reader(std::vector<uint8_t> const &data) : data_(data) {}
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable<T>::value, "");
+    auto value = T{};
+    if (failed_ || offset_ + sizeof(T) > data_.size()) {
+      failed_ = true;
+      return value;
+    }
+    std::memcpy(&value, data_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return value;
+  }
+
+  YGCachedMeasurement readCachedMeasurement() {
+    auto measurement = YGCachedMeasurement{};
+    measurement.availableWidth = read<float>();
+    measurement.availableHeight = read<float>();
+    measurement.widthMeasureMode = YGMeasureMode(read<uint8_t>());
+    measurement.heightMeasureMode = YGMeasureMode(read<uint8_t>());
+    measurement.computedWidth = read<float>();
+    measurement.computedHeight = read<float>();
+    return measurement;
+  }
+
+  bool readHeader(
+      LayoutConstraints const &layoutConstraints,
+      LayoutContext const &layoutContext) {
+    auto data = std::vector<uint8_t>{};
+    writeHeader(data, layoutConstraints, layoutContext);
+    if (offset_ + data.size() > data_.size() ||
+        std::memcmp(data_.data() + offset_, data.data(), data.size()) != 0) {
+      failed_ = true;
+      return false;
+    }
+    offset_ += data.size();
+    return true;
+  }
+
+  void readLayout(YGLayout &layout) {
+    for (auto &value : layout.position) {
+      value = read<float>();
+    }
+    for (auto &value : layout.dimensions) {
+      value = read<float>();
+    }
+    for (auto &value : layout.margin) {
+      value = read<float>();
+    }
+    for (auto &value : layout.border) {
+      value = read<float>();
+    }
+    for (auto &value : layout.padding) {
+      value = read<float>();
+    }
+    layout.setDirection(YGDirection(read<uint8_t>()));
+    layout.setHadOverflow(read<uint8_t>() != 0);
+    layout.computedFlexBasis = YGFloatOptional{read<float>()};
+    layout.lastOwnerDirection = YGDirection(read<uint8_t>());
+    layout.roundedPointScaleFactor = read<float>();
+    for (auto &value : layout.unroundedPosition) {
+      value = read<float>();
+    }
+    for (auto &value : layout.unroundedDimensions) {
+      value = read<float>();
+    }
+    for (auto &value : layout.roundedOwnerPosition) {
+      value = read<float>();
+    }
+    for (auto &value : layout.measuredDimensions) {
+      value = read<float>();
+    }
+    layout.cachedLayout = readCachedMeasurement();
+
+    layout.nextCachedMeasurementsIndex = read<uint8_t>();
+    layout.setDidEvictCachedMeasurements(read<uint8_t>() != 0);
+    auto cachedMeasurementCount = layout.didEvictCachedMeasurements()
+        ? YG_MAX_CACHED_RESULT_COUNT
+        : layout.nextCachedMeasurementsIndex;
+    if (cachedMeasurementCount > YG_MAX_CACHED_RESULT_COUNT) {
+      failed_ = true;
+      return;
+    }
+    for (size_t i = 0; i < cachedMeasurementCount; i++) {
+      layout.cachedMeasurements[i] = readCachedMeasurement();
+    }
+  }
+
+  size_t getOffset() const {
+    return offset_;
+  }
+
+  void setOffset(size_t offset) {
+    if (offset > data_.size()) {
+      failed_ = true;
+      return;
+    }
+    offset_ = offset;
+  }
+
+  bool hasFailed() const {
+    return failed_;
+  }
+
+ private:
+  std::vector<uint8_t> const &data_;
+  size_t offset_{0};
+  bool failed_{false};
+};
+
+static size_t hashOfYogaValue(size_t seed, YGValue value) {
+  return folly::hash::hash_combine(seed, value.value, int(value.unit));
+}
+
+static size_t hashOfYogaStyle(YGStyle const &yogaStyle) {
+  auto seed = folly::hash::hash_combine(
+      0,
+      int(yogaStyle.direction()),
+      int(yogaStyle.flexDirection()),
+      int(yogaStyle.justifyContent()),
+      int(yogaStyle.alignContent()),
+      int(yogaStyle.alignItems()),
+      int(yogaStyle.alignSelf()),
+      int(yogaStyle.positionType()),
+      int(yogaStyle.flexWrap()),
+      int(yogaStyle.overflow()),
+      int(yogaStyle.display()),
+      yogaStyle.flex().unwrap(),
+      yogaStyle.flexGrow().unwrap(),
+      yogaStyle.flexShrink().unwrap(),
+      yogaStyle.aspectRatio().unwrap());
+  seed = hashOfYogaValue(seed, yogaStyle.flexBasis());
+  for (auto edge = 0; edge < yoga::enums::count<YGEdge>(); edge++) {
+    seed = hashOfYogaValue(seed, yogaStyle.margin()[edge]);
+    seed = hashOfYogaValue(seed, yogaStyle.position()[edge]);
+    seed = hashOfYogaValue(seed, yogaStyle.padding()[edge]);
+    seed = hashOfYogaValue(seed, yogaStyle.border()[edge]);
+  }
+  for (auto dimension = 0; dimension < yoga::enums::count<YGDimension>();
+       dimension++) {
+    seed = hashOfYogaValue(seed, yogaStyle.dimensions()[dimension]);
+    seed = hashOfYogaValue(seed, yogaStyle.minDimensions()[dimension]);
+    seed = hashOfYogaValue(seed, yogaStyle.maxDimensions()[dimension]);
+  }
+  return seed;
+}
+
+#pragma mark - YogaLayoutSnapshot
+
+YogaLayoutSnapshot YogaLayoutSnapshot::take(
+    YogaLayoutableShadowNode const &rootShadowNode,
+    LayoutConstraints const &layoutConstraints,
+    LayoutContext const &layoutContext) {
+  SystraceSection s("YogaLayoutSnapshot::take");
+
+  auto data = std::vector<uint8_t>{};
+  writeHeader(data, layoutConstraints, layoutContext);
+  writeNode(data, rootShadowNode, layoutContext, true);
+  return YogaLayoutSnapshot{std::move(data)};
+}
+
+YogaLayoutSnapshot::YogaLayoutSnapshot(std::vector<uint8_t> data)
+    : data_(std::move(data)) {}
+
+std::vector<uint8_t> const &YogaLayoutSnapshot::getData() const {
+  return data_;
+}
+
+size_t YogaLayoutSnapshot::restore(
+    YogaLayoutableShadowNode &rootShadowNode,
+    LayoutConstraints const &layoutConstraints,
+    LayoutContext const &layoutContext) const {
+  SystraceSection s("YogaLayoutSnapshot::restore");
+
+  auto reader = Reader{data_};
+  if (!reader.readHeader(layoutConstraints, layoutContext)) {
+    return 0;
+  }
+
+  auto restoredNodeCount = size_t{0};
+  restoreNode(reader, rootShadowNode, layoutContext, true, restoredNodeCount);
+  return restoredNodeCount;
+}
+
+/*
+ * The key of the root node is its component name only: its Yoga style
+ * depends on the layout constraints, which are compared as a whole.
+ * Returns nothing for nodes which measure their content but cannot tell
+ * whether it changed.
+ */
+better::optional<uint64_t> YogaLayoutSnapshot::getKey(
+    YogaLayoutableShadowNode const &shadowNode,
+    LayoutContext const &layoutContext,
+    bool isRoot) {
+  auto key = std::hash<std::string>{}(shadowNode.getComponentName());
+  if (isRoot) {
+    return uint64_t(key);
+  }
+
+  key = folly::hash::hash_combine(
+      key, hashOfYogaStyle(shadowNode.yogaNode_.getStyle()));
+
+  if (shadowNode.yogaNode_.hasMeasureFunc()) {
+    auto contentKey = shadowNode.getMeasuredContentKey(layoutContext);
+    if (!contentKey) {
+      return {};
+    }
+    key = folly::hash::hash_combine(key, *contentKey);
+  }
+
+  return uint64_t(key);
+}
+
+void YogaLayoutSnapshot::writeNode(
+    std::vector<uint8_t> &data,
+    YogaLayoutableShadowNode const &shadowNode,
+    LayoutContext const &layoutContext,
+    bool isRoot) {
+  auto &yogaNode = shadowNode.yogaNode_;
+  auto &yogaChildren = yogaNode.getChildren();
+  auto key = getKey(shadowNode, layoutContext, isRoot);
+  auto hasLayout = key.has_value() && !isRoot && !yogaNode.isDirty();
+
+  auto offset = data.size();
+  write(data, uint32_t{0});
+  write(data, key.value_or(0));
+  write(data, uint32_t(yogaChildren.size()));
+  write(data, uint8_t(hasLayout));
+  if (hasLayout) {
+    writeLayout(data, yogaNode.getLayout());
+  }
+
+  for (auto childYogaNode : yogaChildren) {
+    writeNode(
+        data,
+        *static_cast<YogaLayoutableShadowNode const *>(
+            childYogaNode->getContext()),
+        layoutContext,
+        false);
+  }
+
+  auto size = uint32_t(data.size() - offset);
+  std::memcpy(data.data() + offset, &size, sizeof(size));
+}
+
+/*
+ * Returns whether the layout of the whole subtree was restored.
+ */
+bool YogaLayoutSnapshot::restoreNode(
+    Reader &reader,
+    YogaLayoutableShadowNode &shadowNode,
+    LayoutContext const &layoutContext,
+    bool isRoot,
+    size_t &restoredNodeCount) {
+  auto offset = reader.getOffset();
+  auto size = reader.read<uint32_t>();
+  auto key = reader.read<uint64_t>();
+  auto childCount = reader.read<uint32_t>();
+  auto hasLayout = reader.read<uint8_t>() != 0;
+  if (reader.hasFailed()) {
+    return false;
+  }
+
+  auto &yogaNode = shadowNode.yogaNode_;
+  auto &yogaChildren = yogaNode.getChildren();
+  auto nodeKey = getKey(shadowNode, layoutContext, isRoot);
+  if (!nodeKey || *nodeKey != key || childCount != yogaChildren.size()) {
+    reader.setOffset(offset + size);
+    return false;
+  }
+
+  auto layout = YGLayout{};
+  if (hasLayout) {
+    reader.readLayout(layout);
+  }
+
+  auto isSubtreeRestored = hasLayout;
+  for (auto childYogaNode : yogaChildren) {
+    auto &childShadowNode =
+        *static_cast<YogaLayoutableShadowNode *>(childYogaNode->getContext());
+
+    // Nodes shared with other trees must not be changed (the same way Yoga
+    // copies them before laying them out).
+    if (childYogaNode->getOwner() != &yogaNode) {
+      auto childOffset = reader.getOffset();
+      reader.setOffset(childOffset + reader.read<uint32_t>());
+      isSubtreeRestored = false;
+      continue;
+    }
+
+    isSubtreeRestored = restoreNode(
+                            reader,
+                            childShadowNode,
+                            layoutContext,
+                            false,
+                            restoredNodeCount) &&
+        isSubtreeRestored;
+  }
+
+  if (reader.hasFailed() || reader.getOffset() != offset + size) {
+    return false;
+  }
+
+  if (!isSubtreeRestored || isRoot) {
+    return false;
+  }
+
+  yogaNode.setLayout(layout);
+  yogaNode.setHasNewLayout(true);
+  yogaNode.setDirty(false);
+  restoredNodeCount++;
+  return true;
+}
+
+} // namespace react
+} // namespace facebook
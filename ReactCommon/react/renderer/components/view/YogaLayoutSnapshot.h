@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <better/optional.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/core/LayoutContext.h>
+
+namespace facebook {
+namespace react {
+
+class YogaLayoutableShadowNode;
+
+/*
+ * Layout of a laid out tree of `YogaLayoutableShadowNode`s in a compact binary
+ * form: the Yoga layout of every node, including its cached measurements.
+ * The snapshot of a stopped surface can be restored onto the first tree of the
+ * restarted surface before the tree is laid out, so that only the parts of the
+ * tree which changed in the meantime are laid out again.
+ *
+ * Tags of the new tree are different, so nodes are matched by their position
+ * in the tree, their component name, their Yoga style and (for nodes which
+ * measure their content) `YogaLayoutableShadowNode::getMeasuredContentKey`.
+ * A node gets its layout restored only if its whole subtree matches; other
+ * nodes stay dirty and are laid out as usual, reusing the cached measurements
+ * of the restored nodes.
+ */
+class YogaLayoutSnapshot final {
+ public:
+  using Shared = std::shared_ptr<YogaLayoutSnapshot const>;
+
+  /*
+   * Takes a snapshot of the tree with a given root node, which was laid out
+   * with given `layoutConstraints` and `layoutContext`.
+   */
+  static YogaLayoutSnapshot take(
+      YogaLayoutableShadowNode const &rootShadowNode,
+      LayoutConstraints const &layoutConstraints,
+      LayoutContext const &layoutContext);
+
+  YogaLayoutSnapshot() = default;
+  explicit YogaLayoutSnapshot(std::vector<uint8_t> data);
+
+  /*
+   * Serialized snapshot, which can be stored and passed to the constructor
+   * later. Empty if there is nothing to restore.
+   */
+  std::vector<uint8_t> const &getData() const;
+
+  /*
+   * Restores the layout onto the tree with a given root node which was not
+   * laid out yet, if the tree is going to be laid out with the same
+   * `layoutConstraints` and `layoutContext` as the tree of the snapshot.
+   * Only nodes which are exclusively owned by their parents (not shared with
+   * other trees) are restored; the root node itself is always laid out again.
+   * Returns the number of nodes with restored layout.
+   */
+  size_t restore(
+      YogaLayoutableShadowNode &rootShadowNode,
+      LayoutConstraints const &layoutConstraints,
+      LayoutContext const &layoutContext) const;
+
+ private:
+  class Reader;
+
+  static better::optional<uint64_t> getKey(
+      YogaLayoutableShadowNode const &shadowNode,
+      LayoutContext const &layoutContext,
+      bool isRoot);
+
+  static void writeNode(
+      std::vector<uint8_t> &data,
+      YogaLayoutableShadowNode const &shadowNode,
+      LayoutContext const &layoutContext,
+      bool isRoot);
+
+  static bool restoreNode(
+      Reader &reader,
+      YogaLayoutableShadowNode &shadowNode,
+      LayoutContext const &layoutContext,
+      bool isRoot,
+      size_t &restoredNodeCount);
+
+  std::vector<uint8_t> data_;
+};
+
+} // namespace react
+} // namespace facebook
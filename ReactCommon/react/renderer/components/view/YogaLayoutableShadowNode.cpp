@@ -8,20 +8,46 @@
 #include "YogaLayoutableShadowNode.h"
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/components/view/conversions.h>
+#include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <yoga/Yoga.h>
 #include <algorithm>
+#include <deque>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 
 namespace facebook {
 namespace react {
 
 thread_local LayoutContext threadLocalLayoutContext;
 
+/*
+ * Copies of Yoga nodes of shared shadow nodes which Yoga made during a layout
+ * pass. Shadow nodes are cloned only after the pass and only if the copies
+ * got new layout results, see `adoptLaidOutYogaChildren`.
+ */
+class YogaLayoutSideTable final {
+ public:
+  YGNode *copy(YGNode const &yogaNode) {
+    copies_.emplace_back(yogaNode);
+    return &copies_.back();
+  }
+
+  /*
+   * Memoized results of `YogaLayoutableShadowNode::hasNewLayoutResults`.
+   */
+  std::unordered_map<YGNode const *, bool> hasNewLayoutResults;
+
+ private:
+  std::deque<YGNode> copies_;
+};
+
+thread_local YogaLayoutSideTable *threadLocalLayoutSideTable = nullptr;
+
 static void applyLayoutConstraints(
     YGStyle &yogaStyle,
     LayoutConstraints const &layoutConstraints) {
@@ -39,6 +65,17 @@ static void applyLayoutConstraints(
       yogaDirectionFromLayoutDirection(layoutConstraints.layoutDirection);
 }
 
+/*
+ * The part of the content frame of its parent a child covers: its frame
+ * including the content overflowing it, if the child is displayed.
+ */
+static Rect contentFrameOfChild(LayoutMetrics const &layoutMetrics) {
+  if (layoutMetrics.displayType == DisplayType::None) {
+    return {};
+  }
+  return insetBy(layoutMetrics.frame, layoutMetrics.overflowInset);
+}
+
 ShadowNodeTraits YogaLayoutableShadowNode::BaseTraits() {
   auto traits = LayoutableShadowNode::BaseTraits();
   traits.set(ShadowNodeTraits::Trait::YogaLayoutableKind);
@@ -87,8 +124,17 @@ YogaLayoutableShadowNode::YogaLayoutableShadowNode(
     yogaNode_.setDirty(true);
   }
 
+  auto const &sourceYogaLayoutableShadowNode =
+      static_cast<YogaLayoutableShadowNode const &>(sourceShadowNode);
+  contentFrame_ = sourceYogaLayoutableShadowNode.contentFrame_;
+  isContentFrameValid_ = sourceYogaLayoutableShadowNode.isContentFrameValid_;
+  isLeftAndRightSwapped_ =
+      sourceYogaLayoutableShadowNode.isLeftAndRightSwapped_;
+
   if (fragment.props) {
-    updateYogaProps();
+    updateYogaProps(&static_cast<YogaStylableProps const &>(
+                         *sourceShadowNode.getProps())
+                         .yogaStyle);
   }
 
   if (fragment.children) {
@@ -103,7 +149,7 @@ void YogaLayoutableShadowNode::cleanLayout() {
 }
 
 void YogaLayoutableShadowNode::dirtyLayout() {
-  yogaNode_.setDirty(true);
+  yogaNode_.markContentDirty();
 }
 
 bool YogaLayoutableShadowNode::getIsLayoutClean() const {
@@ -161,8 +207,10 @@ void YogaLayoutableShadowNode::adoptYogaChild(size_t index) {
     layoutableChildNode.yogaNode_.setOwner(&yogaNode_);
     // At this point the child yoga node must be already inserted by the caller.
     // assert(layoutableChildNode.yogaNode_.isDirty());
-  } else {
-    // The child is owned by some other node, we need to clone that.
+  } else if (layoutableChildNode.yogaNode_.getOwner() == &yogaNode_) {
+    // The child was owned by a deallocated node which had the same address as
+    // `yogaNode_` (the ABA problem mentioned above). It might be shared with
+    // some other tree, so we need to clone that.
     auto clonedChildNode = childNode.clone({});
     auto &layoutableClonedChildNode =
         traitCast<YogaLayoutableShadowNode const &>(*clonedChildNode);
@@ -180,6 +228,11 @@ void YogaLayoutableShadowNode::adoptYogaChild(size_t index) {
     yogaNode_.replaceChild(&layoutableClonedChildNode.yogaNode_, index);
   }
 
+  // Otherwise, the child is owned by some other node and stays shared with it.
+  // Yoga copies the Yoga node of the child if it needs to lay it out (see
+  // `yogaNodeCloneCallbackConnector`), and the child is cloned only if its
+  // layout changes (see `adoptLaidOutYogaChildren`).
+
   ensureYogaChildrenLookFine();
 }
 
@@ -190,6 +243,8 @@ void YogaLayoutableShadowNode::appendChild(
 
   // Calling the base class (`ShadowNode`) mehtod.
   LayoutableShadowNode::appendChild(childNode);
+  isContentFrameValid_ = false;
+  isLeftAndRightSwapped_ = false;
 
   if (getTraits().check(ShadowNodeTraits::Trait::LeafYogaNode)) {
     // This node is a declared leaf.
@@ -238,39 +293,71 @@ void YogaLayoutableShadowNode::updateYogaChildren() {
 
   ensureUnsealed();
 
-  bool isClean = !yogaNode_.isDirty() &&
-      getChildren().size() == yogaNode_.getChildren().size();
+  isLeftAndRightSwapped_ = false;
 
-  auto oldYogaChildren = isClean ? yogaNode_.getChildren() : YGVector{};
+  auto oldYogaChildren = yogaNode_.getChildren();
   yogaNode_.setChildren({});
 
+  // Children which are new or have new styles change the layout of this node,
+  // children which are dirty might only change it.
+  bool hasSameChildren = getChildren().size() == oldYogaChildren.size();
+  bool hasDirtyChildren = false;
+  isContentFrameValid_ = isContentFrameValid_ && hasSameChildren;
+
   for (size_t i = 0; i < getChildren().size(); i++) {
     appendYogaChild(*getChildren().at(i));
     adoptYogaChild(i);
 
-    if (isClean) {
-      auto &oldYogaChildNode = *oldYogaChildren[i];
-      auto &newYogaChildNode =
-          traitCast<YogaLayoutableShadowNode const &>(*getChildren().at(i))
-              .yogaNode_;
+    auto &newChildNode =
+        traitCast<YogaLayoutableShadowNode const &>(*getChildren().at(i));
+    auto &newYogaChildNode = newChildNode.yogaNode_;
+    hasDirtyChildren = hasDirtyChildren || newYogaChildNode.isDirty();
 
-      isClean = isClean && !newYogaChildNode.isDirty() &&
-          (newYogaChildNode.getStyle() == oldYogaChildNode.getStyle());
+    if (!hasSameChildren || oldYogaChildren[i] == &newYogaChildNode) {
+      continue;
     }
+
+    auto &oldChildNode = *static_cast<YogaLayoutableShadowNode const *>(
+        oldYogaChildren[i]->getContext());
+    hasSameChildren = ShadowNode::sameFamily(newChildNode, oldChildNode) &&
+        newYogaChildNode.getStyle() == oldYogaChildren[i]->getStyle();
+    isContentFrameValid_ = isContentFrameValid_ && hasSameChildren &&
+        contentFrameOfChild(newChildNode.getLayoutMetrics()) ==
+            contentFrameOfChild(oldChildNode.getLayoutMetrics());
   }
 
   assert(getChildren().size() == yogaNode_.getChildren().size());
 
-  yogaNode_.setDirty(!isClean);
+  if (!hasSameChildren) {
+    yogaNode_.setDirty(true);
+  } else if (hasDirtyChildren) {
+    yogaNode_.markContentDirty();
+  }
 }
 
-void YogaLayoutableShadowNode::updateYogaProps() {
+void YogaLayoutableShadowNode::updateYogaProps(
+    YGStyle const *sourceYogaStyle) {
   ensureUnsealed();
 
+  isLeftAndRightSwapped_ = false;
+
   auto props = static_cast<YogaStylableProps const &>(*props_);
 
+  // The Yoga style of a node laid out with `swapLeftAndRightInRTL` differs
+  // from the style of its props (see `swapLeftAndRightInProps`).
+  // New props which swap to the same style keep the swapped one.
+  if (sourceYogaStyle && props.yogaStyle != yogaNode_.getStyle() &&
+      *sourceYogaStyle != yogaNode_.getStyle()) {
+    auto swappedYogaStyle = props.yogaStyle;
+    swapLeftAndRightInYogaStyle(swappedYogaStyle);
+    if (swappedYogaStyle == yogaNode_.getStyle()) {
+      return;
+    }
+  }
+
   // Resetting `dirty` flag only if `yogaStyle` portion of `Props` was changed.
-  if (!yogaNode_.isDirty() && (props.yogaStyle != yogaNode_.getStyle())) {
+  // A node which is dirty already might only be dirty in its content.
+  if (props.yogaStyle != yogaNode_.getStyle()) {
     yogaNode_.setDirty(true);
   }
 
@@ -287,7 +374,7 @@ void YogaLayoutableShadowNode::setSize(Size size) const {
   yogaNode_.setDirty(true);
 }
 
-void YogaLayoutableShadowNode::setPadding(RectangleEdges<Float> padding) const {
+void YogaLayoutableShadowNode::setPadding(RectangleEdges<Float> padding) {
   ensureUnsealed();
 
   auto style = yogaNode_.getStyle();
@@ -307,6 +394,7 @@ void YogaLayoutableShadowNode::setPadding(RectangleEdges<Float> padding) const {
     style.padding()[YGEdgeBottom] = yogaStyleValueFromFloat(padding.bottom);
     yogaNode_.setStyle(style);
     yogaNode_.setDirty(true);
+    isLeftAndRightSwapped_ = false;
   }
 }
 
@@ -335,20 +423,35 @@ void YogaLayoutableShadowNode::layoutTree(
    * (and this is by design).
    */
   yogaConfig_.pointScaleFactor = layoutContext.pointScaleFactor;
+  yogaConfig_.incrementalLayout = layoutContext.incrementalLayout;
+
+  // Same for batch measurements: only the config of the root node is used.
+  yogaConfig_.setMeasureBatchFunc(
+      layoutContext.measureExecutor
+          ? YogaLayoutableShadowNode::yogaNodeMeasureBatchCallbackConnector
+          : nullptr);
 
   applyLayoutConstraints(yogaNode_.getStyle(), layoutConstraints);
 
   threadLocalLayoutContext = layoutContext;
 
   if (layoutContext.swapLeftAndRightInRTL) {
-    swapLeftAndRightInTree(*this);
+    swapLeftAndRightInTree();
   }
 
   {
     SystraceSection s("YogaLayoutableShadowNode::YGNodeCalculateLayout");
 
+    auto layoutSideTable = YogaLayoutSideTable{};
+    auto previousLayoutSideTable = threadLocalLayoutSideTable;
+    threadLocalLayoutSideTable = &layoutSideTable;
+
     YGNodeCalculateLayout(
         &yogaNode_, YGUndefined, YGUndefined, YGDirectionInherit);
+
+    adoptLaidOutYogaChildren(layoutContext);
+
+    threadLocalLayoutSideTable = previousLayoutSideTable;
   }
 
   if (yogaNode_.getHasNewLayout()) {
@@ -375,12 +478,155 @@ static EdgeInsets calculateOverflowInset(
   return overflowInset;
 }
 
+/*
+ * Returns the layout of a given Yoga node without the measurements Yoga
+ * caches. A copy which only got new cache entries is dropped, the cache of the
+ * shared node stays valid for its own entries.
+ */
+static YGLayout layoutResultsOfYogaNode(YGNode const &yogaNode) {
+  auto layout = yogaNode.getLayout();
+  layout.nextCachedMeasurementsIndex = 0;
+  layout.cachedMeasurements = {};
+  layout.cachedLayout = YGCachedMeasurement{};
+  layout.computedFlexBasis = YGFloatOptional{};
+  return layout;
+}
+
+void YogaLayoutableShadowNode::adoptLaidOutYogaChildren(
+    LayoutContext const &layoutContext) {
+  auto &yogaChildren = yogaNode_.getChildren();
+
+  for (size_t i = 0; i < yogaChildren.size(); i++) {
+    auto childYogaNode = yogaChildren[i];
+    auto childNode =
+        static_cast<YogaLayoutableShadowNode *>(childYogaNode->getContext());
+
+    if (childYogaNode != &childNode->yogaNode_) {
+      childNode = &adoptLaidOutYogaChild(i, *childYogaNode, layoutContext);
+    }
+
+    // Verifying that the Yoga node belongs to the ShadowNode.
+    assert(yogaChildren[i] == &childNode->yogaNode_);
+
+    // Copies can only be found in the subtrees of owned nodes.
+    if (doesOwn(*childNode)) {
+      childNode->adoptLaidOutYogaChildren(layoutContext);
+    }
+  }
+}
+
+YogaLayoutableShadowNode &YogaLayoutableShadowNode::adoptLaidOutYogaChild(
+    size_t index,
+    YGNode &yogaNodeCopy,
+    LayoutContext const &layoutContext) {
+  ensureUnsealed();
+
+  auto &childNode =
+      *static_cast<YogaLayoutableShadowNode *>(yogaNodeCopy.getContext());
+
+  if (!hasNewLayoutResults(yogaNodeCopy, layoutContext.pointScaleFactor)) {
+    // Yoga came up with what the child already has; it stays shared.
+    yogaNode_.replaceChild(&childNode.yogaNode_, index);
+    if (layoutContext.affectedNodes) {
+      collectSharedNodesLaidOutAgain(
+          yogaNodeCopy, *layoutContext.affectedNodes);
+    }
+    return childNode;
+  }
+
+  auto clonedChildNode =
+      childNode.clone({ShadowNodeFragment::propsPlaceholder(),
+                       ShadowNodeFragment::childrenPlaceholder(),
+                       childNode.getState()});
+  auto &layoutableClonedChildNode =
+      static_cast<YogaLayoutableShadowNode &>(*clonedChildNode);
+  auto &clonedYogaNode = layoutableClonedChildNode.yogaNode_;
+
+  // Moving the results of the layout pass over, including the children (which
+  // might be copies as well).
+  clonedYogaNode.setLayout(yogaNodeCopy.getLayout());
+  clonedYogaNode.setLineIndex(yogaNodeCopy.getLineIndex());
+  clonedYogaNode.setHasNewLayout(yogaNodeCopy.getHasNewLayout());
+  clonedYogaNode.setDirty(yogaNodeCopy.isDirty());
+  clonedYogaNode.setChildren(yogaNodeCopy.getChildren());
+  for (auto grandchildYogaNode : yogaNodeCopy.getChildren()) {
+    if (grandchildYogaNode->getOwner() == &yogaNodeCopy) {
+      grandchildYogaNode->setOwner(&clonedYogaNode);
+    }
+  }
+  clonedYogaNode.setOwner(&yogaNode_);
+
+  // Note, this might deallocate `childNode`.
+  replaceChild(childNode, clonedChildNode, index);
+  yogaNode_.replaceChild(&clonedYogaNode, index);
+
+  return layoutableClonedChildNode;
+}
+
+bool YogaLayoutableShadowNode::hasNewLayoutResults(
+    YGNode const &yogaNodeCopy,
+    Float pointScaleFactor) {
+  auto &memoizedResults = threadLocalLayoutSideTable->hasNewLayoutResults;
+  auto iterator = memoizedResults.find(&yogaNodeCopy);
+  if (iterator != memoizedResults.end()) {
+    return iterator->second;
+  }
+
+  auto &shadowNode =
+      *static_cast<YogaLayoutableShadowNode const *>(yogaNodeCopy.getContext());
+  auto &yogaNode = shadowNode.yogaNode_;
+
+  auto result = yogaNodeCopy.isDirty() != yogaNode.isDirty() ||
+      !(layoutResultsOfYogaNode(yogaNodeCopy) ==
+        layoutResultsOfYogaNode(yogaNode)) ||
+      shadowNode.getLayoutMetrics().pointScaleFactor != pointScaleFactor;
+
+  for (auto childYogaNode : yogaNodeCopy.getChildren()) {
+    if (result) {
+      break;
+    }
+
+    auto &childNode = *static_cast<YogaLayoutableShadowNode const *>(
+        childYogaNode->getContext());
+    if (childYogaNode != &childNode.yogaNode_) {
+      result = hasNewLayoutResults(*childYogaNode, pointScaleFactor);
+    }
+  }
+
+  memoizedResults[&yogaNodeCopy] = result;
+  return result;
+}
+
+void YogaLayoutableShadowNode::collectSharedNodesLaidOutAgain(
+    YGNode const &yogaNodeCopy,
+    std::vector<LayoutableShadowNode const *> &affectedNodes) {
+  if (!yogaNodeCopy.getHasNewLayout()) {
+    return;
+  }
+
+  // Yoga laid the node out again, so it gets an onLayout event the same way
+  // as if it was cloned, even though its layout has not changed (see `layout`).
+  auto &shadowNode =
+      *static_cast<YogaLayoutableShadowNode const *>(yogaNodeCopy.getContext());
+  affectedNodes.push_back(&shadowNode);
+
+  if (yogaNodeCopy.getStyle().display() == YGDisplayNone) {
+    return;
+  }
+
+  for (auto childYogaNode : yogaNodeCopy.getChildren()) {
+    auto &childNode = *static_cast<YogaLayoutableShadowNode const *>(
+        childYogaNode->getContext());
+    if (childYogaNode != &childNode.yogaNode_) {
+      collectSharedNodesLaidOutAgain(*childYogaNode, affectedNodes);
+    }
+  }
+}
+
 void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
   // Reading data from a dirtied node does not make sense.
   assert(!yogaNode_.isDirty());
 
-  auto contentFrame = Rect{};
-
   for (auto childYogaNode : yogaNode_.getChildren()) {
     auto &childNode =
         *static_cast<YogaLayoutableShadowNode *>(childYogaNode->getContext());
@@ -388,16 +634,16 @@ void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
     // Verifying that the Yoga node belongs to the ShadowNode.
     assert(&childNode.yogaNode_ == childYogaNode);
 
-    if (childYogaNode->getHasNewLayout()) {
+    // We must copy layout metrics from Yoga node only once (when the parent
+    // node exclusively ownes the child node). Children which stay shared were
+    // not laid out during this pass, see `adoptLaidOutYogaChildren`.
+    if (childYogaNode->getHasNewLayout() &&
+        childYogaNode->getOwner() == &yogaNode_) {
       childYogaNode->setHasNewLayout(false);
 
       // Reading data from a dirtied node does not make sense.
       assert(!childYogaNode->isDirty());
 
-      // We must copy layout metrics from Yoga node only once (when the parent
-      // node exclusively ownes the child node).
-      assert(childYogaNode->getOwner() == &yogaNode_);
-
       // We are about to mutate layout metrics of the node.
       childNode.ensureUnsealed();
 
@@ -413,29 +659,45 @@ void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
         layoutContext.affectedNodes->push_back(&childNode);
       }
 
+      auto oldContentFrame = contentFrameOfChild(childNode.getLayoutMetrics());
+
       childNode.setLayoutMetrics(newLayoutMetrics);
 
       if (newLayoutMetrics.displayType != DisplayType::None) {
         childNode.layout(layoutContext);
       }
+
+      isContentFrameValid_ = isContentFrameValid_ &&
+          contentFrameOfChild(childNode.getLayoutMetrics()) == oldContentFrame;
     }
+  }
 
-    auto layoutMetricsWithOverflowInset = childNode.getLayoutMetrics();
-    if (layoutMetricsWithOverflowInset.displayType != DisplayType::None) {
-      contentFrame.unionInPlace(insetBy(
-          layoutMetricsWithOverflowInset.frame,
-          layoutMetricsWithOverflowInset.overflowInset));
+  if (!isContentFrameValid_) {
+    contentFrame_ = Rect{};
+    for (auto childYogaNode : yogaNode_.getChildren()) {
+      auto &childNode = *static_cast<YogaLayoutableShadowNode const *>(
+          childYogaNode->getContext());
+      contentFrame_.unionInPlace(
+          contentFrameOfChild(childNode.getLayoutMetrics()));
     }
+    isContentFrameValid_ = true;
   }
 
   if (yogaNode_.getStyle().overflow() == YGOverflowVisible) {
     layoutMetrics_.overflowInset =
-        calculateOverflowInset(layoutMetrics_.frame, contentFrame);
+        calculateOverflowInset(layoutMetrics_.frame, contentFrame_);
   } else {
     layoutMetrics_.overflowInset = {};
   }
 }
 
+#pragma mark - Layout Snapshots
+
+better::optional<size_t> YogaLayoutableShadowNode::getMeasuredContentKey(
+    LayoutContext const &layoutContext) const {
+  return {};
+}
+
 #pragma mark - Yoga Connectors
 
 YGNode *YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector(
@@ -444,29 +706,21 @@ YGNode *YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector(
     int childIndex) {
   SystraceSection s("YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector");
 
-  // At this point it is guaranteed that all shadow nodes associated with yoga
-  // nodes are `YogaLayoutableShadowNode` subclasses.
-  auto parentNode =
-      static_cast<YogaLayoutableShadowNode *>(parentYogaNode->getContext());
-  auto oldNode =
-      static_cast<YogaLayoutableShadowNode *>(oldYogaNode->getContext());
-
-  auto clonedNode = oldNode->clone({ShadowNodeFragment::propsPlaceholder(),
-                                    ShadowNodeFragment::childrenPlaceholder(),
-                                    oldNode->getState()});
-  parentNode->replaceChild(*oldNode, clonedNode, childIndex);
-  return &static_cast<YogaLayoutableShadowNode &>(*clonedNode).yogaNode_;
+  // The shadow node associated with `oldYogaNode` is shared with some other
+  // tree, so Yoga must not write into its Yoga node. Instead of cloning the
+  // shadow node right away, Yoga gets a copy of the Yoga node which lives
+  // until the end of the layout pass (see `adoptLaidOutYogaChildren`).
+  assert(threadLocalLayoutSideTable);
+  return threadLocalLayoutSideTable->copy(*oldYogaNode);
 }
 
-YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
+static YGSize measureYogaNode(
     YGNode *yogaNode,
+    LayoutContext const &layoutContext,
     float width,
     YGMeasureMode widthMode,
     float height,
     YGMeasureMode heightMode) {
-  SystraceSection s(
-      "YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector");
-
   auto shadowNodeRawPtr =
       static_cast<YogaLayoutableShadowNode *>(yogaNode->getContext());
 
@@ -499,12 +753,89 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
   }
 
   auto size = shadowNodeRawPtr->measureContent(
-      threadLocalLayoutContext, {minimumSize, maximumSize});
+      layoutContext, {minimumSize, maximumSize});
 
   return YGSize{yogaFloatFromFloat(size.width),
                 yogaFloatFromFloat(size.height)};
 }
 
+YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
+    YGNode *yogaNode,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  SystraceSection s(
+      "YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector");
+
+  auto const &shadowNode =
+      *static_cast<YogaLayoutableShadowNode *>(yogaNode->getContext());
+  shadowNode.willMeasureContent(threadLocalLayoutContext);
+
+  auto size = measureYogaNode(
+      yogaNode,
+      threadLocalLayoutContext,
+      width,
+      widthMode,
+      height,
+      heightMode);
+
+  shadowNode.didMeasureContent(threadLocalLayoutContext);
+  return size;
+}
+
+void YogaLayoutableShadowNode::yogaNodeMeasureBatchCallbackConnector(
+    YGMeasureRequest *requests,
+    size_t count,
+    void * /*layoutContext*/) {
+  SystraceSection s(
+      "YogaLayoutableShadowNode::yogaNodeMeasureBatchCallbackConnector");
+
+  // Worker threads don't have the thread-local layout context.
+  auto const layoutContext = threadLocalLayoutContext;
+  assert(layoutContext.measureExecutor);
+
+  auto concurrentRequests = better::small_vector<YGMeasureRequest *, 16>{};
+  for (size_t i = 0; i < count; i++) {
+    auto &request = requests[i];
+    auto const &shadowNode =
+        *static_cast<YogaLayoutableShadowNode *>(request.node->getContext());
+    auto canMeasureConcurrently = shadowNode.willMeasureContent(layoutContext);
+    if (canMeasureConcurrently &&
+        shadowNode.getTraits().check(
+            ShadowNodeTraits::Trait::MeasurableConcurrently)) {
+      concurrentRequests.push_back(&request);
+    } else {
+      request.size = measureYogaNode(
+          request.node,
+          layoutContext,
+          request.width,
+          request.widthMode,
+          request.height,
+          request.heightMode);
+    }
+  }
+
+  if (!concurrentRequests.empty()) {
+    (*layoutContext.measureExecutor)(
+        concurrentRequests.size(), [&](size_t index) {
+          auto &request = *concurrentRequests[index];
+          request.size = measureYogaNode(
+              request.node,
+              layoutContext,
+              request.width,
+              request.widthMode,
+              request.height,
+              request.heightMode);
+        });
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    static_cast<YogaLayoutableShadowNode *>(requests[i].node->getContext())
+        ->didMeasureContent(layoutContext);
+  }
+}
+
 #ifdef RN_DEBUG_YOGA_LOGGER
 static int YogaLog(
     const YGConfigRef config,
@@ -533,29 +864,102 @@ YGConfig &YogaLayoutableShadowNode::initializeYogaConfig(YGConfig &config) {
 
 #pragma mark - RTL left and right swapping
 
-void YogaLayoutableShadowNode::swapLeftAndRightInTree(
-    YogaLayoutableShadowNode const &shadowNode) {
-  swapLeftAndRightInYogaStyleProps(shadowNode);
-  swapLeftAndRightInViewProps(shadowNode);
+bool YogaLayoutableShadowNode::swapLeftAndRightInTree() {
+  ensureUnsealed();
+
+  if (isLeftAndRightSwapped_) {
+    return false;
+  }
+
+  auto hasSwappedYogaStyles = swapLeftAndRightInProps();
+
+  if (!getTraits().check(ShadowNodeTraits::Trait::LeafYogaNode)) {
+    auto &yogaChildren = yogaNode_.getChildren();
+
+    for (size_t i = 0; i < yogaChildren.size(); i++) {
+      auto childNode = static_cast<YogaLayoutableShadowNode *>(
+          yogaChildren[i]->getContext());
 
-  for (auto &child : shadowNode.getChildren()) {
-    auto const yogaLayoutableChild =
-        traitCast<YogaLayoutableShadowNode const *>(child.get());
-    if (yogaLayoutableChild && !yogaLayoutableChild->doesOwn(shadowNode)) {
-      swapLeftAndRightInTree(*yogaLayoutableChild);
+      if (childNode->isLeftAndRightSwapped_) {
+        continue;
+      }
+
+      // A child which is not owned by this node might be shared with other
+      // trees.
+      if (!doesOwn(*childNode) || childNode->getSealed()) {
+        childNode = &cloneYogaChild(i);
+      }
+
+      if (childNode->swapLeftAndRightInTree()) {
+        yogaNode_.setDirty(true);
+        hasSwappedYogaStyles = true;
+      }
     }
   }
+
+  isLeftAndRightSwapped_ = true;
+  return hasSwappedYogaStyles;
 }
 
-void YogaLayoutableShadowNode::swapLeftAndRightInYogaStyleProps(
-    YogaLayoutableShadowNode const &shadowNode) {
-  auto yogaStyle = shadowNode.yogaNode_.getStyle();
+bool YogaLayoutableShadowNode::swapLeftAndRightInProps() {
+  if (hasLeftOrRightValues(static_cast<ViewProps const &>(*props_))) {
+    auto props = getComponentDescriptor().cloneProps(props_, {});
+    swapLeftAndRightInViewProps(
+        const_cast<ViewProps &>(static_cast<ViewProps const &>(*props)));
+    props_ = props;
+  }
+
+  if (!hasLeftOrRightValues(yogaNode_.getStyle())) {
+    return false;
+  }
 
+  auto yogaStyle = yogaNode_.getStyle();
+  swapLeftAndRightInYogaStyle(yogaStyle);
+  yogaNode_.setStyle(yogaStyle);
+  yogaNode_.setDirty(true);
+  return true;
+}
+
+YogaLayoutableShadowNode &YogaLayoutableShadowNode::cloneYogaChild(
+    size_t index) {
+  auto &childNode = *static_cast<YogaLayoutableShadowNode const *>(
+      yogaNode_.getChildren()[index]->getContext());
+
+  auto clonedChildNode =
+      childNode.clone({ShadowNodeFragment::propsPlaceholder(),
+                       ShadowNodeFragment::childrenPlaceholder(),
+                       childNode.getState()});
+  auto &layoutableClonedChildNode =
+      static_cast<YogaLayoutableShadowNode &>(*clonedChildNode);
+  layoutableClonedChildNode.yogaNode_.setOwner(&yogaNode_);
+
+  // Note, this might deallocate `childNode`.
+  replaceChild(childNode, clonedChildNode, index);
+  yogaNode_.replaceChild(&layoutableClonedChildNode.yogaNode_, index);
+
+  return layoutableClonedChildNode;
+}
+
+bool YogaLayoutableShadowNode::hasLeftOrRightValues(
+    YGStyle const &yogaStyle) {
+  auto hasLeftOrRight = [](YGStyle::Edges const &edges) {
+    return !edges[YGEdgeLeft].isUndefined() ||
+        !edges[YGEdgeRight].isUndefined();
+  };
+
+  return hasLeftOrRight(yogaStyle.position()) ||
+      hasLeftOrRight(yogaStyle.padding()) ||
+      hasLeftOrRight(yogaStyle.margin()) || hasLeftOrRight(yogaStyle.border());
+}
+
+void YogaLayoutableShadowNode::swapLeftAndRightInYogaStyle(
+    YGStyle &yogaStyle) {
   YGStyle::Edges const &position = yogaStyle.position();
   YGStyle::Edges const &padding = yogaStyle.padding();
   YGStyle::Edges const &margin = yogaStyle.margin();
+  YGStyle::Edges const &border = yogaStyle.border();
 
-  // Swap Yoga node values, position, padding and margin.
+  // Swap Yoga style values, position, padding, margin and border.
 
   if (yogaStyle.position()[YGEdgeLeft] != YGValueUndefined) {
     yogaStyle.position()[YGEdgeStart] = position[YGEdgeLeft];
@@ -587,14 +991,32 @@ void YogaLayoutableShadowNode::swapLeftAndRightInYogaStyleProps(
     yogaStyle.margin()[YGEdgeRight] = YGValueUndefined;
   }
 
-  shadowNode.yogaNode_.setStyle(yogaStyle);
+  if (yogaStyle.border()[YGEdgeLeft] != YGValueUndefined) {
+    yogaStyle.border()[YGEdgeStart] = border[YGEdgeLeft];
+    yogaStyle.border()[YGEdgeLeft] = YGValueUndefined;
+  }
+
+  if (yogaStyle.border()[YGEdgeRight] != YGValueUndefined) {
+    yogaStyle.border()[YGEdgeEnd] = border[YGEdgeRight];
+    yogaStyle.border()[YGEdgeRight] = YGValueUndefined;
+  }
 }
 
-void YogaLayoutableShadowNode::swapLeftAndRightInViewProps(
-    YogaLayoutableShadowNode const &shadowNode) {
-  auto &typedCasting = static_cast<ViewProps const &>(*shadowNode.props_);
-  auto &props = const_cast<ViewProps &>(typedCasting);
+bool YogaLayoutableShadowNode::hasLeftOrRightValues(ViewProps const &props) {
+  auto const &border = props.yogaStyle.border();
+
+  return props.borderRadii.topLeft.hasValue() ||
+      props.borderRadii.bottomLeft.hasValue() ||
+      props.borderRadii.topRight.hasValue() ||
+      props.borderRadii.bottomRight.hasValue() ||
+      props.borderColors.left.hasValue() ||
+      props.borderColors.right.hasValue() ||
+      props.borderStyles.left.hasValue() ||
+      props.borderStyles.right.hasValue() ||
+      !border[YGEdgeLeft].isUndefined() || !border[YGEdgeRight].isUndefined();
+}
 
+void YogaLayoutableShadowNode::swapLeftAndRightInViewProps(ViewProps &props) {
   // Swap border node values, borderRadii, borderColors and borderStyles.
   if (props.borderRadii.topLeft.hasValue()) {
     props.borderRadii.topStart = props.borderRadii.topLeft;
@@ -659,15 +1081,11 @@ void YogaLayoutableShadowNode::ensureConsistency() const {
 
 void YogaLayoutableShadowNode::ensureYogaChildrenOwnersConsistency() const {
 #ifndef NDEBUG
-  // Checking that all Yoga node children have the same `owner`.
-  // The owner might be not equal to the `yogaNode_` though.
-  auto &yogaChildren = yogaNode_.getChildren();
-
-  if (!yogaChildren.empty()) {
-    auto owner = yogaChildren.at(0)->getOwner();
-    for (auto const &child : yogaChildren) {
-      assert(child->getOwner() == owner);
-    }
+  // Checking that all Yoga node children have an `owner`.
+  // The owner might be not equal to the `yogaNode_` though, and might differ
+  // between children which are shared with other nodes (see `adoptYogaChild`).
+  for (auto const &child : yogaNode_.getChildren()) {
+    assert(child->getOwner() != nullptr);
   }
 #endif
 }
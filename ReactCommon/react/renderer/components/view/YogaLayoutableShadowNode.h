@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 
+#include <better/optional.h>
 #include <yoga/YGNode.h>
 
 #include <react/renderer/components/view/YogaStylableProps.h>
@@ -22,6 +23,8 @@
 namespace facebook {
 namespace react {
 
+class ViewProps;
+
 class YogaLayoutableShadowNode : public LayoutableShadowNode {
  public:
   using UnsharedList = better::small_vector<
@@ -53,14 +56,18 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
 
   void updateYogaChildren();
 
-  void updateYogaProps();
+  /*
+   * Sets the Yoga style of the props to the Yoga node. `sourceYogaStyle` is
+   * the Yoga style of the props of the node this one is cloned from, if any.
+   */
+  void updateYogaProps(YGStyle const *sourceYogaStyle = nullptr);
 
   /*
    * Sets layoutable size of node.
    */
   void setSize(Size size) const;
 
-  void setPadding(RectangleEdges<Float> padding) const;
+  void setPadding(RectangleEdges<Float> padding);
 
   /*
    * Sets position type of Yoga node (relative, absolute).
@@ -83,6 +90,19 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
 
   void layout(LayoutContext layoutContext) override;
 
+#pragma mark - Layout Snapshots
+
+  /*
+   * Returns a value which stays the same as long as `measureContent` returns
+   * the same results for the same layout constraints, even in another tree
+   * (where tags are different). Layout snapshots restore measurements of the
+   * node only if the value did not change, see `YogaLayoutSnapshot`.
+   * Default implementation returns nothing, so measurements are never
+   * restored.
+   */
+  virtual better::optional<size_t> getMeasuredContentKey(
+      LayoutContext const &layoutContext) const;
+
  protected:
   /*
    * Yoga config associated (only) with this particular node.
@@ -97,6 +117,8 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
   mutable YGNode yogaNode_;
 
  private:
+  friend class YogaLayoutSnapshot;
+
   /*
    * Goes over `yogaNode_.getChildren()` and in case child's owner is
    * equal to address of `yogaNode_`, it sets child's owner address
@@ -123,9 +145,35 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
   /*
    * Makes the child node with a given `index` (and Yoga node associated with) a
    * valid child node satisfied requirements of the Concurrent Layout approach.
+   * A child owned by some other node stays shared; Yoga copies its Yoga node
+   * once it needs to write layout results into it.
    */
   void adoptYogaChild(size_t index);
 
+  /*
+   * Replaces copies of Yoga nodes made by Yoga during the current layout pass
+   * (see `yogaNodeCloneCallbackConnector`) in the subtree of owned nodes.
+   * A shared child is cloned only if its copy got layout results the child
+   * does not have yet, otherwise the copy is dropped and the child stays
+   * shared.
+   */
+  void adoptLaidOutYogaChildren(LayoutContext const &layoutContext);
+  YogaLayoutableShadowNode &adoptLaidOutYogaChild(
+      size_t index,
+      YGNode &yogaNodeCopy,
+      LayoutContext const &layoutContext);
+  static bool hasNewLayoutResults(
+      YGNode const &yogaNodeCopy,
+      Float pointScaleFactor);
+
+  /*
+   * Adds nodes of the subtree of a copy which stays shared to `affectedNodes`
+   * if Yoga laid them out again during the current layout pass.
+   */
+  static void collectSharedNodesLaidOutAgain(
+      YGNode const &yogaNodeCopy,
+      std::vector<LayoutableShadowNode const *> &affectedNodes);
+
   static YGConfig &initializeYogaConfig(YGConfig &config);
   static YGNode *yogaNodeCloneCallbackConnector(
       YGNode *oldYogaNode,
@@ -137,6 +185,10 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
       YGMeasureMode widthMode,
       float height,
       YGMeasureMode heightMode);
+  static void yogaNodeMeasureBatchCallbackConnector(
+      YGMeasureRequest *requests,
+      size_t count,
+      void *layoutContext);
 
 #pragma mark - RTL Legacy Autoflip
 
@@ -151,26 +203,54 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
    * - border(Left|Right)Color → border(Start|End)Color
    * This is neccesarry to be backwards compatible with Paper, it swaps the
    * values as well in https://fburl.com/diffusion/kl7bjr3h
+   * Subtrees which were swapped already (see `isLeftAndRightSwapped_`) are
+   * skipped; not owned children which were not are cloned first.
+   * Returns `true` if the Yoga style of some node in the subtree changed.
+   */
+  bool swapLeftAndRightInTree();
+  /*
+   * Swaps the values of this node: the view props values (and border widths)
+   * in a copy of the props, which might be shared with other nodes, and the
+   * layout values in the Yoga style of the Yoga node only, so props derived
+   * from the props of this node keep their original layout values.
+   * Returns `true` if the Yoga style changed.
    */
-  static void swapLeftAndRightInTree(
-      YogaLayoutableShadowNode const &shadowNode);
+  bool swapLeftAndRightInProps();
+  YogaLayoutableShadowNode &cloneYogaChild(size_t index);
   /*
-   * In shadow node passed as argument, reassigns following values
+   * Reassigns following values
    * - borderTop(Left|Right)Radius → borderTop(Start|End)Radius
    * - borderBottom(Left|Right)Radius → borderBottom(Start|End)Radius
    * - border(Left|Right)Width → border(Start|End)Width
    * - border(Left|Right)Color → border(Start|End)Color
+   * - border(Left|Right)Style → border(Start|End)Style
    */
-  static void swapLeftAndRightInViewProps(
-      YogaLayoutableShadowNode const &shadowNode);
+  static bool hasLeftOrRightValues(ViewProps const &props);
+  static void swapLeftAndRightInViewProps(ViewProps &props);
   /*
-   * In yoga node passed as argument, reassigns following values
+   * Reassigns following values
    * - (left|right) → (start|end)
    * - margin(Left|Right) → margin(Start|End)
    * - padding(Left|Right) → padding(Start|End)
+   * - border(Left|Right)Width → border(Start|End)Width
+   */
+  static bool hasLeftOrRightValues(YGStyle const &yogaStyle);
+  static void swapLeftAndRightInYogaStyle(YGStyle &yogaStyle);
+
+  /*
+   * Whether the values of this node and of all its descendants were swapped
+   * already. Set only while the node is unsealed, clones keep it unless they
+   * get new props or children.
+   */
+  bool isLeftAndRightSwapped_{false};
+
+  /*
+   * The union of the frames of the displayed children, each including the
+   * content overflowing it, which the overflow inset of this node is computed
+   * from. Computed again only if the frame of some child changed.
    */
-  static void swapLeftAndRightInYogaStyleProps(
-      YogaLayoutableShadowNode const &shadowNode);
+  Rect contentFrame_{};
+  bool isContentFrameValid_{false};
 
 #pragma mark - Consistency Ensuring Helpers
 
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+char const IncrementalLayoutTestTextComponentName[] =
+    "IncrementalLayoutTestText";
+
+/*
+ * The text is `nativeId`: characters of 10 × 20 points which wrap at the
+ * available width. The height is not limited by the available height.
+ */
+class TextShadowNode final
+    : public ConcreteViewShadowNode<IncrementalLayoutTestTextComponentName> {
+ public:
+  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  static ShadowNodeTraits BaseTraits() {
+    auto traits = ConcreteViewShadowNode::BaseTraits();
+    traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
+    return traits;
+  }
+
+  Size measureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const override {
+    auto textWidth = Float(getConcreteProps().nativeId.size() * 10);
+    auto width = std::min(textWidth, layoutConstraints.maximumSize.width);
+    auto lines = std::ceil(textWidth / std::max(width, Float{10}));
+    return {width, lines * 20};
+  }
+};
+
+class TextComponentDescriptor final
+    : public ConcreteComponentDescriptor<TextShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(UnsharedShadowNode shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+    auto &textShadowNode = static_cast<TextShadowNode &>(*shadowNode);
+    textShadowNode.enableMeasurement();
+    textShadowNode.dirtyLayout();
+  }
+};
+
+// Root: {200, auto}
+//  └─ List: column
+//      ├─ 3 × Row: row, padding: 5
+//      │   ├─ Icon: {20, 20}, margin-left: -10 (overflows the row)
+//      │   └─ Text: flex-shrink: 1
+//      └─ Row: row, height: 20, align-items: flex-start
+//          └─ Text: flex-shrink: 1 (overflows the row if it wraps)
+//
+// The same tree is laid out with and without incremental layout, and every
+// change is applied to both.
+class IncrementalLayoutTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumberOfTexts = 4;
+
+  struct Tree {
+    std::shared_ptr<RootShadowNode> rootShadowNode;
+    std::vector<std::shared_ptr<TextShadowNode>> textShadowNodes;
+  };
+
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_;
+  ComponentDescriptorRegistry::Shared componentDescriptorRegistry_;
+  Tree fullLayoutTree_;
+  Tree incrementalLayoutTree_;
+
+  IncrementalLayoutTest()
+      : componentDescriptorRegistry_(
+            componentDescriptorProviderRegistry_
+                .createComponentDescriptorRegistry(
+                    ComponentDescriptorParameters{
+                        EventDispatcher::Shared{}, nullptr, nullptr})) {
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<TextComponentDescriptor>());
+
+    fullLayoutTree_ = buildTree(false);
+    incrementalLayoutTree_ = buildTree(true);
+  }
+
+  Tree buildTree(bool incrementalLayout) {
+    auto tree = Tree{};
+    tree.textShadowNodes.resize(kNumberOfTexts);
+
+    auto rows = std::vector<ElementFragment>{};
+    for (int i = 0; i < kNumberOfTexts - 1; i++) {
+      // clang-format off
+      rows.push_back(
+          Element<ViewShadowNode>()
+            .tag(10 * i + 10)
+            .props([] {
+              auto sharedProps = std::make_shared<ViewProps>();
+              auto &yogaStyle = sharedProps->yogaStyle;
+              yogaStyle.flexDirection() = YGFlexDirectionRow;
+              yogaStyle.padding()[YGEdgeAll] = YGValue{5, YGUnitPoint};
+              return sharedProps;
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .tag(10 * i + 11)
+                .props([] {
+                  auto sharedProps = std::make_shared<ViewProps>();
+                  auto &yogaStyle = sharedProps->yogaStyle;
+                  yogaStyle.dimensions()[YGDimensionWidth] = YGValue{20, YGUnitPoint};
+                  yogaStyle.dimensions()[YGDimensionHeight] = YGValue{20, YGUnitPoint};
+                  yogaStyle.margin()[YGEdgeLeft] = YGValue{-10, YGUnitPoint};
+                  return sharedProps;
+                }),
+              Element<TextShadowNode>()
+                .tag(10 * i + 12)
+                .reference(tree.textShadowNodes[i])
+                .props([] { return textProps(5); })
+            }));
+      // clang-format on
+    }
+
+    // clang-format off
+    rows.push_back(
+        Element<ViewShadowNode>()
+          .tag(100)
+          .props([] {
+            auto sharedProps = std::make_shared<ViewProps>();
+            auto &yogaStyle = sharedProps->yogaStyle;
+            yogaStyle.flexDirection() = YGFlexDirectionRow;
+            yogaStyle.dimensions()[YGDimensionHeight] = YGValue{20, YGUnitPoint};
+            yogaStyle.alignItems() = YGAlignFlexStart;
+            return sharedProps;
+          })
+          .children({
+            Element<TextShadowNode>()
+              .tag(101)
+              .reference(tree.textShadowNodes[kNumberOfTexts - 1])
+              .props([] { return textProps(5); })
+          }));
+
+    auto element =
+        Element<RootShadowNode>()
+          .reference(tree.rootShadowNode)
+          .tag(1)
+          .props([=] {
+            auto sharedProps = std::make_shared<RootProps>();
+            sharedProps->layoutConstraints = LayoutConstraints{{200, 0}, {200, 1000}};
+            sharedProps->layoutContext.incrementalLayout = incrementalLayout;
+            return sharedProps;
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .tag(2)
+              .children(rows)
+          });
+    // clang-format on
+
+    ComponentBuilder{componentDescriptorRegistry_}.build(element);
+
+    tree.rootShadowNode->layoutIfNeeded();
+    tree.rootShadowNode->sealRecursive();
+    return tree;
+  }
+
+  static std::shared_ptr<ViewProps> textProps(size_t length) {
+    auto sharedProps = std::make_shared<ViewProps>();
+    sharedProps->yogaStyle.flexShrink() = YGFloatOptional{1};
+    sharedProps->nativeId = std::string(length, 'x');
+    return sharedProps;
+  }
+
+  // Commits a new tree where the text with a given index has a given length.
+  static void setTextLength(Tree &tree, int index, size_t length) {
+    auto const &textShadowNode = *tree.textShadowNodes.at(index);
+    auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        tree.rootShadowNode->cloneTree(
+            textShadowNode.getFamily(), [&](ShadowNode const &oldShadowNode) {
+              return oldShadowNode.clone({textProps(length)});
+            }));
+
+    newRootShadowNode->layoutIfNeeded();
+    newRootShadowNode->sealRecursive();
+    tree.rootShadowNode = newRootShadowNode;
+  }
+
+  void setTextLength(int index, size_t length) {
+    setTextLength(fullLayoutTree_, index, length);
+    setTextLength(incrementalLayoutTree_, index, length);
+  }
+
+  static void expectSameLayout(
+      ShadowNode const &fullLayoutShadowNode,
+      ShadowNode const &incrementalLayoutShadowNode) {
+    auto fullLayoutMetrics =
+        traitCast<LayoutableShadowNode const &>(fullLayoutShadowNode)
+            .getLayoutMetrics();
+    auto incrementalLayoutMetrics =
+        traitCast<LayoutableShadowNode const &>(incrementalLayoutShadowNode)
+            .getLayoutMetrics();
+    EXPECT_EQ(fullLayoutMetrics.frame, incrementalLayoutMetrics.frame)
+        << "Tag: " << fullLayoutShadowNode.getTag();
+    EXPECT_EQ(
+        fullLayoutMetrics.overflowInset, incrementalLayoutMetrics.overflowInset)
+        << "Tag: " << fullLayoutShadowNode.getTag();
+
+    auto &fullLayoutChildren = fullLayoutShadowNode.getChildren();
+    auto &incrementalLayoutChildren = incrementalLayoutShadowNode.getChildren();
+    ASSERT_EQ(fullLayoutChildren.size(), incrementalLayoutChildren.size());
+    for (size_t i = 0; i < fullLayoutChildren.size(); i++) {
+      expectSameLayout(
+          *fullLayoutChildren.at(i), *incrementalLayoutChildren.at(i));
+    }
+  }
+
+  void expectSameLayout() const {
+    expectSameLayout(
+        *fullLayoutTree_.rootShadowNode,
+        *incrementalLayoutTree_.rootShadowNode);
+  }
+
+  Rect getTextFrame(int index) const {
+    auto &listShadowNode =
+        *incrementalLayoutTree_.rootShadowNode->getChildren().at(0);
+    auto &rows = listShadowNode.getChildren();
+    return traitCast<LayoutableShadowNode const &>(
+               *rows.at(index)->getChildren().back())
+        .getLayoutMetrics()
+        .frame;
+  }
+};
+
+TEST_F(IncrementalLayoutTest, textKeepingItsHeight) {
+  setTextLength(1, 8);
+
+  EXPECT_EQ(getTextFrame(1).size.width, 80);
+  expectSameLayout();
+}
+
+TEST_F(IncrementalLayoutTest, textWrappingToMoreLines) {
+  setTextLength(0, 30);
+
+  EXPECT_EQ(getTextFrame(0).size.height, 40);
+  expectSameLayout();
+
+  setTextLength(0, 5);
+
+  EXPECT_EQ(getTextFrame(0).size.height, 20);
+  expectSameLayout();
+}
+
+TEST_F(IncrementalLayoutTest, textOverflowingItsRow) {
+  setTextLength(kNumberOfTexts - 1, 30);
+
+  EXPECT_EQ(getTextFrame(kNumberOfTexts - 1).size.height, 40);
+  expectSameLayout();
+
+  setTextLength(kNumberOfTexts - 1, 10);
+
+  EXPECT_EQ(getTextFrame(kNumberOfTexts - 1).size.height, 20);
+  expectSameLayout();
+}
+
+TEST_F(IncrementalLayoutTest, sequenceOfChanges) {
+  auto lengths = std::vector<size_t>{3, 25, 0, 19, 40, 18, 2, 60, 17, 1};
+  for (size_t i = 0; i < lengths.size(); i++) {
+    setTextLength(int(i * 3 % kNumberOfTexts), lengths[i]);
+    expectSameLayout();
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook {
+namespace react {
+
+// Root
+//  └─ Container: {200, auto}, column, align-items: flex-start
+//      └─ 5 × Item: {100, 10}
+class LayoutSharingTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumberOfItems = 5;
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> containerShadowNode_;
+
+  LayoutSharingTest() : builder_(simpleComponentBuilder()) {
+    auto items = std::vector<ElementFragment>{};
+    for (int i = 0; i < kNumberOfItems; i++) {
+      items.push_back(Element<ViewShadowNode>().tag(3 + i).props([] {
+        return itemProps(10);
+      }));
+    }
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .tag(1)
+          .props([] {
+            auto sharedProps = std::make_shared<RootProps>();
+            sharedProps->layoutConstraints = LayoutConstraints{{0, 0}, {500, 500}};
+            return sharedProps;
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .reference(containerShadowNode_)
+              .tag(2)
+              .props([] {
+                auto sharedProps = std::make_shared<ViewProps>();
+                auto &yogaStyle = sharedProps->yogaStyle;
+                yogaStyle.dimensions()[YGDimensionWidth] = YGValue{200, YGUnitPoint};
+                yogaStyle.alignItems() = YGAlignFlexStart;
+                return sharedProps;
+              })
+              .children(items)
+          });
+    // clang-format on
+
+    builder_.build(element);
+
+    rootShadowNode_->layoutIfNeeded();
+    rootShadowNode_->sealRecursive();
+  }
+
+  static std::shared_ptr<ViewProps> itemProps(Float height) {
+    auto sharedProps = std::make_shared<ViewProps>();
+    auto &yogaStyle = sharedProps->yogaStyle;
+    yogaStyle.dimensions()[YGDimensionWidth] = YGValue{100, YGUnitPoint};
+    yogaStyle.dimensions()[YGDimensionHeight] = YGValue{height, YGUnitPoint};
+    return sharedProps;
+  }
+
+  // Commits a new tree where the item with a given index has a given height.
+  std::shared_ptr<RootShadowNode> setItemHeight(
+      int index,
+      Float height,
+      std::vector<LayoutableShadowNode const *> *affectedNodes = {}) {
+    auto const &item = *containerShadowNode_->getChildren().at(index);
+    auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        rootShadowNode_->cloneTree(
+            item.getFamily(), [&](ShadowNode const &oldShadowNode) {
+              return oldShadowNode.clone({itemProps(height)});
+            }));
+
+    newRootShadowNode->layoutIfNeeded(affectedNodes);
+    newRootShadowNode->sealRecursive();
+    return newRootShadowNode;
+  }
+
+  static ShadowNode::ListOfShared const &getItems(
+      ShadowNode const &rootShadowNode) {
+    return rootShadowNode.getChildren().at(0)->getChildren();
+  }
+
+  static Rect getFrame(ShadowNode const &shadowNode) {
+    return traitCast<LayoutableShadowNode const &>(shadowNode)
+        .getLayoutMetrics()
+        .frame;
+  }
+};
+
+TEST_F(LayoutSharingTest, itemsWithUnchangedLayoutAreShared) {
+  auto newRootShadowNode = setItemHeight(kNumberOfItems - 1, 20);
+
+  auto &oldItems = containerShadowNode_->getChildren();
+  auto &newItems = getItems(*newRootShadowNode);
+
+  for (int i = 0; i < kNumberOfItems - 1; i++) {
+    EXPECT_EQ(oldItems.at(i), newItems.at(i));
+  }
+
+  EXPECT_EQ(getFrame(*newItems.at(kNumberOfItems - 1)).origin.y, 40);
+  EXPECT_EQ(getFrame(*newItems.at(kNumberOfItems - 1)).size.height, 20);
+  EXPECT_EQ(getFrame(*newRootShadowNode->getChildren().at(0)).size.height, 60);
+}
+
+TEST_F(LayoutSharingTest, sharedItemsLaidOutAgainAreAffected) {
+  auto affectedNodes = std::vector<LayoutableShadowNode const *>{};
+  auto newRootShadowNode =
+      setItemHeight(kNumberOfItems - 1, 20, &affectedNodes);
+
+  // Items keep getting onLayout events when the container is laid out again,
+  // whether they stay shared or not.
+  auto &newItems = getItems(*newRootShadowNode);
+  for (auto const &item : newItems) {
+    EXPECT_EQ(
+        std::count(affectedNodes.begin(), affectedNodes.end(), item.get()), 1);
+  }
+  EXPECT_EQ(affectedNodes.size(), kNumberOfItems + 1);
+}
+
+TEST_F(LayoutSharingTest, itemsWithChangedLayoutAreCloned) {
+  auto newRootShadowNode = setItemHeight(0, 20);
+
+  auto &oldItems = containerShadowNode_->getChildren();
+  auto &newItems = getItems(*newRootShadowNode);
+
+  for (int i = 1; i < kNumberOfItems; i++) {
+    EXPECT_NE(oldItems.at(i), newItems.at(i));
+    EXPECT_EQ(oldItems.at(i)->getTag(), newItems.at(i)->getTag());
+    EXPECT_EQ(getFrame(*oldItems.at(i)).origin.y, 10 * i);
+    EXPECT_EQ(getFrame(*newItems.at(i)).origin.y, 10 * i + 10);
+  }
+
+  EXPECT_EQ(getFrame(*newRootShadowNode->getChildren().at(0)).size.height, 60);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/components/view/YogaLayoutSnapshot.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+char const LayoutSnapshotTestTextComponentName[] = "LayoutSnapshotTestText";
+
+static int measureContentCallCount = 0;
+
+/*
+ * The text is `nativeId`: characters of 10 × 20 points which wrap at the
+ * available width. The text is also the content key of the node.
+ */
+class SnapshotTextShadowNode final
+    : public ConcreteViewShadowNode<LayoutSnapshotTestTextComponentName> {
+ public:
+  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  static ShadowNodeTraits BaseTraits() {
+    auto traits = ConcreteViewShadowNode::BaseTraits();
+    traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
+    return traits;
+  }
+
+  Size measureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const override {
+    measureContentCallCount++;
+    auto textWidth = Float(getConcreteProps().nativeId.size() * 10);
+    auto width = std::min(textWidth, layoutConstraints.maximumSize.width);
+    auto lines = std::ceil(textWidth / std::max(width, Float{10}));
+    return {width, lines * 20};
+  }
+
+  better::optional<size_t> getMeasuredContentKey(
+      LayoutContext const &layoutContext) const override {
+    return std::hash<std::string>{}(getConcreteProps().nativeId);
+  }
+};
+
+class SnapshotTextComponentDescriptor final
+    : public ConcreteComponentDescriptor<SnapshotTextShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(UnsharedShadowNode shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+    auto &textShadowNode = static_cast<SnapshotTextShadowNode &>(*shadowNode);
+    textShadowNode.enableMeasurement();
+    textShadowNode.dirtyLayout();
+  }
+};
+
+// Root: {200, auto}
+//  └─ List: column
+//      └─ 3 × Row: row, padding: 5
+//          ├─ Icon: {20, 20}
+//          └─ Text: flex-shrink: 1
+//
+// The snapshot of a laid out tree is restored onto a tree built again with
+// different tags, which is compared with the same tree laid out from scratch.
+class LayoutSnapshotTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumberOfRows = 3;
+
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_;
+  ComponentDescriptorRegistry::Shared componentDescriptorRegistry_;
+  YogaLayoutSnapshot layoutSnapshot_;
+
+  LayoutSnapshotTest()
+      : componentDescriptorRegistry_(
+            componentDescriptorProviderRegistry_
+                .createComponentDescriptorRegistry(
+                    ComponentDescriptorParameters{
+                        EventDispatcher::Shared{}, nullptr, nullptr})) {
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<SnapshotTextComponentDescriptor>());
+
+    auto rootShadowNode = buildTree(0, 200, {5, 30, 12});
+    rootShadowNode->layoutIfNeeded();
+    auto const &props = rootShadowNode->getConcreteProps();
+    layoutSnapshot_ = YogaLayoutSnapshot::take(
+        *rootShadowNode, props.layoutConstraints, props.layoutContext);
+  }
+
+  // Builds a tree which is not laid out yet.
+  std::shared_ptr<RootShadowNode> buildTree(
+      Tag tagOffset,
+      Float width,
+      std::vector<size_t> const &textLengths) {
+    auto rows = std::vector<ElementFragment>{};
+    for (int i = 0; i < kNumberOfRows; i++) {
+      auto textLength = textLengths.at(i);
+      // clang-format off
+      rows.push_back(
+          Element<ViewShadowNode>()
+            .tag(tagOffset + 10 * i + 10)
+            .props([] {
+              auto sharedProps = std::make_shared<ViewProps>();
+              auto &yogaStyle = sharedProps->yogaStyle;
+              yogaStyle.flexDirection() = YGFlexDirectionRow;
+              yogaStyle.padding()[YGEdgeAll] = YGValue{5, YGUnitPoint};
+              return sharedProps;
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .tag(tagOffset + 10 * i + 11)
+                .props([] {
+                  auto sharedProps = std::make_shared<ViewProps>();
+                  auto &yogaStyle = sharedProps->yogaStyle;
+                  yogaStyle.dimensions()[YGDimensionWidth] = YGValue{20, YGUnitPoint};
+                  yogaStyle.dimensions()[YGDimensionHeight] = YGValue{20, YGUnitPoint};
+                  return sharedProps;
+                }),
+              Element<SnapshotTextShadowNode>()
+                .tag(tagOffset + 10 * i + 12)
+                .props([=] {
+                  auto sharedProps = std::make_shared<ViewProps>();
+                  sharedProps->yogaStyle.flexShrink() = YGFloatOptional{1};
+                  sharedProps->nativeId = std::string(textLength, 'x');
+                  return sharedProps;
+                })
+            }));
+      // clang-format on
+    }
+
+    auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode)
+          .tag(tagOffset + 1)
+          .props([=] {
+            auto sharedProps = std::make_shared<RootProps>();
+            sharedProps->layoutConstraints = LayoutConstraints{{width, 0}, {width, 1000}};
+            return sharedProps;
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .tag(tagOffset + 2)
+              .children(rows)
+          });
+    // clang-format on
+
+    ComponentBuilder{componentDescriptorRegistry_}.build(element);
+    return rootShadowNode;
+  }
+
+  // Restores the snapshot onto a tree and lays it out; returns the number of
+  // restored nodes.
+  size_t restoreAndLayout(RootShadowNode &rootShadowNode) const {
+    auto const &props = rootShadowNode.getConcreteProps();
+    auto restoredNodeCount = layoutSnapshot_.restore(
+        rootShadowNode, props.layoutConstraints, props.layoutContext);
+    rootShadowNode.layoutIfNeeded();
+    return restoredNodeCount;
+  }
+
+  static void expectSameLayout(
+      ShadowNode const &fullLayoutShadowNode,
+      ShadowNode const &restoredLayoutShadowNode) {
+    auto fullLayoutMetrics =
+        traitCast<LayoutableShadowNode const &>(fullLayoutShadowNode)
+            .getLayoutMetrics();
+    auto restoredLayoutMetrics =
+        traitCast<LayoutableShadowNode const &>(restoredLayoutShadowNode)
+            .getLayoutMetrics();
+    EXPECT_EQ(fullLayoutMetrics.frame, restoredLayoutMetrics.frame)
+        << "Tag: " << restoredLayoutShadowNode.getTag();
+    EXPECT_EQ(
+        fullLayoutMetrics.overflowInset, restoredLayoutMetrics.overflowInset)
+        << "Tag: " << restoredLayoutShadowNode.getTag();
+
+    auto &fullLayoutChildren = fullLayoutShadowNode.getChildren();
+    auto &restoredLayoutChildren = restoredLayoutShadowNode.getChildren();
+    ASSERT_EQ(fullLayoutChildren.size(), restoredLayoutChildren.size());
+    for (size_t i = 0; i < fullLayoutChildren.size(); i++) {
+      expectSameLayout(
+          *fullLayoutChildren.at(i), *restoredLayoutChildren.at(i));
+    }
+  }
+
+  void expectSameLayoutAsFullLayout(
+      RootShadowNode const &restoredRootShadowNode,
+      Float width,
+      std::vector<size_t> const &textLengths) {
+    auto fullLayoutRootShadowNode = buildTree(1000, width, textLengths);
+    fullLayoutRootShadowNode->layoutIfNeeded();
+    expectSameLayout(*fullLayoutRootShadowNode, restoredRootShadowNode);
+  }
+};
+
+TEST_F(LayoutSnapshotTest, serialization) {
+  EXPECT_FALSE(layoutSnapshot_.getData().empty());
+
+  layoutSnapshot_ = YogaLayoutSnapshot{layoutSnapshot_.getData()};
+  auto rootShadowNode = buildTree(100, 200, {5, 30, 12});
+
+  EXPECT_GT(restoreAndLayout(*rootShadowNode), 0);
+}
+
+TEST_F(LayoutSnapshotTest, identicalTree) {
+  auto rootShadowNode = buildTree(100, 200, {5, 30, 12});
+
+  measureContentCallCount = 0;
+  // The list and the rows with their children: everything but the root.
+  EXPECT_EQ(restoreAndLayout(*rootShadowNode), 1 + 3 * kNumberOfRows);
+  EXPECT_EQ(measureContentCallCount, 0);
+
+  expectSameLayoutAsFullLayout(*rootShadowNode, 200, {5, 30, 12});
+}
+
+TEST_F(LayoutSnapshotTest, changedText) {
+  auto rootShadowNode = buildTree(100, 200, {5, 4, 12});
+
+  measureContentCallCount = 0;
+  // The text, its row and the list are laid out again.
+  EXPECT_EQ(restoreAndLayout(*rootShadowNode), 3 * kNumberOfRows - 2);
+  EXPECT_GT(measureContentCallCount, 0);
+
+  expectSameLayoutAsFullLayout(*rootShadowNode, 200, {5, 4, 12});
+}
+
+TEST_F(LayoutSnapshotTest, differentLayoutConstraints) {
+  auto rootShadowNode = buildTree(100, 300, {5, 30, 12});
+
+  EXPECT_EQ(restoreAndLayout(*rootShadowNode), 0);
+
+  expectSameLayoutAsFullLayout(*rootShadowNode, 300, {5, 30, 12});
+}
+
+TEST_F(LayoutSnapshotTest, corruptedData) {
+  auto data = layoutSnapshot_.getData();
+  data.resize(data.size() / 2);
+  layoutSnapshot_ = YogaLayoutSnapshot{data};
+  auto rootShadowNode = buildTree(100, 200, {5, 30, 12});
+
+  restoreAndLayout(*rootShadowNode);
+
+  expectSameLayoutAsFullLayout(*rootShadowNode, 200, {5, 30, 12});
+}
+
+} // namespace react
+} // namespace facebook
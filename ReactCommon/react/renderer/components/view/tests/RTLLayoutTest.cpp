@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+
+namespace facebook {
+namespace react {
+
+// Root: {100, 100}, right-to-left, with `swapLeftAndRightInRTL`
+//  └─ View: {20, 20}, margin-left: 10, border-left: 2 (black)
+class RTLLayoutTest : public ::testing::Test {
+ protected:
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_;
+  ComponentDescriptorRegistry::Shared componentDescriptorRegistry_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> viewShadowNode_;
+  std::shared_ptr<ViewProps const> viewProps_;
+
+  RTLLayoutTest()
+      : componentDescriptorRegistry_(
+            componentDescriptorProviderRegistry_
+                .createComponentDescriptorRegistry(
+                    ComponentDescriptorParameters{
+                        EventDispatcher::Shared{}, nullptr, nullptr})) {
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    rootShadowNode_ = build(true, viewShadowNode_, viewProps_);
+  }
+
+  std::shared_ptr<RootShadowNode> build(
+      bool swapLeftAndRightInRTL,
+      std::shared_ptr<ViewShadowNode> &viewShadowNode,
+      std::shared_ptr<ViewProps const> &viewProps) {
+    auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode)
+          .tag(1)
+          .props([=] {
+            auto sharedProps = std::make_shared<RootProps>();
+            auto &layoutConstraints = sharedProps->layoutConstraints;
+            layoutConstraints = LayoutConstraints{{100, 100}, {100, 100}};
+            layoutConstraints.layoutDirection = LayoutDirection::RightToLeft;
+            sharedProps->layoutContext.swapLeftAndRightInRTL =
+                swapLeftAndRightInRTL;
+            return sharedProps;
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .reference(viewShadowNode)
+              .tag(2)
+              .props([&] {
+                auto sharedProps = std::make_shared<ViewProps>();
+                auto &yogaStyle = sharedProps->yogaStyle;
+                yogaStyle.dimensions()[YGDimensionWidth] = YGValue{20, YGUnitPoint};
+                yogaStyle.dimensions()[YGDimensionHeight] = YGValue{20, YGUnitPoint};
+                yogaStyle.margin()[YGEdgeLeft] = YGValue{10, YGUnitPoint};
+                yogaStyle.border()[YGEdgeLeft] = YGValue{2, YGUnitPoint};
+                sharedProps->borderColors.left = colorFromComponents({0, 0, 0, 1});
+                viewProps = sharedProps;
+                return sharedProps;
+              })
+          });
+    // clang-format on
+
+    ComponentBuilder{componentDescriptorRegistry_}.build(element);
+    rootShadowNode->layoutIfNeeded();
+    rootShadowNode->sealRecursive();
+    return rootShadowNode;
+  }
+
+  static LayoutableShadowNode const &getView(ShadowNode const &rootShadowNode) {
+    return traitCast<LayoutableShadowNode const &>(
+        *rootShadowNode.getChildren().at(0));
+  }
+};
+
+TEST_F(RTLLayoutTest, leftValuesAreLaidOutAsStartValues) {
+  auto layoutMetrics = getView(*rootShadowNode_).getLayoutMetrics();
+
+  EXPECT_EQ(layoutMetrics.frame.origin.x, 70);
+  EXPECT_EQ(layoutMetrics.borderWidth.right, 2);
+  EXPECT_EQ(layoutMetrics.borderWidth.left, 0);
+}
+
+TEST_F(RTLLayoutTest, layoutValuesOfPropsAreNotSwapped) {
+  auto const &yogaStyle = viewShadowNode_->getConcreteProps().yogaStyle;
+
+  EXPECT_EQ(
+      YGValue(yogaStyle.margin()[YGEdgeLeft]), (YGValue{10, YGUnitPoint}));
+  EXPECT_TRUE(yogaStyle.margin()[YGEdgeStart].isUndefined());
+}
+
+TEST_F(RTLLayoutTest, viewValuesAreSwappedInCopyOfProps) {
+  auto const &props = viewShadowNode_->getConcreteProps();
+
+  EXPECT_NE(&props, viewProps_.get());
+  EXPECT_TRUE(props.borderColors.start.hasValue());
+  EXPECT_FALSE(props.borderColors.left.hasValue());
+  EXPECT_EQ(
+      YGValue(props.yogaStyle.border()[YGEdgeStart]), (YGValue{2, YGUnitPoint}));
+
+  // The props the node was created with are left untouched.
+  EXPECT_TRUE(viewProps_->borderColors.left.hasValue());
+  EXPECT_EQ(
+      YGValue(viewProps_->yogaStyle.border()[YGEdgeLeft]),
+      (YGValue{2, YGUnitPoint}));
+}
+
+TEST_F(RTLLayoutTest, swappedSubtreesAreNotSwappedAgain) {
+  auto const &rootProps = rootShadowNode_->getConcreteProps();
+  auto newRootShadowNode =
+      rootShadowNode_->clone(rootProps.layoutConstraints, rootProps.layoutContext);
+
+  newRootShadowNode->layoutIfNeeded();
+
+  EXPECT_EQ(
+      newRootShadowNode->getChildren().at(0),
+      rootShadowNode_->getChildren().at(0));
+  EXPECT_EQ(viewShadowNode_->getProps(), getView(*newRootShadowNode).getProps());
+}
+
+TEST_F(RTLLayoutTest, sharedSubtreesAreClonedToBeSwapped) {
+  auto viewShadowNode = std::shared_ptr<ViewShadowNode>{};
+  auto viewProps = std::shared_ptr<ViewProps const>{};
+  auto rootShadowNode = build(false, viewShadowNode, viewProps);
+  auto layoutContext = rootShadowNode->getConcreteProps().layoutContext;
+  layoutContext.swapLeftAndRightInRTL = true;
+
+  auto newRootShadowNode = rootShadowNode->clone(
+      rootShadowNode->getConcreteProps().layoutConstraints, layoutContext);
+  newRootShadowNode->layoutIfNeeded();
+
+  auto const &newViewShadowNode = getView(*newRootShadowNode);
+  EXPECT_NE(&newViewShadowNode, viewShadowNode.get());
+  EXPECT_EQ(newViewShadowNode.getLayoutMetrics().frame.origin.x, 70);
+  EXPECT_EQ(newViewShadowNode.getLayoutMetrics().borderWidth.right, 2);
+  EXPECT_TRUE(static_cast<ViewProps const &>(*newViewShadowNode.getProps())
+                  .borderColors.start.hasValue());
+
+  // The tree laid out without swapping is left untouched.
+  EXPECT_EQ(viewShadowNode->getProps(), viewProps);
+  EXPECT_EQ(getView(*rootShadowNode).getLayoutMetrics().frame.origin.x, 80);
+  EXPECT_EQ(getView(*rootShadowNode).getLayoutMetrics().borderWidth.left, 2);
+}
+
+TEST_F(RTLLayoutTest, cloneWithEquivalentPropsIsNotDirtied) {
+  // Like props updated from JavaScript, the new props are derived from the
+  // old ones.
+  auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      rootShadowNode_->cloneTree(
+          viewShadowNode_->getFamily(), [](ShadowNode const &oldShadowNode) {
+            auto sharedProps = std::make_shared<ViewProps>(
+                static_cast<ViewProps const &>(*oldShadowNode.getProps()));
+            sharedProps->opacity = 0.5;
+            return oldShadowNode.clone({sharedProps});
+          }));
+
+  EXPECT_TRUE(getView(*newRootShadowNode).getIsLayoutClean());
+
+  newRootShadowNode->layoutIfNeeded();
+
+  EXPECT_EQ(getView(*newRootShadowNode).getLayoutMetrics().frame.origin.x, 70);
+}
+
+TEST_F(RTLLayoutTest, cloneWithChangedPropsIsLaidOutAgain) {
+  auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      rootShadowNode_->cloneTree(
+          viewShadowNode_->getFamily(), [](ShadowNode const &oldShadowNode) {
+            auto sharedProps = std::make_shared<ViewProps>(
+                static_cast<ViewProps const &>(*oldShadowNode.getProps()));
+            sharedProps->yogaStyle.margin()[YGEdgeLeft] =
+                YGValue{30, YGUnitPoint};
+            return oldShadowNode.clone({sharedProps});
+          }));
+
+  EXPECT_FALSE(getView(*newRootShadowNode).getIsLayoutClean());
+
+  newRootShadowNode->layoutIfNeeded();
+
+  EXPECT_EQ(getView(*newRootShadowNode).getLayoutMetrics().frame.origin.x, 50);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/JSCRuntime.h>
+#include <react/renderer/components/scrollview/ScrollViewEventEmitter.h>
+#include <react/renderer/components/view/ViewEventEmitter.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/EventPayload.h>
+#include <memory>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Beats (and therefore flushes event queues) as soon as a beat is requested.
+ */
+class ImmediateEventBeat : public EventBeat {
+ public:
+  ImmediateEventBeat(SharedOwnerBox const &ownerBox, jsi::Runtime &runtime)
+      : EventBeat(ownerBox), runtime_(runtime) {}
+
+  void request() const override {
+    EventBeat::request();
+    beat(runtime_);
+  }
+
+ private:
+  jsi::Runtime &runtime_;
+};
+
+/*
+ * Builds payloads of all dispatched events the way `UIManagerBinding` does,
+ * optionally with cached `PropNameID`s.
+ */
+class EventPayloadBenchmark {
+ public:
+  EventPayloadBenchmark(bool usePropNameCache)
+      : runtime_(jsc::makeJSCRuntime()),
+        eventDispatcher_(std::make_shared<EventDispatcher const>(
+            [this, usePropNameCache](
+                jsi::Runtime &runtime,
+                EventTarget const *eventTarget,
+                EventType const &type,
+                ValueFactory const &payloadFactory) {
+              if (!usePropNameCache) {
+                benchmark::DoNotOptimize(payloadFactory(runtime));
+                return;
+              }
+              EventPayloadPropNames::ThreadLocalScope propNamesScope{
+                  propNames_};
+              benchmark::DoNotOptimize(payloadFactory(runtime));
+            },
+            [](StateUpdate const &stateUpdate) {},
+            eventBeatFactory(),
+            eventBeatFactory(),
+            std::make_shared<EventBeat::OwnerBox>(),
+            true)),
+        eventEmitter_(nullptr, 1, eventDispatcher_) {}
+
+  ScrollViewEventEmitter const &getEventEmitter() const {
+    return eventEmitter_;
+  }
+
+ private:
+  EventBeat::Factory eventBeatFactory() {
+    return [this](EventBeat::SharedOwnerBox const &ownerBox) {
+      return std::make_unique<ImmediateEventBeat>(ownerBox, *runtime_);
+    };
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  EventPayloadPropNames propNames_{};
+  std::shared_ptr<EventDispatcher const> eventDispatcher_;
+  ScrollViewEventEmitter eventEmitter_;
+};
+
+static TouchEvent createTouchEvent(int numberOfTouches) {
+  auto event = TouchEvent{};
+  for (int i = 0; i < numberOfTouches; i++) {
+    auto touch = Touch{};
+    touch.identifier = i;
+    touch.pagePoint = Point{Float(i), Float(i)};
+    event.touches.insert(touch);
+    event.changedTouches.insert(touch);
+    event.targetTouches.insert(touch);
+  }
+  return event;
+}
+
+static void buildingTouchEventPayload(benchmark::State &state) {
+  EventPayloadBenchmark payloadBenchmark(state.range(0));
+  auto event = createTouchEvent(2);
+  for (auto _ : state) {
+    payloadBenchmark.getEventEmitter().onTouchMove(event);
+  }
+}
+BENCHMARK(buildingTouchEventPayload)->Arg(false)->Arg(true);
+
+static void buildingLayoutEventPayload(benchmark::State &state) {
+  EventPayloadBenchmark payloadBenchmark(state.range(0));
+  auto layoutMetrics = LayoutMetrics{};
+  for (auto _ : state) {
+    // Identical layout metrics are not dispatched twice in a row.
+    layoutMetrics.frame.size.width += 1;
+    payloadBenchmark.getEventEmitter().onLayout(layoutMetrics);
+  }
+}
+BENCHMARK(buildingLayoutEventPayload)->Arg(false)->Arg(true);
+
+static void buildingScrollEventPayload(benchmark::State &state) {
+  EventPayloadBenchmark payloadBenchmark(state.range(0));
+  auto scrollViewMetrics = ScrollViewMetrics{};
+  for (auto _ : state) {
+    scrollViewMetrics.contentOffset.y += 1;
+    payloadBenchmark.getEventEmitter().onScroll(scrollViewMetrics);
+  }
+}
+BENCHMARK(buildingScrollEventPayload)->Arg(false)->Arg(true);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// 200 sections of 25 nodes each: 5000 nodes (plus the root and the list).
+static constexpr int kNumberOfSections = 200;
+static constexpr int kNumberOfRowsPerSection = 8;
+
+char const IncrementalLayoutTextComponentName[] = "IncrementalLayoutText";
+
+/*
+ * Stands in for `ParagraphShadowNode`: the text is `nativeId`, measured as a
+ * single line of fixed-width characters which wraps at the available width.
+ */
+class IncrementalLayoutTextShadowNode final
+    : public ConcreteViewShadowNode<IncrementalLayoutTextComponentName> {
+ public:
+  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  static ShadowNodeTraits BaseTraits() {
+    auto traits = ConcreteViewShadowNode::BaseTraits();
+    traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
+    return traits;
+  }
+
+  Size measureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const override {
+    auto textWidth = Float(getConcreteProps().nativeId.size() * 7);
+    auto width = std::min(textWidth, layoutConstraints.maximumSize.width);
+    auto lines = std::ceil(textWidth / std::max(width, Float{1}));
+    return layoutConstraints.clamp({width, lines * 17});
+  }
+};
+
+class IncrementalLayoutTextComponentDescriptor final
+    : public ConcreteComponentDescriptor<IncrementalLayoutTextShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(UnsharedShadowNode shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+    auto &textShadowNode =
+        static_cast<IncrementalLayoutTextShadowNode &>(*shadowNode);
+    textShadowNode.enableMeasurement();
+    // Like `ParagraphComponentDescriptor`, the text might have changed.
+    textShadowNode.dirtyLayout();
+  }
+};
+
+static std::shared_ptr<ViewProps> viewProps(
+    YGFlexDirection flexDirection,
+    Float padding) {
+  auto sharedProps = std::make_shared<ViewProps>();
+  sharedProps->yogaStyle.flexDirection() = flexDirection;
+  sharedProps->yogaStyle.padding()[YGEdgeAll] =
+      YGValue{padding, YGUnitPoint};
+  return sharedProps;
+}
+
+/*
+ * Commits a change of the text of a single text node per iteration to a tree
+ * of 5000 nodes: a list of sections with rows of an icon and a text. The
+ * text changes its width but not its height, so only the text node, its row
+ * and the ancestors of the row get new layout. The argument enables
+ * `LayoutContext::incrementalLayout`.
+ */
+static void changeSingleTextInLargeTree(benchmark::State &state) {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, nullptr, nullptr});
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<
+          IncrementalLayoutTextComponentDescriptor>());
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto texts = std::vector<std::shared_ptr<IncrementalLayoutTextShadowNode>>(
+      kNumberOfSections * kNumberOfRowsPerSection);
+  auto tag = Tag{3};
+  auto sections = std::vector<ElementFragment>{};
+  for (int section = 0; section < kNumberOfSections; section++) {
+    auto rows = std::vector<ElementFragment>{};
+    for (int row = 0; row < kNumberOfRowsPerSection; row++) {
+      auto index = section * kNumberOfRowsPerSection + row;
+      rows.push_back(
+          Element<ViewShadowNode>()
+              .tag(tag++)
+              .props([] { return viewProps(YGFlexDirectionRow, 8); })
+              .children({
+                  Element<ViewShadowNode>().tag(tag++).props([] {
+                    auto sharedProps = viewProps(YGFlexDirectionRow, 0);
+                    sharedProps->yogaStyle.dimensions()[YGDimensionWidth] =
+                        YGValue{24, YGUnitPoint};
+                    sharedProps->yogaStyle.dimensions()[YGDimensionHeight] =
+                        YGValue{24, YGUnitPoint};
+                    return sharedProps;
+                  }),
+                  Element<IncrementalLayoutTextShadowNode>()
+                      .tag(tag++)
+                      .reference(texts[index])
+                      .props([=] {
+                        auto sharedProps = viewProps(YGFlexDirectionRow, 0);
+                        sharedProps->yogaStyle.flexShrink() =
+                            YGFloatOptional{1};
+                        sharedProps->nativeId =
+                            std::string(size_t(10 + index % 20), 'x');
+                        return sharedProps;
+                      }),
+              }));
+    }
+    sections.push_back(
+        Element<ViewShadowNode>()
+            .tag(tag++)
+            .props([] { return viewProps(YGFlexDirectionColumn, 12); })
+            .children(rows));
+  }
+
+  auto layoutContext = LayoutContext{};
+  layoutContext.incrementalLayout = state.range(0) != 0;
+  auto rootShadowNode =
+      builder
+          .build(Element<RootShadowNode>().tag(1).children({
+              Element<ViewShadowNode>()
+                  .tag(2)
+                  .props([] { return viewProps(YGFlexDirectionColumn, 0); })
+                  .children(sections),
+          }))
+          ->clone(LayoutConstraints{{375, 0}, {375, 100000}}, layoutContext);
+  rootShadowNode->layoutIfNeeded();
+  rootShadowNode->sealRecursive();
+
+  auto iteration = size_t{0};
+  for (auto _ : state) {
+    // Every iteration changes a different text; spreading the changes over the
+    // tree avoids laying out the same path over and over again.
+    auto &text = *texts[(iteration++ * 97) % texts.size()];
+    auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        rootShadowNode->cloneTree(
+            text.getFamily(), [&](ShadowNode const &oldShadowNode) {
+              auto sharedProps = std::make_shared<ViewProps>(
+                  static_cast<ViewProps const &>(*oldShadowNode.getProps()));
+              // Toggles between two lengths five characters apart.
+              auto length = sharedProps->nativeId.size();
+              sharedProps->nativeId.resize(
+                  length % 2 == 0 ? length + 5 : length - 5, 'x');
+              return oldShadowNode.clone({sharedProps});
+            }));
+    newRootShadowNode->layoutIfNeeded();
+    newRootShadowNode->sealRecursive();
+    rootShadowNode = newRootShadowNode;
+  }
+}
+BENCHMARK(changeSingleTextInLargeTree)->ArgName("incremental")->Arg(0)->Arg(1);
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/components/view/YogaLayoutSnapshot.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// 200 sections of 25 nodes each: 5000 nodes (plus the root and the list).
+static constexpr int kNumberOfSections = 200;
+static constexpr int kNumberOfRowsPerSection = 8;
+
+char const LayoutSnapshotTextComponentName[] = "LayoutSnapshotText";
+
+/*
+ * Stands in for `ParagraphShadowNode`: the text is `nativeId`, measured as a
+ * single line of fixed-width characters which wraps at the available width.
+ * The text itself is the content key.
+ */
+class LayoutSnapshotTextShadowNode final
+    : public ConcreteViewShadowNode<LayoutSnapshotTextComponentName> {
+ public:
+  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  static ShadowNodeTraits BaseTraits() {
+    auto traits = ConcreteViewShadowNode::BaseTraits();
+    traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
+    return traits;
+  }
+
+  Size measureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const override {
+    auto textWidth = Float(getConcreteProps().nativeId.size() * 7);
+    auto width = std::min(textWidth, layoutConstraints.maximumSize.width);
+    auto lines = std::ceil(textWidth / std::max(width, Float{1}));
+    return layoutConstraints.clamp({width, lines * 17});
+  }
+
+  better::optional<size_t> getMeasuredContentKey(
+      LayoutContext const &layoutContext) const override {
+    return std::hash<std::string>{}(getConcreteProps().nativeId);
+  }
+};
+
+class LayoutSnapshotTextComponentDescriptor final
+    : public ConcreteComponentDescriptor<LayoutSnapshotTextShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(UnsharedShadowNode shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+    auto &textShadowNode =
+        static_cast<LayoutSnapshotTextShadowNode &>(*shadowNode);
+    textShadowNode.enableMeasurement();
+    textShadowNode.dirtyLayout();
+  }
+};
+
+static std::shared_ptr<ViewProps> viewProps(
+    YGFlexDirection flexDirection,
+    Float padding) {
+  auto sharedProps = std::make_shared<ViewProps>();
+  sharedProps->yogaStyle.flexDirection() = flexDirection;
+  sharedProps->yogaStyle.padding()[YGEdgeAll] =
+      YGValue{padding, YGUnitPoint};
+  return sharedProps;
+}
+
+/*
+ * Builds the first tree of a surface: a list of sections with rows of an icon
+ * and a text, with new tags every time.
+ */
+static RootShadowNode::Unshared buildTree(
+    ComponentBuilder &builder,
+    Tag firstTag) {
+  auto tag = firstTag + 2;
+  auto sections = std::vector<ElementFragment>{};
+  for (int section = 0; section < kNumberOfSections; section++) {
+    auto rows = std::vector<ElementFragment>{};
+    for (int row = 0; row < kNumberOfRowsPerSection; row++) {
+      auto index = section * kNumberOfRowsPerSection + row;
+      rows.push_back(
+          Element<ViewShadowNode>()
+              .tag(tag++)
+              .props([] { return viewProps(YGFlexDirectionRow, 8); })
+              .children({
+                  Element<ViewShadowNode>().tag(tag++).props([] {
+                    auto sharedProps = viewProps(YGFlexDirectionRow, 0);
+                    sharedProps->yogaStyle.dimensions()[YGDimensionWidth] =
+                        YGValue{24, YGUnitPoint};
+                    sharedProps->yogaStyle.dimensions()[YGDimensionHeight] =
+                        YGValue{24, YGUnitPoint};
+                    return sharedProps;
+                  }),
+                  Element<LayoutSnapshotTextShadowNode>()
+                      .tag(tag++)
+                      .props([=] {
+                        auto sharedProps = viewProps(YGFlexDirectionRow, 0);
+                        sharedProps->yogaStyle.flexShrink() =
+                            YGFloatOptional{1};
+                        sharedProps->nativeId =
+                            std::string(size_t(10 + index % 60), 'x');
+                        return sharedProps;
+                      }),
+              }));
+    }
+    sections.push_back(
+        Element<ViewShadowNode>()
+            .tag(tag++)
+            .props([] { return viewProps(YGFlexDirectionColumn, 12); })
+            .children(rows));
+  }
+
+  // The root is not cloned with new layout constraints: its children must be
+  // owned by it to get their layout restored.
+  auto rootShadowNode = RootShadowNode::Unshared{};
+  builder.build(Element<RootShadowNode>()
+                    .tag(firstTag)
+                    .reference(rootShadowNode)
+                    .props([] {
+                      auto sharedProps = std::make_shared<RootProps>();
+                      sharedProps->layoutConstraints =
+                          LayoutConstraints{{375, 0}, {375, 100000}};
+                      return sharedProps;
+                    })
+                    .children({
+                        Element<ViewShadowNode>()
+                            .tag(firstTag + 1)
+                            .props([] {
+                              return viewProps(YGFlexDirectionColumn, 0);
+                            })
+                            .children(sections),
+                    }));
+  return rootShadowNode;
+}
+
+/*
+ * Lays out the first tree of a restarted surface of 5000 nodes, which is the
+ * same as the tree of the surface before it was stopped. Building the tree is
+ * not measured. The argument enables restoring the `YogaLayoutSnapshot` of
+ * the stopped surface before the layout.
+ */
+static void restartSurface(benchmark::State &state) {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, nullptr, nullptr});
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<
+          LayoutSnapshotTextComponentDescriptor>());
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto stoppedRootShadowNode = buildTree(builder, 1);
+  stoppedRootShadowNode->layoutIfNeeded();
+  stoppedRootShadowNode->sealRecursive();
+  auto const &props = stoppedRootShadowNode->getConcreteProps();
+  auto layoutSnapshot = YogaLayoutSnapshot::take(
+      *stoppedRootShadowNode, props.layoutConstraints, props.layoutContext);
+  auto shouldRestore = state.range(0) != 0;
+
+  auto firstTag = Tag{11};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto rootShadowNode = buildTree(builder, firstTag);
+    firstTag += 10000;
+    state.ResumeTiming();
+
+    if (shouldRestore) {
+      layoutSnapshot.restore(
+          *rootShadowNode, props.layoutConstraints, props.layoutContext);
+    }
+    rootShadowNode->layoutIfNeeded();
+    rootShadowNode->sealRecursive();
+
+    state.PauseTiming();
+    rootShadowNode.reset();
+    state.ResumeTiming();
+  }
+
+  state.counters["snapshotBytes"] = double(layoutSnapshot.getData().size());
+}
+BENCHMARK(restartSurface)->ArgName("snapshot")->Arg(0)->Arg(1);
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static constexpr int kNumberOfRows = 100;
+static constexpr int kNumberOfColumns = 10;
+
+static std::shared_ptr<ViewProps> cellProps() {
+  auto sharedProps = std::make_shared<ViewProps>();
+  auto &yogaStyle = sharedProps->yogaStyle;
+  yogaStyle.dimensions()[YGDimensionWidth] = YGValue{20, YGUnitPoint};
+  yogaStyle.dimensions()[YGDimensionHeight] = YGValue{20, YGUnitPoint};
+  yogaStyle.margin()[YGEdgeLeft] = YGValue{2, YGUnitPoint};
+  yogaStyle.padding()[YGEdgeRight] = YGValue{1, YGUnitPoint};
+  yogaStyle.border()[YGEdgeLeft] = YGValue{1, YGUnitPoint};
+  sharedProps->borderColors.left = colorFromComponents({0, 0, 0, 1});
+  return sharedProps;
+}
+
+/*
+ * Commits a change of a non-layout prop of one cell per iteration to a tree
+ * with `kNumberOfRows * kNumberOfColumns` cells which all use left and right
+ * styles. `state.range(0)` sets `LayoutContext::swapLeftAndRightInRTL`.
+ */
+static void commitToLargeTree(benchmark::State &state) {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, nullptr, nullptr});
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto cells = std::vector<std::shared_ptr<ViewShadowNode>>(
+      kNumberOfRows * kNumberOfColumns);
+  auto tag = Tag{2};
+  auto rows = std::vector<ElementFragment>{};
+  for (int row = 0; row < kNumberOfRows; row++) {
+    auto rowCells = std::vector<ElementFragment>{};
+    for (int column = 0; column < kNumberOfColumns; column++) {
+      rowCells.push_back(
+          Element<ViewShadowNode>()
+              .tag(tag++)
+              .reference(cells[row * kNumberOfColumns + column])
+              .props([] { return cellProps(); }));
+    }
+    rows.push_back(Element<ViewShadowNode>()
+                       .tag(tag++)
+                       .props([] {
+                         auto sharedProps = std::make_shared<ViewProps>();
+                         sharedProps->yogaStyle.flexDirection() =
+                             YGFlexDirectionRow;
+                         sharedProps->yogaStyle.margin()[YGEdgeRight] =
+                             YGValue{4, YGUnitPoint};
+                         return sharedProps;
+                       })
+                       .children(rowCells));
+  }
+
+  auto layoutContext = LayoutContext{};
+  layoutContext.swapLeftAndRightInRTL = state.range(0) != 0;
+
+  auto rootShadowNode =
+      builder.build(Element<RootShadowNode>().tag(1).children(rows))
+          ->clone(LayoutConstraints{{0, 0}, {500, 10000}}, layoutContext);
+  rootShadowNode->layoutIfNeeded();
+  rootShadowNode->sealRecursive();
+
+  auto iteration = size_t{0};
+  for (auto _ : state) {
+    auto &cell = *cells[iteration++ % cells.size()];
+    auto opacity = Float(iteration % 2);
+    auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        rootShadowNode->cloneTree(
+            cell.getFamily(), [&](ShadowNode const &oldShadowNode) {
+              // Like props updated from JavaScript, the new props are
+              // derived from the old ones.
+              auto sharedProps = std::make_shared<ViewProps>(
+                  static_cast<ViewProps const &>(*oldShadowNode.getProps()));
+              sharedProps->opacity = opacity;
+              return oldShadowNode.clone({sharedProps});
+            }));
+    newRootShadowNode->layoutIfNeeded();
+    newRootShadowNode->sealRecursive();
+    rootShadowNode = newRootShadowNode;
+  }
+}
+BENCHMARK(commitToLargeTree)->Arg(0)->Arg(1);
+
+} // namespace react
+} // namespace facebook
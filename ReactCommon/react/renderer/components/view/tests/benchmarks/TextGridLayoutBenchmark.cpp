@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static constexpr int kNumberOfRows = 5;
+static constexpr int kNumberOfColumns = 10;
+
+char const TextGridCellComponentName[] = "TextGridCell";
+
+/*
+ * Stands in for `ParagraphShadowNode`: measuring takes time proportional to
+ * the length of the "text", which wraps at the available width.
+ */
+class TextGridCellShadowNode final
+    : public ConcreteViewShadowNode<TextGridCellComponentName> {
+ public:
+  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+
+  static ShadowNodeTraits BaseTraits() {
+    auto traits = ConcreteViewShadowNode::BaseTraits();
+    traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
+    traits.set(ShadowNodeTraits::Trait::MeasurableConcurrently);
+    return traits;
+  }
+
+  Size measureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const override {
+    auto length = Float(20 + getTag() % 60);
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+
+    auto textWidth = length * 7;
+    auto width = std::min(textWidth, layoutConstraints.maximumSize.width);
+    auto lines = std::ceil(textWidth / std::max(width, Float{1}));
+    return layoutConstraints.clamp({width, lines * 17});
+  }
+};
+
+class TextGridCellComponentDescriptor final
+    : public ConcreteComponentDescriptor<TextGridCellShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(UnsharedShadowNode shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+    std::static_pointer_cast<TextGridCellShadowNode>(shadowNode)
+        ->enableMeasurement();
+  }
+};
+
+/*
+ * Minimal `ParallelExecutor`: runs tasks on a fixed set of threads and on
+ * the calling thread.
+ */
+class ThreadPoolExecutor final {
+ public:
+  explicit ThreadPoolExecutor(size_t numberOfThreads) {
+    for (size_t i = 0; i < numberOfThreads; i++) {
+      threads_.emplace_back([this] { runWorker(); });
+    }
+  }
+
+  ~ThreadPoolExecutor() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isStopped_ = true;
+    }
+    condition_.notify_all();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void operator()(size_t count, std::function<void(size_t)> const &task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = &task;
+    count_ = count;
+    nextIndex_ = 0;
+    numberOfFinishedTasks_ = 0;
+    generation_++;
+    condition_.notify_all();
+
+    runTasks(lock);
+    condition_.wait(lock, [&] { return numberOfFinishedTasks_ == count_; });
+    task_ = nullptr;
+  }
+
+ private:
+  void runWorker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto generation = generation_;
+    while (true) {
+      condition_.wait(
+          lock, [&] { return isStopped_ || generation != generation_; });
+      if (isStopped_) {
+        return;
+      }
+      generation = generation_;
+      runTasks(lock);
+    }
+  }
+
+  void runTasks(std::unique_lock<std::mutex> &lock) {
+    while (task_ && nextIndex_ < count_) {
+      auto index = nextIndex_++;
+      auto task = task_;
+      lock.unlock();
+      (*task)(index);
+      lock.lock();
+      if (++numberOfFinishedTasks_ == count_) {
+        condition_.notify_all();
+      }
+    }
+  }
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::function<void(size_t)> const *task_{};
+  size_t count_{0};
+  size_t nextIndex_{0};
+  size_t numberOfFinishedTasks_{0};
+  size_t generation_{0};
+  bool isStopped_{false};
+};
+
+static std::shared_ptr<RootShadowNode> buildTextGrid() {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, nullptr, nullptr});
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<TextGridCellComponentDescriptor>());
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto tag = Tag{2};
+  auto rows = std::vector<ElementFragment>{};
+  for (int row = 0; row < kNumberOfRows; row++) {
+    auto cells = std::vector<ElementFragment>{};
+    for (int column = 0; column < kNumberOfColumns; column++) {
+      cells.push_back(Element<TextGridCellShadowNode>().tag(tag++).props([] {
+        auto sharedProps = std::make_shared<ViewProps>();
+        sharedProps->yogaStyle.flexShrink() = YGFloatOptional{1};
+        return sharedProps;
+      }));
+    }
+    rows.push_back(Element<ViewShadowNode>()
+                       .tag(tag++)
+                       .props([] {
+                         auto sharedProps = std::make_shared<ViewProps>();
+                         sharedProps->yogaStyle.flexDirection() =
+                             YGFlexDirectionRow;
+                         return sharedProps;
+                       })
+                       .children(cells));
+  }
+
+  return builder.build(Element<RootShadowNode>().tag(1).children(rows));
+}
+
+static void textGridLayout(benchmark::State &state) {
+  auto numberOfThreads = static_cast<size_t>(state.range(0));
+  auto rootShadowNode = buildTextGrid();
+  auto threadPool = std::make_shared<ThreadPoolExecutor>(numberOfThreads);
+  auto measureExecutor =
+      ParallelExecutor{[threadPool](
+                           size_t count, std::function<void(size_t)> const &task) {
+        (*threadPool)(count, task);
+      }};
+
+  auto layoutContext = LayoutContext{};
+  if (numberOfThreads > 0) {
+    layoutContext.measureExecutor = &measureExecutor;
+  }
+
+  auto width = Float{0};
+  for (auto _ : state) {
+    // A different width every time, so measurements aren't cached.
+    width = width < 500 ? width + 1 : 300;
+    auto newRootShadowNode = rootShadowNode->clone(
+        LayoutConstraints{{width, 0}, {width, 10000}}, layoutContext);
+    newRootShadowNode->layoutIfNeeded();
+    benchmark::DoNotOptimize(newRootShadowNode);
+  }
+}
+BENCHMARK(textGridLayout)->Arg(0)->Arg(1)->Arg(3)->UseRealTime();
+
+} // namespace react
+} // namespace facebook
@@ -19,7 +19,8 @@ namespace react {
 class BatchedEventQueue final : public EventQueue {
  public:
   BatchedEventQueue(
-      EventPipe eventPipe,
+      EventScheduler const &eventScheduler,
+      EventPriority priority,
       StatePipe statePipe,
       std::unique_ptr<EventBeat> eventBeat,
       bool enableV2EventCoalescing);
@@ -28,10 +29,11 @@ class BatchedEventQueue final : public EventQueue {
 
   /*
    * Enqueues and (probably later) dispatches a given event.
-   * Deletes last RawEvent from the queue if it has the same type and target.
+   * Replaces a pending RawEvent of the same priority if it has the same type
+   * and target.
    * Can be called on any thread.
    */
-  void enqueueUniqueEvent(const RawEvent &rawEvent) const;
+  void enqueueUniqueEvent(RawEvent &&rawEvent) const;
 
  private:
   bool const enableV2EventCoalescing_;
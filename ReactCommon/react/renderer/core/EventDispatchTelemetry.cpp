@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventDispatchTelemetry.h"
+
+#include <algorithm>
+
+namespace facebook {
+namespace react {
+
+void EventDispatchTelemetry::didDispatchEvent(
+    EventPriority priority,
+    TelemetryDuration latency) {
+  auto &record = records_[static_cast<int>(priority)];
+  record.numberOfEvents++;
+  record.totalLatency += latency;
+  record.maxLatency = std::max(record.maxLatency, latency);
+}
+
+int EventDispatchTelemetry::getNumberOfDispatchedEvents(
+    EventPriority priority) const {
+  return getRecord(priority).numberOfEvents;
+}
+
+TelemetryDuration EventDispatchTelemetry::getTotalLatency(
+    EventPriority priority) const {
+  return getRecord(priority).totalLatency;
+}
+
+TelemetryDuration EventDispatchTelemetry::getAverageLatency(
+    EventPriority priority) const {
+  auto const &record = getRecord(priority);
+  if (record.numberOfEvents == 0) {
+    return TelemetryDuration{0};
+  }
+  return record.totalLatency / record.numberOfEvents;
+}
+
+TelemetryDuration EventDispatchTelemetry::getMaxLatency(
+    EventPriority priority) const {
+  return getRecord(priority).maxLatency;
+}
+
+EventDispatchTelemetry::Record const &EventDispatchTelemetry::getRecord(
+    EventPriority priority) const {
+  return records_[static_cast<int>(priority)];
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+
+#include <react/renderer/core/EventPriority.h>
+#include <react/utils/Telemetry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Aggregated time-to-dispatch latency (the time between enqueueing an event
+ * and handing it to the event pipe) of events of each `EventPriority`.
+ * Not thread-safe; `EventScheduler` protects its instance and hands out
+ * copies.
+ */
+class EventDispatchTelemetry final {
+ public:
+  /*
+   * Signaling
+   */
+  void didDispatchEvent(EventPriority priority, TelemetryDuration latency);
+
+  /*
+   * Reading
+   */
+  int getNumberOfDispatchedEvents(EventPriority priority) const;
+  TelemetryDuration getTotalLatency(EventPriority priority) const;
+  TelemetryDuration getAverageLatency(EventPriority priority) const;
+  TelemetryDuration getMaxLatency(EventPriority priority) const;
+
+ private:
+  struct Record {
+    int numberOfEvents{0};
+    TelemetryDuration totalLatency{0};
+    TelemetryDuration maxLatency{0};
+  };
+
+  Record const &getRecord(EventPriority priority) const;
+
+  std::array<Record, 4> records_{};
+};
+
+} // namespace react
+} // namespace facebook
@@ -23,27 +23,32 @@ EventDispatcher::EventDispatcher(
     EventBeat::Factory const &asynchonousEventBeatFactory,
     EventBeat::SharedOwnerBox const &ownerBox,
     bool enableV2EventCoalescing)
-    : synchronousUnbatchedQueue_(std::make_unique<UnbatchedEventQueue>(
-          eventPipe,
+    : eventScheduler_(std::make_unique<EventScheduler>(eventPipe)),
+      synchronousUnbatchedQueue_(std::make_unique<UnbatchedEventQueue>(
+          *eventScheduler_,
+          EventPriority::SynchronousUnbatched,
           statePipe,
           synchonousEventBeatFactory(ownerBox))),
       synchronousBatchedQueue_(std::make_unique<BatchedEventQueue>(
-          eventPipe,
+          *eventScheduler_,
+          EventPriority::SynchronousBatched,
           statePipe,
           synchonousEventBeatFactory(ownerBox),
           enableV2EventCoalescing)),
       asynchronousUnbatchedQueue_(std::make_unique<UnbatchedEventQueue>(
-          eventPipe,
+          *eventScheduler_,
+          EventPriority::AsynchronousUnbatched,
           statePipe,
           asynchonousEventBeatFactory(ownerBox))),
       asynchronousBatchedQueue_(std::make_unique<BatchedEventQueue>(
-          eventPipe,
+          *eventScheduler_,
+          EventPriority::AsynchronousBatched,
           statePipe,
           asynchonousEventBeatFactory(ownerBox),
           enableV2EventCoalescing)) {}
 
 void EventDispatcher::dispatchEvent(
-    RawEvent const &rawEvent,
+    RawEvent &&rawEvent,
     EventPriority priority) const {
   getEventQueue(priority).enqueueEvent(std::move(rawEvent));
 }
@@ -54,8 +59,12 @@ void EventDispatcher::dispatchStateUpdate(
   getEventQueue(priority).enqueueStateUpdate(std::move(stateUpdate));
 }
 
-void EventDispatcher::dispatchUniqueEvent(RawEvent const &rawEvent) const {
-  asynchronousBatchedQueue_->enqueueUniqueEvent(rawEvent);
+void EventDispatcher::dispatchUniqueEvent(RawEvent &&rawEvent) const {
+  asynchronousBatchedQueue_->enqueueUniqueEvent(std::move(rawEvent));
+}
+
+EventDispatchTelemetry EventDispatcher::getTelemetry() const {
+  return eventScheduler_->getTelemetry();
 }
 
 const EventQueue &EventDispatcher::getEventQueue(EventPriority priority) const {
@@ -12,8 +12,10 @@
 
 #include <react/renderer/core/BatchedEventQueue.h>
 #include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventDispatchTelemetry.h>
 #include <react/renderer/core/EventPipe.h>
 #include <react/renderer/core/EventPriority.h>
+#include <react/renderer/core/EventScheduler.h>
 #include <react/renderer/core/StatePipe.h>
 #include <react/renderer/core/StateUpdate.h>
 #include <react/renderer/core/UnbatchedEventQueue.h>
@@ -43,14 +45,14 @@ class EventDispatcher {
   /*
    * Dispatches a raw event with given priority using event-delivery pipe.
    */
-  void dispatchEvent(RawEvent const &rawEvent, EventPriority priority) const;
+  void dispatchEvent(RawEvent &&rawEvent, EventPriority priority) const;
 
   /*
    * Dispatches a raw event with asynchronous batched priority. Before the
    * dispatch we make sure that no other RawEvent of same type and same target
    * is on the queue.
    */
-  void dispatchUniqueEvent(RawEvent const &rawEvent) const;
+  void dispatchUniqueEvent(RawEvent &&rawEvent) const;
 
   /*
    * Dispatches a state update with given priority.
@@ -58,9 +60,17 @@ class EventDispatcher {
   void dispatchStateUpdate(StateUpdate &&stateUpdate, EventPriority priority)
       const;
 
+  /*
+   * Returns time-to-dispatch latency statistics per `EventPriority`.
+   * Can be called on any thread.
+   */
+  EventDispatchTelemetry getTelemetry() const;
+
  private:
   EventQueue const &getEventQueue(EventPriority priority) const;
 
+  // Must be declared before (and therefore outlive) the queues.
+  std::unique_ptr<EventScheduler> eventScheduler_;
   std::unique_ptr<UnbatchedEventQueue> synchronousUnbatchedQueue_;
   std::unique_ptr<BatchedEventQueue> synchronousBatchedQueue_;
   std::unique_ptr<UnbatchedEventQueue> asynchronousUnbatchedQueue_;
@@ -17,20 +17,6 @@
 namespace facebook {
 namespace react {
 
-// TODO(T29874519): Get rid of "top" prefix once and for all.
-/*
- * Capitalizes the first letter of the event type and adds "top" prefix if
- * necessary (e.g. "layout" becames "topLayout").
- */
-static std::string normalizeEventType(const std::string &type) {
-  auto prefixedType = type;
-  if (type.find("top", 0) != 0) {
-    prefixedType.insert(0, "top");
-    prefixedType[3] = toupper(prefixedType[3]);
-  }
-  return prefixedType;
-}
-
 std::mutex &EventEmitter::DispatchMutex() {
   static std::mutex mutex;
   return mutex;
@@ -63,7 +49,7 @@ void EventEmitter::dispatchEvent(
 
 void EventEmitter::dispatchEvent(
     const std::string &type,
-    const ValueFactory &payloadFactory,
+    ValueFactory payloadFactory,
     const EventPriority &priority) const {
   SystraceSection s("EventEmitter::dispatchEvent");
 
@@ -73,13 +59,14 @@ void EventEmitter::dispatchEvent(
   }
 
   eventDispatcher->dispatchEvent(
-      RawEvent(normalizeEventType(type), payloadFactory, eventTarget_),
+      RawEvent(
+          EventType::intern(type), std::move(payloadFactory), eventTarget_),
       priority);
 }
 
 void EventEmitter::dispatchUniqueEvent(
     const std::string &type,
-    const ValueFactory &payloadFactory) const {
+    ValueFactory payloadFactory) const {
   SystraceSection s("EventEmitter::dispatchUniqueEvent");
 
   auto eventDispatcher = eventDispatcher_.lock();
@@ -87,8 +74,8 @@ void EventEmitter::dispatchUniqueEvent(
     return;
   }
 
-  eventDispatcher->dispatchUniqueEvent(
-      RawEvent(normalizeEventType(type), payloadFactory, eventTarget_));
+  eventDispatcher->dispatchUniqueEvent(RawEvent(
+      EventType::intern(type), std::move(payloadFactory), eventTarget_));
 }
 
 void EventEmitter::setEnabled(bool enabled) const {
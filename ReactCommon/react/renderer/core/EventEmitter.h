@@ -66,11 +66,12 @@ class EventEmitter {
   /*
    * Initiates an event delivery process.
    * Is used by particular subclasses only.
+   * `payloadFactory` is taken by value and moved all the way to the event
+   * queue, so passing a temporary does not copy it.
    */
   void dispatchEvent(
       const std::string &type,
-      const ValueFactory &payloadFactory =
-          EventEmitter::defaultPayloadFactory(),
+      ValueFactory payloadFactory = EventEmitter::defaultPayloadFactory(),
       const EventPriority &priority = EventPriority::AsynchronousBatched) const;
 
   void dispatchEvent(
@@ -80,7 +81,7 @@ class EventEmitter {
 
   void dispatchUniqueEvent(
       const std::string &type,
-      const ValueFactory &payloadFactory =
+      ValueFactory payloadFactory =
           EventEmitter::defaultPayloadFactory()) const;
 
  private:
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventPayload.h"
+
+namespace facebook {
+namespace react {
+
+// Must be in sync with `EventPayloadKey`.
+static constexpr char const
+    *eventPayloadKeyNames[static_cast<size_t>(EventPayloadKey::NumberOfKeys)] = {
+        "target",
+        "touches",
+        "changedTouches",
+        "targetTouches",
+        "locationX",
+        "locationY",
+        "pageX",
+        "pageY",
+        "screenX",
+        "screenY",
+        "identifier",
+        "timestamp",
+        "force",
+        "layout",
+        "x",
+        "y",
+        "width",
+        "height",
+        "contentOffset",
+        "contentInset",
+        "contentSize",
+        "layoutMeasurement",
+        "zoomScale",
+        "top",
+        "left",
+        "bottom",
+        "right",
+};
+
+thread_local EventPayloadPropNames *threadLocalEventPayloadPropNames = nullptr;
+
+#pragma mark - EventPayloadPropNames
+
+EventPayloadPropNames *EventPayloadPropNames::threadLocalPropNames() {
+  return threadLocalEventPayloadPropNames;
+}
+
+EventPayloadPropNames::ThreadLocalScope::ThreadLocalScope(
+    EventPayloadPropNames &propNames)
+    : previousPropNames_(threadLocalEventPayloadPropNames) {
+  threadLocalEventPayloadPropNames = &propNames;
+}
+
+EventPayloadPropNames::ThreadLocalScope::~ThreadLocalScope() {
+  threadLocalEventPayloadPropNames = previousPropNames_;
+}
+
+jsi::PropNameID const &EventPayloadPropNames::get(
+    jsi::Runtime &runtime,
+    EventPayloadKey key) {
+  auto index = static_cast<size_t>(key);
+  auto &propName = propNames_[index];
+  if (!propName) {
+    propName = std::make_unique<jsi::PropNameID>(
+        jsi::PropNameID::forAscii(runtime, eventPayloadKeyNames[index]));
+  }
+  return *propName;
+}
+
+#pragma mark - EventPayloadBuilder
+
+EventPayloadBuilder::EventPayloadBuilder(jsi::Runtime &runtime)
+    : runtime_(runtime),
+      ownPropNames_(
+          EventPayloadPropNames::threadLocalPropNames()
+              ? nullptr
+              : std::make_unique<EventPayloadPropNames>()),
+      propNames_(
+          ownPropNames_ ? ownPropNames_.get()
+                        : EventPayloadPropNames::threadLocalPropNames()) {}
+
+jsi::Runtime &EventPayloadBuilder::getRuntime() const {
+  return runtime_;
+}
+
+jsi::PropNameID const &EventPayloadBuilder::getPropName(
+    EventPayloadKey key) const {
+  return propNames_->get(runtime_, key);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Well-known keys of event payloads.
+ */
+enum class EventPayloadKey {
+  // Common
+  Target,
+  // Touch events
+  Touches,
+  ChangedTouches,
+  TargetTouches,
+  LocationX,
+  LocationY,
+  PageX,
+  PageY,
+  ScreenX,
+  ScreenY,
+  Identifier,
+  Timestamp,
+  Force,
+  // Layout events
+  Layout,
+  X,
+  Y,
+  Width,
+  Height,
+  // Scroll events
+  ContentOffset,
+  ContentInset,
+  ContentSize,
+  LayoutMeasurement,
+  ZoomScale,
+  Top,
+  Left,
+  Bottom,
+  Right,
+  // Must be the last one.
+  NumberOfKeys,
+};
+
+/*
+ * Cache of `jsi::PropNameID`s of well-known event payload keys for a single
+ * runtime; creating a `PropNameID` from a C string on every `setProperty` call
+ * is expensive.
+ * `UIManagerBinding` owns one and sets it as thread local (using
+ * `ThreadLocalScope`) while payload factories are running, so they can access
+ * it via `EventPayloadBuilder`.
+ */
+class EventPayloadPropNames final {
+ public:
+  static EventPayloadPropNames *threadLocalPropNames();
+
+  /*
+   * Sets given `EventPayloadPropNames` as thread local for the lifetime of
+   * the object (restoring the previous ones after), even if a payload factory
+   * throws.
+   */
+  class ThreadLocalScope final {
+   public:
+    ThreadLocalScope(EventPayloadPropNames &propNames);
+    ~ThreadLocalScope();
+
+    ThreadLocalScope(ThreadLocalScope const &) = delete;
+    ThreadLocalScope &operator=(ThreadLocalScope const &) = delete;
+
+   private:
+    EventPayloadPropNames *previousPropNames_;
+  };
+
+  /*
+   * Returns the (lazily created) `PropNameID` for a given key.
+   * Must be called on the JavaScript thread.
+   */
+  jsi::PropNameID const &get(jsi::Runtime &runtime, EventPayloadKey key);
+
+ private:
+  std::array<
+      std::unique_ptr<jsi::PropNameID>,
+      static_cast<size_t>(EventPayloadKey::NumberOfKeys)>
+      propNames_{};
+};
+
+/*
+ * Builds event payload objects using cached `PropNameID`s: the ones of the
+ * thread local `EventPayloadPropNames` if any, and its own otherwise.
+ * Payload functions should always set the same keys in the same order, so
+ * that JavaScript engines share one hidden class among all payloads of an
+ * event type and property accesses in event handlers stay monomorphic.
+ */
+class EventPayloadBuilder final {
+ public:
+  EventPayloadBuilder(jsi::Runtime &runtime);
+
+  jsi::Runtime &getRuntime() const;
+
+  jsi::PropNameID const &getPropName(EventPayloadKey key) const;
+
+  template <typename T>
+  void setProperty(jsi::Object &object, EventPayloadKey key, T &&value)
+      const {
+    object.setProperty(runtime_, getPropName(key), std::forward<T>(value));
+  }
+
+ private:
+  jsi::Runtime &runtime_;
+  std::unique_ptr<EventPayloadPropNames> ownPropNames_;
+  EventPayloadPropNames *propNames_;
+};
+
+} // namespace react
+} // namespace facebook
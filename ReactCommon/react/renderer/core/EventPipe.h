@@ -8,10 +8,10 @@
 #pragma once
 
 #include <functional>
-#include <string>
 
 #include <jsi/jsi.h>
 #include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/EventType.h>
 #include <react/renderer/core/ValueFactory.h>
 
 namespace facebook {
@@ -20,7 +20,7 @@ namespace react {
 using EventPipe = std::function<void(
     jsi::Runtime &runtime,
     const EventTarget *eventTarget,
-    const std::string &type,
+    const EventType &type,
     const ValueFactory &payloadFactory)>;
 
 } // namespace react
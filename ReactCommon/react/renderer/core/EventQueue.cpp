@@ -7,28 +7,26 @@
 
 #include "EventQueue.h"
 
-#include "EventEmitter.h"
 #include "ShadowNodeFamily.h"
 
 namespace facebook {
 namespace react {
 
 EventQueue::EventQueue(
-    EventPipe eventPipe,
+    EventScheduler const &eventScheduler,
+    EventPriority priority,
     StatePipe statePipe,
     std::unique_ptr<EventBeat> eventBeat)
-    : eventPipe_(std::move(eventPipe)),
+    : eventScheduler_(eventScheduler),
+      priority_(priority),
       statePipe_(std::move(statePipe)),
       eventBeat_(std::move(eventBeat)) {
   eventBeat_->setBeatCallback(
       std::bind(&EventQueue::onBeat, this, std::placeholders::_1));
 }
 
-void EventQueue::enqueueEvent(const RawEvent &rawEvent) const {
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    eventQueue_.push_back(rawEvent);
-  }
+void EventQueue::enqueueEvent(RawEvent &&rawEvent) const {
+  eventScheduler_.schedule(std::move(rawEvent), priority_);
 
   onEnqueue();
 }
@@ -58,42 +56,9 @@ void EventQueue::onBeat(jsi::Runtime &runtime) const {
 }
 
 void EventQueue::flushEvents(jsi::Runtime &runtime) const {
-  std::vector<RawEvent> queue;
-
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-
-    if (eventQueue_.size() == 0) {
-      return;
-    }
-
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
-  }
-
-  {
-    std::lock_guard<std::mutex> lock(EventEmitter::DispatchMutex());
-
-    for (const auto &event : queue) {
-      if (event.eventTarget) {
-        event.eventTarget->retain(runtime);
-      }
-    }
-  }
-
-  for (const auto &event : queue) {
-    eventPipe_(
-        runtime, event.eventTarget.get(), event.type, event.payloadFactory);
-  }
-
-  // No need to lock `EventEmitter::DispatchMutex()` here.
-  // The mutex protects from a situation when the `instanceHandle` can be
-  // deallocated during accessing, but that's impossible at this point because
-  // we have a strong pointer to it.
-  for (const auto &event : queue) {
-    if (event.eventTarget) {
-      event.eventTarget->release(runtime);
-    }
+  if (eventScheduler_.flush(runtime)) {
+    // The scheduler yielded; some events still have to be dispatched.
+    eventBeat_->request();
   }
 }
 
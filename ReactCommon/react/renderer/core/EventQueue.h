@@ -13,7 +13,8 @@
 
 #include <jsi/jsi.h>
 #include <react/renderer/core/EventBeat.h>
-#include <react/renderer/core/EventPipe.h>
+#include <react/renderer/core/EventPriority.h>
+#include <react/renderer/core/EventScheduler.h>
 #include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/StatePipe.h>
 #include <react/renderer/core/StateUpdate.h>
@@ -22,13 +23,15 @@ namespace facebook {
 namespace react {
 
 /*
- * Event Queue synchronized with given Event Beat and dispatching event
- * using given Event Pipe.
+ * Event Queue synchronized with given Event Beat. Events are handed over to
+ * given Event Scheduler (shared by queues of all priorities) which decides
+ * when and in which order they are dispatched.
  */
 class EventQueue {
  public:
   EventQueue(
-      EventPipe eventPipe,
+      EventScheduler const &eventScheduler,
+      EventPriority priority,
       StatePipe statePipe,
       std::unique_ptr<EventBeat> eventBeat);
   virtual ~EventQueue() = default;
@@ -37,7 +40,7 @@ class EventQueue {
    * Enqueues and (probably later) dispatch a given event.
    * Can be called on any thread.
    */
-  void enqueueEvent(const RawEvent &rawEvent) const;
+  void enqueueEvent(RawEvent &&rawEvent) const;
 
   /*
    * Enqueues and (probably later) dispatch a given state update.
@@ -57,11 +60,11 @@ class EventQueue {
   void flushEvents(jsi::Runtime &runtime) const;
   void flushStateUpdates() const;
 
-  const EventPipe eventPipe_;
+  EventScheduler const &eventScheduler_;
+  const EventPriority priority_;
   const StatePipe statePipe_;
   const std::unique_ptr<EventBeat> eventBeat_;
   // Thread-safe, protected by `queueMutex_`.
-  mutable std::vector<RawEvent> eventQueue_;
   mutable std::vector<StateUpdate> stateUpdateQueue_;
   mutable std::mutex queueMutex_;
 };
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "EventEmitter.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * The longest time an event of a given priority may wait before it is
+ * dispatched regardless of the flush time budget.
+ */
+static TelemetryDuration latencyBudgetForPriority(EventPriority priority) {
+  switch (priority) {
+    case EventPriority::SynchronousUnbatched:
+    case EventPriority::SynchronousBatched:
+      return TelemetryDuration{0};
+    case EventPriority::AsynchronousUnbatched:
+      return std::chrono::milliseconds(16);
+    case EventPriority::AsynchronousBatched:
+      return std::chrono::milliseconds(100);
+  }
+}
+
+/*
+ * The time a single flush may spend dispatching events which are not due yet.
+ */
+static constexpr auto kFlushTimeBudget = std::chrono::milliseconds(8);
+
+EventScheduler::EventScheduler(EventPipe eventPipe)
+    : eventPipe_(std::move(eventPipe)) {}
+
+void EventScheduler::pushEntry(RawEvent &&rawEvent, EventPriority priority)
+    const {
+  auto enqueueTime = telemetryTimePointNow();
+  entries_.push_back(Entry{
+      std::move(rawEvent),
+      priority,
+      enqueueTime,
+      enqueueTime + latencyBudgetForPriority(priority),
+      nextSequenceNumber_++});
+}
+
+void EventScheduler::schedule(RawEvent &&rawEvent, EventPriority priority)
+    const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pushEntry(std::move(rawEvent), priority);
+}
+
+void EventScheduler::scheduleUnique(
+    RawEvent &&rawEvent,
+    EventPriority priority,
+    bool enableV2EventCoalescing) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto repeatedEntry = entries_.rend();
+
+  for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
+    if (it->priority != priority) {
+      // Events of other priorities used to live in other queues.
+      continue;
+    }
+
+    if (!enableV2EventCoalescing) {
+      // Only the most recent event of the priority can be replaced.
+      if (it->rawEvent.type == rawEvent.type &&
+          it->rawEvent.eventTarget == rawEvent.eventTarget) {
+        repeatedEntry = it;
+      }
+      break;
+    }
+
+    if (it->rawEvent.type == rawEvent.type &&
+        it->rawEvent.eventTarget == rawEvent.eventTarget) {
+      repeatedEntry = it;
+      break;
+    } else if (it->rawEvent.eventTarget == rawEvent.eventTarget) {
+      // It is necessary to maintain order of different event types
+      // for the same target. If the same target has event types A1, B1
+      // in the event queue and event A2 occurs. A1 has to stay in the
+      // queue.
+      break;
+    }
+  }
+
+  if (repeatedEntry == entries_.rend()) {
+    pushEntry(std::move(rawEvent), priority);
+  } else {
+    repeatedEntry->rawEvent = std::move(rawEvent);
+  }
+}
+
+bool EventScheduler::flush(jsi::Runtime &runtime) const {
+  std::vector<Entry> entries;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (entries_.empty()) {
+      return false;
+    }
+
+    entries = std::move(entries_);
+    entries_.clear();
+  }
+
+  // Earliest deadline first; sequence numbers keep the order of events with
+  // equal deadlines stable.
+  std::sort(
+      entries.begin(), entries.end(), [](Entry const &lhs, Entry const &rhs) {
+        if (lhs.deadline != rhs.deadline) {
+          return lhs.deadline < rhs.deadline;
+        }
+        return lhs.sequenceNumber < rhs.sequenceNumber;
+      });
+
+  {
+    std::lock_guard<std::mutex> lock(EventEmitter::DispatchMutex());
+
+    for (auto const &entry : entries) {
+      if (entry.rawEvent.eventTarget) {
+        entry.rawEvent.eventTarget->retain(runtime);
+      }
+    }
+  }
+
+  auto flushStartTime = telemetryTimePointNow();
+  auto flushEndTime = flushStartTime + kFlushTimeBudget;
+  auto latencies = std::vector<TelemetryDuration>{};
+  latencies.reserve(entries.size());
+
+  auto numberOfDispatchedEntries = size_t{0};
+  for (auto const &entry : entries) {
+    auto now = telemetryTimePointNow();
+    if (entry.deadline > flushStartTime && now >= flushEndTime) {
+      // Not due yet and out of budget: yield.
+      break;
+    }
+
+    latencies.push_back(now - entry.enqueueTime);
+    eventPipe_(
+        runtime,
+        entry.rawEvent.eventTarget.get(),
+        entry.rawEvent.type,
+        entry.rawEvent.payloadFactory);
+    numberOfDispatchedEntries++;
+  }
+
+  // No need to lock `EventEmitter::DispatchMutex()` here.
+  // The mutex protects from a situation when the `instanceHandle` can be
+  // deallocated during accessing, but that's impossible at this point because
+  // we have a strong pointer to it.
+  for (auto const &entry : entries) {
+    if (entry.rawEvent.eventTarget) {
+      entry.rawEvent.eventTarget->release(runtime);
+    }
+  }
+
+  auto remainingBegin = entries.begin() + numberOfDispatchedEntries;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  for (size_t i = 0; i < numberOfDispatchedEntries; i++) {
+    telemetry_.didDispatchEvent(entries[i].priority, latencies[i]);
+  }
+
+  if (remainingBegin == entries.end()) {
+    return false;
+  }
+
+  // Remaining events go back in front of events enqueued during the flush,
+  // restoring the enqueueing order.
+  std::sort(
+      remainingBegin, entries.end(), [](Entry const &lhs, Entry const &rhs) {
+        return lhs.sequenceNumber < rhs.sequenceNumber;
+      });
+  entries_.insert(
+      entries_.begin(),
+      std::make_move_iterator(remainingBegin),
+      std::make_move_iterator(entries.end()));
+  return true;
+}
+
+EventDispatchTelemetry EventScheduler::getTelemetry() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return telemetry_;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventDispatchTelemetry.h>
+#include <react/renderer/core/EventPipe.h>
+#include <react/renderer/core/EventPriority.h>
+#include <react/renderer/core/RawEvent.h>
+#include <react/utils/Telemetry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Holds events of all priorities in one place and decides the order in which
+ * they are dispatched. Every event gets a deadline: the moment of enqueueing
+ * plus the latency budget of its priority (zero for synchronous priorities).
+ * Events are dispatched earliest-deadline-first, so overdue asynchronous work
+ * is naturally promoted ahead of fresh work.
+ * A flush dispatches all events which are already due and then keeps
+ * dispatching not-yet-due events only while it stays within a time budget;
+ * the rest is left for a later flush.
+ * Shared by all `EventQueue`s of an `EventDispatcher`; each queue flushes it on
+ * its own beat. Can be called on any thread (except for `flush`, which must be
+ * called on the JavaScript thread).
+ */
+class EventScheduler final {
+ public:
+  EventScheduler(EventPipe eventPipe);
+
+  /*
+   * Enqueues an event with a given priority.
+   */
+  void schedule(RawEvent &&rawEvent, EventPriority priority) const;
+
+  /*
+   * Enqueues an event with a given priority replacing a pending event of the
+   * same priority, type and target (see `BatchedEventQueue`).
+   * A replaced event keeps its place and deadline, so a stream of coalesced
+   * events cannot postpone itself indefinitely.
+   */
+  void scheduleUnique(
+      RawEvent &&rawEvent,
+      EventPriority priority,
+      bool enableV2EventCoalescing) const;
+
+  /*
+   * Dispatches pending events using the event pipe.
+   * Returns `true` if some events were left pending because the time budget
+   * was exhausted; the caller must request another flush in that case.
+   */
+  bool flush(jsi::Runtime &runtime) const;
+
+  /*
+   * Returns a snapshot of time-to-dispatch statistics.
+   */
+  EventDispatchTelemetry getTelemetry() const;
+
+ private:
+  struct Entry {
+    RawEvent rawEvent;
+    EventPriority priority;
+    TelemetryTimePoint enqueueTime;
+    TelemetryTimePoint deadline;
+    uint64_t sequenceNumber;
+  };
+
+  void pushEntry(RawEvent &&rawEvent, EventPriority priority) const;
+
+  EventPipe const eventPipe_;
+
+  // Thread-safe, protected by `mutex_`.
+  // Entries are stored in enqueueing order.
+  mutable std::vector<Entry> entries_;
+  mutable uint64_t nextSequenceNumber_{0};
+  mutable EventDispatchTelemetry telemetry_;
+  mutable std::mutex mutex_;
+};
+
+} // namespace react
+} // namespace facebook
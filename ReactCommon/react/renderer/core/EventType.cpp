@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventType.h"
+
+#include <deque>
+#include <mutex>
+
+#include <better/map.h>
+#include <better/mutex.h>
+
+namespace facebook {
+namespace react {
+
+// TODO(T29874519): Get rid of "top" prefix once and for all.
+/*
+ * Capitalizes the first letter of the event type and adds "top" prefix if
+ * necessary (e.g. "layout" becames "topLayout").
+ */
+static std::string normalizeEventType(const std::string &type) {
+  auto prefixedType = type;
+  if (type.find("top", 0) != 0) {
+    prefixedType.insert(0, "top");
+    prefixedType[3] = toupper(prefixedType[3]);
+  }
+  return prefixedType;
+}
+
+EventType EventType::intern(std::string const &name) {
+  // Entries are never deallocated; `std::deque` keeps their addresses stable.
+  static better::shared_mutex mutex;
+  static auto entries = std::deque<Entry>{};
+  // Maps both normalized and non-normalized names to entries.
+  static auto registry = better::map<std::string, Entry const *>{};
+
+  {
+    std::shared_lock<better::shared_mutex> lock(mutex);
+    auto iterator = registry.find(name);
+    if (iterator != registry.end()) {
+      return EventType{*iterator->second};
+    }
+  }
+
+  std::unique_lock<better::shared_mutex> lock(mutex);
+
+  auto normalizedName = normalizeEventType(name);
+  auto iterator = registry.find(normalizedName);
+  if (iterator == registry.end()) {
+    entries.push_back(Entry{entries.size(), normalizedName});
+    iterator = registry.emplace(normalizedName, &entries.back()).first;
+  }
+
+  auto const &entry = *iterator->second;
+  registry.emplace(name, &entry);
+  return EventType{entry};
+}
+
+EventType::EventType(Entry const &entry) : entry_(&entry) {}
+
+std::string const &EventType::getName() const {
+  return entry_->name;
+}
+
+size_t EventType::getId() const {
+  return entry_->id;
+}
+
+bool EventType::operator==(EventType const &rhs) const {
+  return entry_ == rhs.entry_;
+}
+
+bool EventType::operator!=(EventType const &rhs) const {
+  return entry_ != rhs.entry_;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Represents an interned, normalized type of an event (e.g. "topLayout").
+ * All event types are stored in a process-wide registry once and never
+ * deallocated, so instances are as cheap to copy and compare as pointers.
+ */
+class EventType final {
+ public:
+  /*
+   * Returns the event type with a given name, registering it if needed.
+   * The name is normalized: the "top" prefix is added when missing
+   * (e.g. "layout" and "topLayout" are the same event type).
+   * Can be called on any thread.
+   */
+  static EventType intern(std::string const &name);
+
+  /*
+   * Returns the normalized name of the event type.
+   */
+  std::string const &getName() const;
+
+  /*
+   * Returns a dense, zero-based identifier of the event type. Identifiers are
+   * stable during the lifetime of the process and can be used as indices in
+   * per-event-type caches.
+   */
+  size_t getId() const;
+
+  bool operator==(EventType const &rhs) const;
+  bool operator!=(EventType const &rhs) const;
+
+ private:
+  struct Entry {
+    size_t id;
+    std::string name;
+  };
+
+  EventType(Entry const &entry);
+
+  Entry const *entry_;
+};
+
+} // namespace react
+} // namespace facebook
+
+namespace std {
+
+template <>
+struct hash<facebook::react::EventType> {
+  size_t operator()(facebook::react::EventType const &eventType) const {
+    return eventType.getId();
+  }
+};
+
+} // namespace std
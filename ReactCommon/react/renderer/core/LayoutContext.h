@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include <react/renderer/core/LayoutableShadowNode.h>
@@ -15,6 +16,13 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Calls `task` for every index in `[0, count)`, possibly concurrently on other
+ * threads, and returns once all the calls have returned.
+ */
+using ParallelExecutor = std::function<
+    void(size_t count, std::function<void(size_t index)> const &task)>;
+
 /*
  * LayoutContext: Additional contextual information useful for particular
  * layout approaches.
@@ -61,6 +69,21 @@ struct LayoutContext {
    * If React Native takes up entire screen, it will be {0, 0}.
    */
   Point viewportOffset{};
+
+  /*
+   * If not `nullptr`, sibling leaf nodes which have to be measured to lay out
+   * their parent are measured through this executor at once. Only nodes with
+   * the `MeasurableConcurrently` trait are measured concurrently.
+   * The executor is not owned; it must outlive the surface.
+   */
+  ParallelExecutor const *measureExecutor{};
+
+  /*
+   * If `true`, nodes which are dirty only because the layout of some of their
+   * descendants might have changed keep their layout if those descendants
+   * still have the same size, so their siblings are not laid out again.
+   */
+  bool incrementalLayout{false};
 };
 
 inline bool operator==(LayoutContext const &lhs, LayoutContext const &rhs) {
@@ -69,13 +92,17 @@ inline bool operator==(LayoutContext const &lhs, LayoutContext const &rhs) {
              lhs.affectedNodes,
              lhs.swapLeftAndRightInRTL,
              lhs.fontSizeMultiplier,
-             lhs.viewportOffset) ==
+             lhs.viewportOffset,
+             lhs.measureExecutor,
+             lhs.incrementalLayout) ==
       std::tie(
              rhs.pointScaleFactor,
              rhs.affectedNodes,
              rhs.swapLeftAndRightInRTL,
              rhs.fontSizeMultiplier,
-             rhs.viewportOffset);
+             rhs.viewportOffset,
+             rhs.measureExecutor,
+             rhs.incrementalLayout);
 }
 
 inline bool operator!=(LayoutContext const &lhs, LayoutContext const &rhs) {
@@ -7,6 +7,7 @@
 
 #include "LayoutableShadowNode.h"
 
+#include <better/map.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutMetrics.h>
@@ -118,6 +119,135 @@ LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
   return layoutMetrics;
 }
 
+std::vector<LayoutMetrics> LayoutableShadowNode::computeRelativeLayoutMetrics(
+    std::vector<ShadowNodeFamily const *> const &descendantNodeFamilies,
+    LayoutableShadowNode const &ancestorNode,
+    LayoutInspectingPolicy policy) {
+  // Accumulated contribution of a node and all its ancestors (up to the node
+  // the chain stops at) to the origin and the size of a descendant's frame.
+  // The origin offsets are summed up and the transforms only scale the size,
+  // so the values can be computed once per ancestor and reused.
+  struct AccumulatedOffset {
+    bool isValid{true};
+    Point origin{0, 0};
+    Float scaleX{1};
+    Float scaleY{1};
+  };
+
+  auto accumulatedOffsets =
+      better::map<ShadowNode const *, AccumulatedOffset>{};
+
+  auto shouldApplyTransformation = [&](ShadowNode const &shadowNode) {
+    auto isRootNode =
+        shadowNode.getTraits().check(ShadowNodeTraits::Trait::RootNodeKind);
+    return (policy.includeTransform && !isRootNode) ||
+        (policy.includeViewportOffset && isRootNode);
+  };
+
+  auto results = std::vector<LayoutMetrics>{};
+  results.reserve(descendantNodeFamilies.size());
+
+  for (auto descendantNodeFamily : descendantNodeFamilies) {
+    if (!descendantNodeFamily) {
+      results.push_back(EmptyLayoutMetrics);
+      continue;
+    }
+
+    if (descendantNodeFamily == &ancestorNode.getFamily()) {
+      results.push_back(computeRelativeLayoutMetrics(
+          *descendantNodeFamily, ancestorNode, policy));
+      continue;
+    }
+
+    auto ancestors = descendantNodeFamily->getAncestors(ancestorNode);
+
+    if (ancestors.size() == 0) {
+      results.push_back(EmptyLayoutMetrics);
+      continue;
+    }
+
+    // Step 1.
+    // Resolving accumulated offsets for all ancestors top-down. Every node
+    // visited by a previous element of the batch is already in the cache.
+    auto parentOffset = AccumulatedOffset{};
+    for (size_t i = 0; i < ancestors.size(); i++) {
+      auto &shadowNode = ancestors.at(i).first.get();
+
+      auto iterator = accumulatedOffsets.find(&shadowNode);
+      if (iterator != accumulatedOffsets.end()) {
+        parentOffset = iterator->second;
+        continue;
+      }
+
+      // The chain stops at the ancestor node or at the closest node with
+      // `RootNodeKind` trait (see `computeRelativeLayoutMetrics`).
+      auto isLast = i == 0 ||
+          shadowNode.getTraits().check(ShadowNodeTraits::Trait::RootNodeKind);
+      auto offset = isLast ? AccumulatedOffset{} : parentOffset;
+
+      auto layoutableShadowNode =
+          traitCast<LayoutableShadowNode const *>(&shadowNode);
+
+      if (!layoutableShadowNode) {
+        offset.isValid = false;
+      } else if (offset.isValid) {
+        auto currentFrame = layoutableShadowNode->getLayoutMetrics().frame;
+        if (isLast) {
+          // If it's the last element, its origin is irrelevant.
+          currentFrame.origin = {0, 0};
+        }
+
+        if (shouldApplyTransformation(shadowNode)) {
+          auto transform = layoutableShadowNode->getTransform();
+          if (transform != Transform::Identity()) {
+            offset.scaleX *= transform.at(0, 0);
+            offset.scaleY *= transform.at(1, 1);
+            currentFrame = currentFrame * transform;
+          }
+        }
+
+        offset.origin += currentFrame.origin;
+
+        if (policy.includeTransform) {
+          offset.origin += layoutableShadowNode->getContentOriginOffset();
+        }
+      }
+
+      accumulatedOffsets[&shadowNode] = offset;
+      parentOffset = offset;
+    }
+
+    // Step 2.
+    // Applying the measured node's own frame on top of its ancestors' offset.
+    auto &pair = ancestors.at(ancestors.size() - 1);
+    auto descendantLayoutableNode = traitCast<LayoutableShadowNode const *>(
+        pair.first.get().getChildren().at(pair.second).get());
+
+    if (!descendantLayoutableNode || !parentOffset.isValid) {
+      results.push_back(EmptyLayoutMetrics);
+      continue;
+    }
+
+    auto layoutMetrics = descendantLayoutableNode->getLayoutMetrics();
+    auto &resultFrame = layoutMetrics.frame;
+    auto currentFrame = resultFrame;
+
+    if (shouldApplyTransformation(*descendantLayoutableNode)) {
+      auto transform = descendantLayoutableNode->getTransform();
+      resultFrame.size = resultFrame.size * transform;
+      currentFrame = currentFrame * transform;
+    }
+
+    resultFrame.origin = currentFrame.origin + parentOffset.origin;
+    resultFrame.size.width *= parentOffset.scaleX;
+    resultFrame.size.height *= parentOffset.scaleY;
+
+    results.push_back(layoutMetrics);
+  }
+
+  return results;
+}
+
 LayoutableShadowNode::LayoutableShadowNode(
     ShadowNodeFragment const &fragment,
     ShadowNodeFamily::Shared const &family,
@@ -186,6 +316,14 @@ Size LayoutableShadowNode::measureContent(
   return Size();
 }
 
+bool LayoutableShadowNode::willMeasureContent(
+    LayoutContext const &layoutContext) const {
+  return true;
+}
+
+void LayoutableShadowNode::didMeasureContent(
+    LayoutContext const &layoutContext) const {}
+
 Size LayoutableShadowNode::measure(
     LayoutContext const &layoutContext,
     LayoutConstraints const &layoutConstraints) const {
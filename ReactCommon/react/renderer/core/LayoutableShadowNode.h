@@ -62,6 +62,21 @@ class LayoutableShadowNode : public ShadowNode {
       LayoutableShadowNode const &ancestorNode,
       LayoutInspectingPolicy policy);
 
+  /*
+   * Batched version of `computeRelativeLayoutMetrics`.
+   * Computes layout metrics of all nodes represented by
+   * `descendantNodeFamilies` relatively to the same `ancestorNode`. Offsets and
+   * scale factors accumulated along ancestor chains are computed once per
+   * ancestor node and shared by all descendants of that node in the batch.
+   * The result has the same size and order as `descendantNodeFamilies`;
+   * an element is `EmptyLayoutMetrics` in the same cases in which the
+   * non-batched version returns it.
+   */
+  static std::vector<LayoutMetrics> computeRelativeLayoutMetrics(
+      std::vector<ShadowNodeFamily const *> const &descendantNodeFamilies,
+      LayoutableShadowNode const &ancestorNode,
+      LayoutInspectingPolicy policy);
+
   /*
    * Performs layout of the tree starting from this node. Usually is being
    * called on the root node.
@@ -80,6 +95,22 @@ class LayoutableShadowNode : public ShadowNode {
       LayoutContext const &layoutContext,
       LayoutConstraints const &layoutConstraints) const;
 
+  /*
+   * Called on the layout thread before every `measureContent()` call, which
+   * for nodes with the `MeasurableConcurrently` trait might then happen on
+   * another thread. Such nodes return `false` if their content has to be
+   * measured on the layout thread this time.
+   * Default implementation returns `true`.
+   */
+  virtual bool willMeasureContent(LayoutContext const &layoutContext) const;
+
+  /*
+   * Called on the layout thread after every `measureContent()` call, which
+   * might have happened on another thread.
+   * Default implementation does nothing.
+   */
+  virtual void didMeasureContent(LayoutContext const &layoutContext) const;
+
   /*
    * Measures the node with given `layoutContext` and `layoutConstraints`.
    * The size of nested content and the padding should be included, the margin
@@ -11,10 +11,10 @@ namespace facebook {
 namespace react {
 
 RawEvent::RawEvent(
-    std::string type,
+    EventType type,
     ValueFactory payloadFactory,
     SharedEventTarget eventTarget)
-    : type(std::move(type)),
+    : type(type),
       payloadFactory(std::move(payloadFactory)),
       eventTarget(std::move(eventTarget)) {}
 
@@ -8,9 +8,9 @@
 #pragma once
 
 #include <memory>
-#include <string>
 
 #include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/EventType.h>
 #include <react/renderer/core/ValueFactory.h>
 
 namespace facebook {
@@ -18,15 +18,16 @@ namespace react {
 
 /*
  * Represents ready-to-dispatch event object.
+ * Is moved (not copied) all the way from `EventEmitter` to the event queue.
  */
 class RawEvent {
  public:
   RawEvent(
-      std::string type,
+      EventType type,
       ValueFactory payloadFactory,
       SharedEventTarget eventTarget);
 
-  std::string type;
+  EventType type;
   ValueFactory payloadFactory;
   SharedEventTarget eventTarget;
 };
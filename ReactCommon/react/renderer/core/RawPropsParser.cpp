@@ -115,15 +115,21 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
 
       for (auto i = 0; i < count; i++) {
         auto nameValue = names.getValueAtIndex(runtime, i).getString(runtime);
-        auto value = object.getProperty(runtime, nameValue);
-
-        auto name = nameValue.utf8(runtime);
 
-        auto keyIndex = nameToIndex_.at(name.data(), name.size());
+        // Prop names are ASCII; the name is looked up without being copied.
+        auto keyIndex = kRawPropsValueIndexEmpty;
+        auto lookUpName = [&](bool ascii, void const *data, size_t length) {
+          if (ascii) {
+            keyIndex =
+                nameToIndex_.at(static_cast<char const *>(data), length);
+          }
+        };
+        nameValue.getStringData(runtime, lookUpName);
         if (keyIndex == kRawPropsValueIndexEmpty) {
           continue;
         }
 
+        auto value = object.getProperty(runtime, nameValue);
         rawProps.keyIndexToValueIndex_[keyIndex] = valueIndex;
         rawProps.values_.push_back(
             RawValue(jsi::dynamicFromValue(runtime, value)));
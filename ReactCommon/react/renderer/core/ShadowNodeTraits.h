@@ -67,6 +67,12 @@ class ShadowNodeTraits {
     // Inherits `LayoutableShadowNode` and calls `measure()`.
     HasMeasure = 1 << 11,
 
+    // `measureContent()` may be called on any thread, concurrently with
+    // measuring other nodes, if `willMeasureContent()` returned `true`.
+    // Thread-local state of the layout thread (e.g.
+    // `TransactionTelemetry::threadLocalTelemetry()`) is not available then.
+    MeasurableConcurrently = 1 << 12,
+
     // Indicates that the `ShadowNode` must form a stacking context (a level
     // of the hierarchy; `ShadowView`s formed by descendants the node will be
     // descendants of a `ShadowView` formed by the node).
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/core/EventPayload.h>
+
+using namespace facebook::react;
+
+TEST(EventPayloadTest, testThreadLocalScope) {
+  auto propNames = EventPayloadPropNames{};
+  auto nestedPropNames = EventPayloadPropNames{};
+
+  EXPECT_EQ(EventPayloadPropNames::threadLocalPropNames(), nullptr);
+  {
+    EventPayloadPropNames::ThreadLocalScope scope{propNames};
+    EXPECT_EQ(EventPayloadPropNames::threadLocalPropNames(), &propNames);
+    {
+      EventPayloadPropNames::ThreadLocalScope nestedScope{nestedPropNames};
+      EXPECT_EQ(
+          EventPayloadPropNames::threadLocalPropNames(), &nestedPropNames);
+    }
+    EXPECT_EQ(EventPayloadPropNames::threadLocalPropNames(), &propNames);
+  }
+  EXPECT_EQ(EventPayloadPropNames::threadLocalPropNames(), nullptr);
+}
+
+TEST(EventPayloadTest, testThreadLocalScopeWithThrowingPayloadFactory) {
+  auto propNames = EventPayloadPropNames{};
+
+  EXPECT_THROW(
+      {
+        EventPayloadPropNames::ThreadLocalScope scope{propNames};
+        throw std::runtime_error("Payload factory failed");
+      },
+      std::runtime_error);
+  EXPECT_EQ(EventPayloadPropNames::threadLocalPropNames(), nullptr);
+}
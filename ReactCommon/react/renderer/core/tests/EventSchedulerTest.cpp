@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <jsi/decorator.h>
+
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/EventScheduler.h>
+#include <react/renderer/core/RawEvent.h>
+
+using namespace facebook::react;
+using namespace facebook;
+
+// Events in these tests have no targets and payloads which are plain numbers,
+// so the scheduler never calls into the runtime.
+class UnusedRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
+ public:
+  UnusedRuntime() : RuntimeDecorator(*this) {}
+};
+
+// Beats synchronously when induced, like the synchronous beats of the
+// platforms do on the JavaScript thread.
+class InducedEventBeat : public EventBeat {
+ public:
+  InducedEventBeat(SharedOwnerBox const &ownerBox, jsi::Runtime &runtime)
+      : EventBeat(ownerBox), runtime_(runtime) {}
+
+  void induce() const override {
+    beat(runtime_);
+  }
+
+ private:
+  jsi::Runtime &runtime_;
+};
+
+struct DispatchedEvent {
+  std::string type;
+  double payload;
+};
+
+class EventSchedulerTest : public ::testing::Test {
+ protected:
+  EventSchedulerTest()
+      : eventPipe_([this](
+                       jsi::Runtime &runtime,
+                       EventTarget const *eventTarget,
+                       EventType const &type,
+                       ValueFactory const &payloadFactory) {
+          dispatchedEvents_.push_back(
+              {type.getName(), payloadFactory(runtime).getNumber()});
+          std::this_thread::sleep_for(dispatchDuration_);
+        }) {}
+
+  static RawEvent createEvent(std::string const &type, double payload) {
+    return RawEvent(
+        EventType::intern(type),
+        [payload](jsi::Runtime &runtime) { return jsi::Value(payload); },
+        nullptr);
+  }
+
+  UnusedRuntime runtime_{};
+  EventPipe eventPipe_;
+  std::vector<DispatchedEvent> dispatchedEvents_{};
+  std::chrono::milliseconds dispatchDuration_{0};
+};
+
+TEST_F(EventSchedulerTest, dispatchesEarliestDeadlineFirst) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.schedule(
+      createEvent("scroll", 1), EventPriority::AsynchronousBatched);
+  eventScheduler.schedule(
+      createEvent("layout", 2), EventPriority::AsynchronousUnbatched);
+  eventScheduler.schedule(
+      createEvent("press", 3), EventPriority::SynchronousUnbatched);
+  eventScheduler.schedule(
+      createEvent("press", 4), EventPriority::SynchronousBatched);
+
+  EXPECT_FALSE(eventScheduler.flush(runtime_));
+
+  ASSERT_EQ(dispatchedEvents_.size(), 4);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 3);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 4);
+  EXPECT_EQ(dispatchedEvents_[2].payload, 2);
+  EXPECT_EQ(dispatchedEvents_[3].payload, 1);
+}
+
+TEST_F(EventSchedulerTest, dispatchesOverdueEventsBeforeFreshOnes) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.schedule(
+      createEvent("layout", 1), EventPriority::AsynchronousUnbatched);
+  // Longer than the latency budget of `AsynchronousUnbatched` events.
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  eventScheduler.schedule(
+      createEvent("press", 2), EventPriority::SynchronousUnbatched);
+
+  eventScheduler.flush(runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 2);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 1);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 2);
+}
+
+TEST_F(EventSchedulerTest, coalescedEventKeepsItsPlaceAndDeadline) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 1), EventPriority::AsynchronousBatched, true);
+  eventScheduler.schedule(
+      createEvent("layout", 2), EventPriority::AsynchronousUnbatched);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 3), EventPriority::AsynchronousBatched, true);
+
+  eventScheduler.flush(runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 2);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 2);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 3);
+  // The latency is measured from enqueueing of the replaced event.
+  EXPECT_GE(
+      eventScheduler.getTelemetry().getMaxLatency(
+          EventPriority::AsynchronousBatched),
+      std::chrono::milliseconds(5));
+}
+
+TEST_F(EventSchedulerTest, keepsOrderOfEventTypesOfTheSameTarget) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 1), EventPriority::AsynchronousBatched, true);
+  eventScheduler.scheduleUnique(
+      createEvent("layout", 2), EventPriority::AsynchronousBatched, true);
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 3), EventPriority::AsynchronousBatched, true);
+
+  eventScheduler.flush(runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 3);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 1);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 2);
+  EXPECT_EQ(dispatchedEvents_[2].payload, 3);
+}
+
+TEST_F(EventSchedulerTest, coalescesOnlyTheMostRecentEventWithoutV2) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 1), EventPriority::AsynchronousBatched, false);
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 2), EventPriority::AsynchronousBatched, false);
+  eventScheduler.scheduleUnique(
+      createEvent("layout", 3), EventPriority::AsynchronousBatched, false);
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 4), EventPriority::AsynchronousBatched, false);
+
+  eventScheduler.flush(runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 3);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 2);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 3);
+  EXPECT_EQ(dispatchedEvents_[2].payload, 4);
+}
+
+TEST_F(EventSchedulerTest, doesNotCoalesceEventsOfOtherPriorities) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.schedule(
+      createEvent("scroll", 1), EventPriority::AsynchronousUnbatched);
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 2), EventPriority::AsynchronousBatched, true);
+
+  eventScheduler.flush(runtime_);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 2);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 1);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 2);
+}
+
+TEST_F(EventSchedulerTest, yieldsWhenOutOfBudget) {
+  EventScheduler eventScheduler{eventPipe_};
+  // Longer than the time budget of a flush.
+  dispatchDuration_ = std::chrono::milliseconds(10);
+
+  for (auto payload : {1, 2, 3}) {
+    eventScheduler.schedule(
+        createEvent("scroll", payload), EventPriority::AsynchronousBatched);
+  }
+
+  EXPECT_TRUE(eventScheduler.flush(runtime_));
+  ASSERT_EQ(dispatchedEvents_.size(), 1);
+
+  // Events enqueued in the meantime go after the ones left pending.
+  dispatchDuration_ = std::chrono::milliseconds(0);
+  eventScheduler.schedule(
+      createEvent("scroll", 4), EventPriority::AsynchronousBatched);
+
+  EXPECT_FALSE(eventScheduler.flush(runtime_));
+  ASSERT_EQ(dispatchedEvents_.size(), 4);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 1);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 2);
+  EXPECT_EQ(dispatchedEvents_[2].payload, 3);
+  EXPECT_EQ(dispatchedEvents_[3].payload, 4);
+}
+
+TEST_F(EventSchedulerTest, dispatchesDueEventsRegardlessOfBudget) {
+  EventScheduler eventScheduler{eventPipe_};
+  dispatchDuration_ = std::chrono::milliseconds(10);
+
+  for (auto payload : {1, 2, 3}) {
+    eventScheduler.schedule(
+        createEvent("press", payload), EventPriority::SynchronousUnbatched);
+  }
+
+  EXPECT_FALSE(eventScheduler.flush(runtime_));
+  EXPECT_EQ(dispatchedEvents_.size(), 3);
+}
+
+TEST_F(EventSchedulerTest, synchronousEventFlushesPendingEvents) {
+  auto ownerBox = std::make_shared<EventBeat::OwnerBox>();
+  auto synchronousEventBeatFactory =
+      [this](EventBeat::SharedOwnerBox const &ownerBox) {
+        return std::make_unique<InducedEventBeat>(ownerBox, runtime_);
+      };
+  auto asynchronousEventBeatFactory =
+      [](EventBeat::SharedOwnerBox const &ownerBox) {
+        return std::make_unique<EventBeat>(ownerBox);
+      };
+  EventDispatcher eventDispatcher{
+      eventPipe_,
+      [](StateUpdate const &stateUpdate) {},
+      synchronousEventBeatFactory,
+      asynchronousEventBeatFactory,
+      ownerBox,
+      false};
+
+  eventDispatcher.dispatchEvent(
+      createEvent("scroll", 1), EventPriority::AsynchronousBatched);
+  EXPECT_EQ(dispatchedEvents_.size(), 0);
+
+  eventDispatcher.dispatchEvent(
+      createEvent("press", 2), EventPriority::SynchronousUnbatched);
+
+  ASSERT_EQ(dispatchedEvents_.size(), 2);
+  EXPECT_EQ(dispatchedEvents_[0].payload, 2);
+  EXPECT_EQ(dispatchedEvents_[1].payload, 1);
+}
+
+TEST_F(EventSchedulerTest, countsDispatchedEventsPerPriority) {
+  EventScheduler eventScheduler{eventPipe_};
+
+  eventScheduler.schedule(
+      createEvent("press", 1), EventPriority::SynchronousUnbatched);
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 2), EventPriority::AsynchronousBatched, true);
+  eventScheduler.scheduleUnique(
+      createEvent("scroll", 3), EventPriority::AsynchronousBatched, true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+  eventScheduler.flush(runtime_);
+
+  auto telemetry = eventScheduler.getTelemetry();
+  EXPECT_EQ(
+      telemetry.getNumberOfDispatchedEvents(
+          EventPriority::SynchronousUnbatched),
+      1);
+  EXPECT_EQ(
+      telemetry.getNumberOfDispatchedEvents(EventPriority::SynchronousBatched),
+      0);
+  EXPECT_EQ(
+      telemetry.getNumberOfDispatchedEvents(
+          EventPriority::AsynchronousUnbatched),
+      0);
+  EXPECT_EQ(
+      telemetry.getNumberOfDispatchedEvents(EventPriority::AsynchronousBatched),
+      1);
+
+  auto latency = telemetry.getMaxLatency(EventPriority::AsynchronousBatched);
+  EXPECT_GE(latency, std::chrono::milliseconds(5));
+  EXPECT_EQ(
+      telemetry.getTotalLatency(EventPriority::AsynchronousBatched), latency);
+  EXPECT_EQ(
+      telemetry.getAverageLatency(EventPriority::AsynchronousBatched), latency);
+  EXPECT_EQ(
+      telemetry.getAverageLatency(EventPriority::AsynchronousUnbatched),
+      TelemetryDuration{0});
+}
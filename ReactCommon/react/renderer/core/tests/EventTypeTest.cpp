@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/core/EventType.h>
+
+using namespace facebook::react;
+
+TEST(EventTypeTest, testInterning) {
+  auto layout = EventType::intern("layout");
+  auto topLayout = EventType::intern("topLayout");
+  auto scroll = EventType::intern("scroll");
+
+  EXPECT_EQ(layout, topLayout);
+  EXPECT_EQ(layout, EventType::intern("layout"));
+  EXPECT_NE(layout, scroll);
+
+  EXPECT_EQ(layout.getName(), "topLayout");
+  EXPECT_EQ(scroll.getName(), "topScroll");
+
+  EXPECT_EQ(layout.getId(), topLayout.getId());
+  EXPECT_NE(layout.getId(), scroll.getId());
+}
@@ -422,3 +422,95 @@ TEST(LayoutableShadowNodeTest, includeViewportOffset) {
   EXPECT_EQ(layoutMetrics.frame.origin.x, 10);
   EXPECT_EQ(layoutMetrics.frame.origin.y, 20);
 }
+
+/*
+ * ┌────────────────────────┐
+ * │<Root>                  │
+ * │ ┌─────────────────────┐│
+ * │ │ <View>              ││
+ * │ │  ┌──────┐ ┌──────┐  ││
+ * │ │  │<View>│ │<View>│  ││
+ * │ │  └──────┘ └──────┘  ││
+ * │ └─────────────────────┘│
+ * └────────────────────────┘
+ */
+TEST(LayoutableShadowNodeTest, relativeLayoutMetricsBatch) {
+  auto builder = simpleComponentBuilder();
+
+  auto parentShadowNode = std::shared_ptr<ViewShadowNode>{};
+  auto firstChildShadowNode = std::shared_ptr<ViewShadowNode>{};
+  auto secondChildShadowNode = std::shared_ptr<ViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+    Element<RootShadowNode>()
+      .finalize([](RootShadowNode &shadowNode){
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame.size = {900, 900};
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      })
+      .children({
+        Element<ViewShadowNode>()
+        .reference(parentShadowNode)
+        .props([] {
+          auto sharedProps = std::make_shared<ViewProps>();
+          sharedProps->transform = Transform::Scale(0.5, 0.5, 1);
+          return sharedProps;
+        })
+        .finalize([](ViewShadowNode &shadowNode){
+          auto layoutMetrics = EmptyLayoutMetrics;
+          layoutMetrics.frame.origin = {10, 10};
+          layoutMetrics.frame.size = {100, 100};
+          shadowNode.setLayoutMetrics(layoutMetrics);
+        })
+        .children({
+          Element<ViewShadowNode>()
+          .reference(firstChildShadowNode)
+          .finalize([](ViewShadowNode &shadowNode){
+            auto layoutMetrics = EmptyLayoutMetrics;
+            layoutMetrics.frame.origin = {10, 10};
+            layoutMetrics.frame.size = {50, 50};
+            shadowNode.setLayoutMetrics(layoutMetrics);
+          }),
+          Element<ViewShadowNode>()
+          .reference(secondChildShadowNode)
+          .props([] {
+            auto sharedProps = std::make_shared<ViewProps>();
+            sharedProps->transform = Transform::Scale(2, 2, 1);
+            return sharedProps;
+          })
+          .finalize([](ViewShadowNode &shadowNode){
+            auto layoutMetrics = EmptyLayoutMetrics;
+            layoutMetrics.frame.origin = {60, 10};
+            layoutMetrics.frame.size = {20, 20};
+            shadowNode.setLayoutMetrics(layoutMetrics);
+          })
+        })
+    });
+  // clang-format on
+
+  auto rootShadowNode = builder.build(element);
+
+  auto families = std::vector<ShadowNodeFamily const *>{
+      &firstChildShadowNode->getFamily(),
+      &secondChildShadowNode->getFamily(),
+      &parentShadowNode->getFamily(),
+      &rootShadowNode->getFamily(),
+      nullptr};
+
+  for (auto includeTransform : {true, false}) {
+    auto policy = LayoutableShadowNode::LayoutInspectingPolicy{
+        includeTransform, false};
+    auto layoutMetricsList = LayoutableShadowNode::computeRelativeLayoutMetrics(
+        families, *rootShadowNode, policy);
+
+    EXPECT_EQ(layoutMetricsList.size(), families.size());
+    for (size_t i = 0; i < families.size() - 1; i++) {
+      EXPECT_EQ(
+          layoutMetricsList[i],
+          LayoutableShadowNode::computeRelativeLayoutMetrics(
+              *families[i], *rootShadowNode, policy));
+    }
+    EXPECT_EQ(layoutMetricsList.back(), EmptyLayoutMetrics);
+  }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/EventEmitter.h>
+#include <react/renderer/graphics/Geometry.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+// Counts all heap allocations made by this binary.
+static std::atomic<size_t> numberOfAllocations{0};
+
+void *operator new(size_t size) {
+  numberOfAllocations++;
+  if (auto pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+namespace facebook {
+namespace react {
+
+// A high-rate stream of events, e.g. one second of `touchMove` events.
+static constexpr auto numberOfEvents = 10000;
+
+class BenchmarkEventEmitter : public EventEmitter {
+ public:
+  using EventEmitter::EventEmitter;
+
+  void onScroll(Point contentOffset) const {
+    dispatchUniqueEvent("scroll", [contentOffset](jsi::Runtime &runtime) {
+      auto payload = jsi::Object(runtime);
+      payload.setProperty(runtime, "x", contentOffset.x);
+      payload.setProperty(runtime, "y", contentOffset.y);
+      return payload;
+    });
+  }
+
+  void onLayout(Rect frame) const {
+    dispatchEvent("layout", [frame](jsi::Runtime &runtime) {
+      auto payload = jsi::Object(runtime);
+      payload.setProperty(runtime, "width", frame.size.width);
+      payload.setProperty(runtime, "height", frame.size.height);
+      return payload;
+    });
+  }
+};
+
+static std::shared_ptr<EventDispatcher const> createEventDispatcher() {
+  auto eventBeatFactory = [](EventBeat::SharedOwnerBox const &ownerBox) {
+    return std::make_unique<EventBeat>(ownerBox);
+  };
+
+  return std::make_shared<EventDispatcher const>(
+      [](jsi::Runtime &runtime,
+         EventTarget const *eventTarget,
+         EventType const &type,
+         ValueFactory const &payloadFactory) {},
+      [](StateUpdate const &stateUpdate) {},
+      eventBeatFactory,
+      eventBeatFactory,
+      std::make_shared<EventBeat::OwnerBox>(),
+      true);
+}
+
+static void dispatchingUniqueEvents(benchmark::State &state) {
+  auto eventDispatcher = createEventDispatcher();
+  BenchmarkEventEmitter eventEmitter(nullptr, 1, eventDispatcher);
+
+  auto allocations = size_t{0};
+  for (auto _ : state) {
+    auto initialNumberOfAllocations = numberOfAllocations.load();
+    for (int i = 0; i < numberOfEvents; i++) {
+      eventEmitter.onScroll(Point{0, Float(i)});
+    }
+    allocations += numberOfAllocations.load() - initialNumberOfAllocations;
+  }
+
+  state.counters["allocations/event"] =
+      double(allocations) / (state.iterations() * numberOfEvents);
+}
+BENCHMARK(dispatchingUniqueEvents);
+
+static void dispatchingEvents(benchmark::State &state) {
+  auto allocations = size_t{0};
+  for (auto _ : state) {
+    // Event queues are never flushed here (that requires a JavaScript
+    // runtime), so a fresh dispatcher is used for every batch.
+    state.PauseTiming();
+    auto eventDispatcher = createEventDispatcher();
+    BenchmarkEventEmitter eventEmitter(nullptr, 1, eventDispatcher);
+    state.ResumeTiming();
+
+    auto initialNumberOfAllocations = numberOfAllocations.load();
+    for (int i = 0; i < numberOfEvents; i++) {
+      eventEmitter.onLayout(Rect{Point{0, 0}, Size{Float(i), Float(i)}});
+    }
+    allocations += numberOfAllocations.load() - initialNumberOfAllocations;
+
+    state.PauseTiming();
+    eventDispatcher.reset();
+    state.ResumeTiming();
+  }
+
+  state.counters["allocations/event"] =
+      double(allocations) / (state.iterations() * numberOfEvents);
+}
+BENCHMARK(dispatchingEvents);
+
+} // namespace react
+} // namespace facebook
@@ -11,9 +11,102 @@
 
 #include <glog/logging.h>
 
+#if defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define RN_TRANSFORM_USE_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RN_TRANSFORM_USE_NEON 1
+#endif
+
 namespace facebook {
 namespace react {
 
+/*
+ * Concatenates two arbitrary 4x4 matrices: every row of the result is a linear
+ * combination of rows of `lhs` with coefficients from the same row of `rhs`.
+ */
+template <typename T>
+static inline void multiplyMatrices(
+    std::array<T, 16> const &lhs,
+    std::array<T, 16> const &rhs,
+    std::array<T, 16> &result) {
+  for (int row = 0; row < 4; row++) {
+    auto rhs0 = rhs[row * 4 + 0], rhs1 = rhs[row * 4 + 1],
+         rhs2 = rhs[row * 4 + 2], rhs3 = rhs[row * 4 + 3];
+    for (int column = 0; column < 4; column++) {
+      result[row * 4 + column] = rhs0 * lhs[column] +
+          rhs1 * lhs[4 + column] + rhs2 * lhs[8 + column] +
+          rhs3 * lhs[12 + column];
+    }
+  }
+}
+
+#if defined(RN_TRANSFORM_USE_SSE)
+
+// Single-precision SIMD version of the function above; the order of
+// operations is the same, so the results are identical.
+static inline void multiplyMatrices(
+    std::array<float, 16> const &lhs,
+    std::array<float, 16> const &rhs,
+    std::array<float, 16> &result) {
+  auto lhsRow0 = _mm_loadu_ps(&lhs[0]);
+  auto lhsRow1 = _mm_loadu_ps(&lhs[4]);
+  auto lhsRow2 = _mm_loadu_ps(&lhs[8]);
+  auto lhsRow3 = _mm_loadu_ps(&lhs[12]);
+  for (int row = 0; row < 4; row++) {
+    auto value = _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 0]), lhsRow0);
+    value =
+        _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 1]), lhsRow1));
+    value =
+        _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 2]), lhsRow2));
+    value =
+        _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 3]), lhsRow3));
+    _mm_storeu_ps(&result[row * 4], value);
+  }
+}
+
+#elif defined(RN_TRANSFORM_USE_NEON)
+
+// Single-precision SIMD version of the function above; the order of
+// operations is the same, so the results are identical.
+static inline void multiplyMatrices(
+    std::array<float, 16> const &lhs,
+    std::array<float, 16> const &rhs,
+    std::array<float, 16> &result) {
+  auto lhsRow0 = vld1q_f32(&lhs[0]);
+  auto lhsRow1 = vld1q_f32(&lhs[4]);
+  auto lhsRow2 = vld1q_f32(&lhs[8]);
+  auto lhsRow3 = vld1q_f32(&lhs[12]);
+  for (int row = 0; row < 4; row++) {
+    auto value = vmulq_n_f32(lhsRow0, rhs[row * 4 + 0]);
+    value = vaddq_f32(value, vmulq_n_f32(lhsRow1, rhs[row * 4 + 1]));
+    value = vaddq_f32(value, vmulq_n_f32(lhsRow2, rhs[row * 4 + 2]));
+    value = vaddq_f32(value, vmulq_n_f32(lhsRow3, rhs[row * 4 + 3]));
+    vst1q_f32(&result[row * 4], value);
+  }
+}
+
+#endif
+
+/*
+ * Concatenates two matrices of `Affine2D` kind. Only six elements of such
+ * matrices are meaningful, the rest of the result stays as in the identity
+ * matrix.
+ */
+static inline void multiplyAffineMatrices(
+    std::array<Float, 16> const &lhs,
+    std::array<Float, 16> const &rhs,
+    std::array<Float, 16> &result) {
+  result[0] = rhs[0] * lhs[0] + rhs[1] * lhs[4];
+  result[1] = rhs[0] * lhs[1] + rhs[1] * lhs[5];
+  result[4] = rhs[4] * lhs[0] + rhs[5] * lhs[4];
+  result[5] = rhs[4] * lhs[1] + rhs[5] * lhs[5];
+  result[12] = rhs[12] * lhs[0] + rhs[13] * lhs[4] + lhs[12];
+  result[13] = rhs[12] * lhs[1] + rhs[13] * lhs[5] + lhs[13];
+}
+
 #ifdef RN_DEBUG_STRING_CONVERTIBLE
 void Transform::print(Transform const &t, std::string prefix) {
   LOG(ERROR) << prefix << "[ " << t.matrix[0] << " " << t.matrix[1] << " "
@@ -253,14 +346,41 @@ bool Transform::operator!=(Transform const &rhs) const {
   return !(*this == rhs);
 }
 
+TransformKind Transform::getKind() const {
+  if (matrix[2] != 0 || matrix[3] != 0 || matrix[6] != 0 || matrix[7] != 0 ||
+      matrix[8] != 0 || matrix[9] != 0 || matrix[10] != 1 ||
+      matrix[11] != 0 || matrix[14] != 0 || matrix[15] != 1) {
+    return TransformKind::Full3D;
+  }
+
+  if (matrix[0] != 1 || matrix[1] != 0 || matrix[4] != 0 || matrix[5] != 1 ||
+      matrix[12] != 0 || matrix[13] != 0) {
+    return TransformKind::Affine2D;
+  }
+
+  return TransformKind::Identity;
+}
+
+bool Transform::isIdentity() const {
+  return getKind() == TransformKind::Identity;
+}
+
 Transform Transform::operator*(Transform const &rhs) const {
-  if (*this == Transform::Identity()) {
+  auto lhsKind = getKind();
+  if (lhsKind == TransformKind::Identity) {
     return rhs;
   }
 
+  auto rhsKind = rhs.getKind();
+  if (rhsKind == TransformKind::Identity && rhs.operations.empty()) {
+    return *this;
+  }
+
   const auto &lhs = *this;
   auto result = Transform{};
-  for (const auto &op : this->operations) {
+
+  result.operations.reserve(lhs.operations.size() + rhs.operations.size());
+  for (const auto &op : lhs.operations) {
     if (op.type == TransformOperationType::Identity &&
         result.operations.size() > 0) {
       continue;
@@ -275,46 +395,12 @@ Transform Transform::operator*(Transform const &rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0], lhs01 = lhs.matrix[1], lhs02 = lhs.matrix[2],
-       lhs03 = lhs.matrix[3], lhs10 = lhs.matrix[4], lhs11 = lhs.matrix[5],
-       lhs12 = lhs.matrix[6], lhs13 = lhs.matrix[7], lhs20 = lhs.matrix[8],
-       lhs21 = lhs.matrix[9], lhs22 = lhs.matrix[10], lhs23 = lhs.matrix[11],
-       lhs30 = lhs.matrix[12], lhs31 = lhs.matrix[13], lhs32 = lhs.matrix[14],
-       lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0], rhs1 = rhs.matrix[1], rhs2 = rhs.matrix[2],
-       rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  if (lhsKind == TransformKind::Affine2D &&
+      rhsKind != TransformKind::Full3D) {
+    multiplyAffineMatrices(lhs.matrix, rhs.matrix, result.matrix);
+  } else {
+    multiplyMatrices(lhs.matrix, rhs.matrix, result.matrix);
+  }
 
   return result;
 }
@@ -328,18 +414,51 @@ Float const &Transform::at(int i, int j) const {
 }
 
 Point operator*(Point const &point, Transform const &transform) {
-  if (transform == Transform::Identity()) {
+  auto kind = transform.getKind();
+  if (kind == TransformKind::Identity) {
     return point;
   }
 
+  if (kind == TransformKind::Affine2D) {
+    auto const &matrix = transform.matrix;
+    return {
+        point.x * matrix[0] + point.y * matrix[4] + matrix[12],
+        point.x * matrix[1] + point.y * matrix[5] + matrix[13]};
+  }
+
   auto result = transform * Vector{point.x, point.y, 0, 1};
 
   return {result.x, result.y};
 }
 
 Rect operator*(Rect const &rect, Transform const &transform) {
+  auto kind = transform.getKind();
+  if (kind == TransformKind::Identity) {
+    return rect;
+  }
+
   auto centre = rect.getCenter();
 
+  if (kind == TransformKind::Affine2D) {
+    auto const &matrix = transform.matrix;
+    auto transformPoint = [&](Float x, Float y) {
+      return Point{
+          x * matrix[0] + y * matrix[4] + matrix[12] + centre.x,
+          x * matrix[1] + y * matrix[5] + matrix[13] + centre.y};
+    };
+
+    auto minX = rect.origin.x - centre.x;
+    auto minY = rect.origin.y - centre.y;
+    auto maxX = rect.getMaxX() - centre.x;
+    auto maxY = rect.getMaxY() - centre.y;
+
+    return Rect::boundingRect(
+        transformPoint(minX, minY),
+        transformPoint(maxX, minY),
+        transformPoint(maxX, maxY),
+        transformPoint(minX, maxY));
+  }
+
   auto a = Point{rect.origin.x, rect.origin.y} - centre;
   auto b = Point{rect.getMaxX(), rect.origin.y} - centre;
   auto c = Point{rect.getMaxX(), rect.getMaxY()} - centre;
@@ -373,7 +492,7 @@ Vector operator*(Transform const &transform, Vector const &vector) {
 }
 
 Size operator*(Size const &size, Transform const &transform) {
-  if (transform == Transform::Identity()) {
+  if (transform.isIdentity()) {
     return size;
   }
 
@@ -48,6 +48,13 @@ struct TransformOperation {
   Float z;
 };
 
+/*
+ * Classifies a transform matrix by the amount of work operations on it need.
+ * `Affine2D` matrices only scale, rotate, skew and translate in the XY plane;
+ * everything else (perspective, 3D rotations, translation along Z) is `Full3D`.
+ */
+enum class TransformKind { Identity, Affine2D, Full3D };
+
 /*
  * Defines transform matrix to apply affine transformations.
  */
@@ -57,6 +64,14 @@ struct Transform {
   std::array<Float, 16> matrix{
       {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
 
+  /*
+   * Returns the kind of the matrix. Operations on transforms use it to pick
+   * the cheapest algorithm; it is computed from `matrix` (which can be mutated
+   * directly), so it's never stale.
+   */
+  TransformKind getKind() const;
+  bool isIdentity() const;
+
   /**
    * For debugging only. Prints out the matrix.
    */
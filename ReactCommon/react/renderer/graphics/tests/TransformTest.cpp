@@ -66,3 +66,73 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, classifyingTransforms) {
+  EXPECT_EQ(Transform::Identity().getKind(), TransformKind::Identity);
+  EXPECT_TRUE(Transform::Identity().isIdentity());
+  EXPECT_EQ(Transform::Scale(2, 3, 1).getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(Transform::Translate(5, 7, 0).getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(Transform::RotateZ(M_PI_4).getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(Transform::Skew(0.5, 0).getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(Transform::Scale(1, 1, 2).getKind(), TransformKind::Full3D);
+  EXPECT_EQ(Transform::Translate(0, 0, 1).getKind(), TransformKind::Full3D);
+  EXPECT_EQ(Transform::RotateX(M_PI_4).getKind(), TransformKind::Full3D);
+  EXPECT_EQ(Transform::Perspective(100).getKind(), TransformKind::Full3D);
+}
+
+TEST(TransformTest, multiplyingAffineTransforms) {
+  auto scale = Transform::Scale(0.5, 2, 1);
+  auto rotate = Transform::RotateZ(M_PI / 3);
+  auto translate = Transform::Translate(10, -20, 0);
+
+  auto transform = scale * rotate * translate;
+  EXPECT_EQ(transform.getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(transform.operations.size(), 3);
+
+  // The same product computed with the general formula.
+  auto expected = Transform{};
+  auto intermediate = Transform{};
+  for (auto pass = 0; pass < 2; pass++) {
+    auto const &lhs = pass == 0 ? scale : intermediate;
+    auto const &rhs = pass == 0 ? rotate : translate;
+    auto &result = pass == 0 ? intermediate : expected;
+    for (auto i = 0; i < 4; i++) {
+      for (auto j = 0; j < 4; j++) {
+        result.at(i, j) = 0;
+        for (auto k = 0; k < 4; k++) {
+          result.at(i, j) += rhs.at(i, k) * lhs.at(k, j);
+        }
+      }
+    }
+  }
+
+  for (auto i = 0; i < 16; i++) {
+    ASSERT_NEAR(transform.matrix[i], expected.matrix[i], 0.0001);
+  }
+
+  auto point = facebook::react::Point{3, 4} * transform;
+  auto vector = transform * Vector{3, 4, 0, 1};
+  ASSERT_NEAR(point.x, vector.x, 0.0001);
+  ASSERT_NEAR(point.y, vector.y, 0.0001);
+}
+
+TEST(TransformTest, multiplyingTransformsWithPerspective) {
+  auto transform = Transform::Perspective(400) * Transform::RotateY(M_PI_4) *
+      Transform::Translate(10, 20, 30);
+  EXPECT_EQ(transform.getKind(), TransformKind::Full3D);
+
+  auto vector = transform * Vector{1, 1, 0, 1};
+  // Applying the product must be equivalent to applying the factors one by
+  // one, starting from the rightmost one.
+  auto stepByStep = Vector{1, 1, 0, 1};
+  for (auto const &step :
+       {Transform::Translate(10, 20, 30),
+        Transform::RotateY(M_PI_4),
+        Transform::Perspective(400)}) {
+    stepByStep = step * stepByStep;
+  }
+  ASSERT_NEAR(vector.x, stepByStep.x, 0.0001);
+  ASSERT_NEAR(vector.y, stepByStep.y, 0.0001);
+  ASSERT_NEAR(vector.z, stepByStep.z, 0.0001);
+  ASSERT_NEAR(vector.w, stepByStep.w, 0.0001);
+}
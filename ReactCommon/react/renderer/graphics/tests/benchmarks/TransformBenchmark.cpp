@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/graphics/Transform.h>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+static auto const fromTransform = Transform::Scale(1, 1, 1) *
+    Transform::RotateZ(0) * Transform::Translate(0, 0, 0);
+static auto const toTransform = Transform::Scale(1.5, 1.5, 1) *
+    Transform::RotateZ(M_PI_2) * Transform::Translate(100, 40, 0);
+static auto const perspectiveTransform = Transform::Perspective(500) *
+    Transform::RotateY(M_PI_4) * Transform::Translate(10, 20, 30);
+static auto const frame = Rect{Point{20, 30}, Size{200, 100}};
+
+static void interpolatingAffineTransforms(benchmark::State &state) {
+  auto progress = Float{0};
+  for (auto _ : state) {
+    progress = progress >= 1 ? 0 : progress + Float{0.01};
+    benchmark::DoNotOptimize(Transform::Interpolate(
+        progress, fromTransform, toTransform));
+  }
+}
+BENCHMARK(interpolatingAffineTransforms);
+
+static void multiplyingIdentityTransforms(benchmark::State &state) {
+  auto identity = Transform::Identity();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(identity * toTransform);
+  }
+}
+BENCHMARK(multiplyingIdentityTransforms);
+
+static void multiplyingAffineTransforms(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(fromTransform * toTransform);
+  }
+}
+BENCHMARK(multiplyingAffineTransforms);
+
+static void multiplyingFull3DTransforms(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(toTransform * perspectiveTransform);
+  }
+}
+BENCHMARK(multiplyingFull3DTransforms);
+
+static void transformingFrameWithAffineTransform(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame * toTransform);
+  }
+}
+BENCHMARK(transformingFrameWithAffineTransform);
+
+static void transformingFrameWithFull3DTransform(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame * perspectiveTransform);
+  }
+}
+BENCHMARK(transformingFrameWithFull3DTransform);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -7,6 +7,11 @@
 
 #include "ShadowTree.h"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <unordered_set>
+
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include <react/renderer/core/LayoutContext.h>
@@ -266,25 +271,45 @@ CommitStatus ShadowTree::commit(
     CommitOptions commitOptions) const {
   SystraceSection s("ShadowTree::commit");
 
-  int attempts = 0;
+  auto attempts = CommitAttempts{};
 
   while (true) {
-    attempts++;
-
-    auto status = tryCommit(transaction, commitOptions);
+    auto status = tryCommit(transaction, commitOptions, attempts);
     if (status != CommitStatus::Failed) {
       return status;
     }
 
+    attempts.numberOfFailedAttempts++;
+
     // After multiple attempts, we failed to commit the transaction.
     // Something internally went terribly wrong.
-    assert(attempts < 1024);
+    assert(attempts.numberOfFailedAttempts < 1024);
+
+    // Another commit won the race; the chances are that the next attempt
+    // will fail as well if it starts right away while the concurrent
+    // transaction is still being finished.
+    if (attempts.numberOfFailedAttempts < kCommitAttemptsBeforeBackOff) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(
+          1 << std::min(
+              attempts.numberOfFailedAttempts - kCommitAttemptsBeforeBackOff,
+              10)));
+    }
   }
 }
 
 CommitStatus ShadowTree::tryCommit(
     ShadowTreeCommitTransaction transaction,
     CommitOptions commitOptions) const {
+  auto attempts = CommitAttempts{};
+  return tryCommit(transaction, commitOptions, attempts);
+}
+
+CommitStatus ShadowTree::tryCommit(
+    ShadowTreeCommitTransaction const &transaction,
+    CommitOptions const &commitOptions,
+    CommitAttempts &attempts) const {
   SystraceSection s("ShadowTree::tryCommit");
 
   auto telemetry = TransactionTelemetry{};
@@ -292,47 +317,147 @@ CommitStatus ShadowTree::tryCommit(
 
   auto oldRevision = ShadowTreeRevision{};
   auto newRevision = ShadowTreeRevision{};
+  auto layoutSnapshot = YogaLayoutSnapshot::Shared{};
 
   {
     // Reading `currentRevision_` in shared manner.
     std::shared_lock<better::shared_mutex> lock(commitMutex_);
     oldRevision = currentRevision_;
+    layoutSnapshot = layoutSnapshot_;
   }
 
-  auto newRootShadowNode = transaction(*oldRevision.rootShadowNode);
+  // A tree that needs to be laid out and sealed before being committed.
+  auto newRootShadowNode = RootShadowNode::Unshared{};
+  // A tree that will be committed.
+  auto committedRootShadowNode = RootShadowNode::Shared{};
 
-  if (!newRootShadowNode ||
-      (commitOptions.shouldCancel && commitOptions.shouldCancel())) {
-    return CommitStatus::Cancelled;
-  }
+  std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
 
-  if (commitOptions.enableStateReconciliation) {
-    auto updatedNewRootShadowNode =
-        progressState(*newRootShadowNode, *oldRevision.rootShadowNode);
-    if (updatedNewRootShadowNode) {
+  // The result of a previous failed attempt can be rebased on top of the new
+  // revision instead of running the transaction again if the root node props
+  // (which are the only part of the old tree the transaction depends on) stay
+  // the same.
+  auto shouldRebase = !attempts.failedRootShadowNodes.empty() &&
+      attempts.failedBaseRevision.rootShadowNode->getProps() ==
+          oldRevision.rootShadowNode->getProps();
+
+  if (shouldRebase) {
+    // The concurrent commits could only update `State` objects of the nodes.
+    // Progressing them clones only paths to the updated nodes; the layout
+    // results of the rest of the (already laid out) tree are reused.
+    affectedLayoutableNodes =
+        std::move(attempts.failedAffectedLayoutableNodes);
+    auto const &failedRootShadowNode = attempts.failedRootShadowNodes.back();
+    auto progressedRootShadowNode = commitOptions.enableStateReconciliation
+        ? progressState(*failedRootShadowNode, *oldRevision.rootShadowNode)
+        : ShadowNode::Unshared{};
+    if (progressedRootShadowNode) {
       newRootShadowNode =
-          std::static_pointer_cast<RootShadowNode>(updatedNewRootShadowNode);
+          std::static_pointer_cast<RootShadowNode>(progressedRootShadowNode);
+    } else {
+      committedRootShadowNode = failedRootShadowNode;
+    }
+  } else {
+    newRootShadowNode = transaction(*oldRevision.rootShadowNode);
+
+    if (!newRootShadowNode) {
+      return CommitStatus::Cancelled;
+    }
+
+    // A tree that differs from the old one only in the root node props might
+    // have been laid out in advance by `prepareLayout`.
+    if (&newRootShadowNode->getChildren() ==
+        &oldRevision.rootShadowNode->getChildren()) {
+      auto preparedLayout = PreparedLayout{};
+      {
+        std::shared_lock<better::shared_mutex> lock(commitMutex_);
+        auto found = findPreparedLayout(
+            oldRevision.number, newRootShadowNode->getConcreteProps());
+        if (found) {
+          preparedLayout = *found;
+        }
+      }
+
+      if (preparedLayout.rootShadowNode) {
+        committedRootShadowNode = preparedLayout.rootShadowNode;
+        if (committedRootShadowNode->getProps() !=
+            newRootShadowNode->getProps()) {
+          // The props only match in the parts that affect layout, so the
+          // prepared tree gets the new props; the clone keeps its (clean)
+          // layout.
+          auto clonedRootShadowNode = committedRootShadowNode->ShadowNode::clone(
+              {newRootShadowNode->getProps()});
+          clonedRootShadowNode->sealRecursive();
+          committedRootShadowNode =
+              std::static_pointer_cast<RootShadowNode>(clonedRootShadowNode);
+        }
+        affectedLayoutableNodes =
+            std::move(preparedLayout.affectedLayoutableNodes);
+        newRootShadowNode = nullptr;
+      }
+    }
+
+    if (newRootShadowNode && commitOptions.enableStateReconciliation) {
+      auto updatedNewRootShadowNode =
+          progressState(*newRootShadowNode, *oldRevision.rootShadowNode);
+      if (updatedNewRootShadowNode) {
+        newRootShadowNode =
+            std::static_pointer_cast<RootShadowNode>(updatedNewRootShadowNode);
+      }
     }
   }
 
-  // Layout nodes.
-  std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
-  affectedLayoutableNodes.reserve(1024);
+  if (commitOptions.shouldCancel && commitOptions.shouldCancel()) {
+    return CommitStatus::Cancelled;
+  }
 
+  // Layout nodes.
   telemetry.willLayout();
-  telemetry.setAsThreadLocal();
-  newRootShadowNode->layoutIfNeeded(&affectedLayoutableNodes);
-  telemetry.unsetAsThreadLocal();
+  if (newRootShadowNode) {
+    affectedLayoutableNodes.reserve(1024);
+
+    if (layoutSnapshot && !shouldRebase &&
+        !newRootShadowNode->getChildren().empty()) {
+      auto const &props = newRootShadowNode->getConcreteProps();
+      layoutSnapshot->restore(
+          *newRootShadowNode, props.layoutConstraints, props.layoutContext);
+    }
+
+    auto numberOfRebasedAffectedLayoutableNodes =
+        affectedLayoutableNodes.size();
+
+    telemetry.setAsThreadLocal();
+    newRootShadowNode->layoutIfNeeded(&affectedLayoutableNodes);
+    telemetry.unsetAsThreadLocal();
+
+    if (numberOfRebasedAffectedLayoutableNodes != 0) {
+      removeOutdatedAffectedLayoutableNodes(
+          affectedLayoutableNodes, numberOfRebasedAffectedLayoutableNodes);
+    }
+  }
   telemetry.didLayout();
 
-  // Seal the shadow node so it can no longer be mutated
-  newRootShadowNode->sealRecursive();
+  if (newRootShadowNode) {
+    // Seal the shadow node so it can no longer be mutated
+    newRootShadowNode->sealRecursive();
+    committedRootShadowNode = newRootShadowNode;
+  }
 
   {
     // Updating `currentRevision_` in unique manner if it hasn't changed.
     std::unique_lock<better::shared_mutex> lock(commitMutex_);
 
     if (currentRevision_.number != oldRevision.number) {
+      attempts.wastedLayoutTime +=
+          telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime();
+
+      if (commitOptions.dependsOnlyOnRootProps) {
+        attempts.failedRootShadowNodes.push_back(committedRootShadowNode);
+        attempts.failedBaseRevision = oldRevision;
+        attempts.failedAffectedLayoutableNodes =
+            std::move(affectedLayoutableNodes);
+      }
+
       return CommitStatus::Failed;
     }
 
@@ -343,16 +468,27 @@ CommitStatus ShadowTree::tryCommit(
 
       updateMountedFlag(
           currentRevision_.rootShadowNode->getChildren(),
-          newRootShadowNode->getChildren());
+          committedRootShadowNode->getChildren());
     }
 
     telemetry.didCommit();
     telemetry.setRevisionNumber(newRevisionNumber);
+    telemetry.setCommitRetries(
+        attempts.numberOfFailedAttempts, attempts.wastedLayoutTime);
 
-    newRevision =
-        ShadowTreeRevision{newRootShadowNode, newRevisionNumber, telemetry};
+    newRevision = ShadowTreeRevision{
+        committedRootShadowNode, newRevisionNumber, telemetry};
 
     currentRevision_ = newRevision;
+
+    // Prepared layouts are based on the previous revision.
+    preparedLayouts_.clear();
+
+    // The snapshot is meant for the first committed tree with children only.
+    if (layoutSnapshot && layoutSnapshot_ == layoutSnapshot &&
+        !committedRootShadowNode->getChildren().empty()) {
+      layoutSnapshot_ = nullptr;
+    }
   }
 
   if (commitOptions.shouldCancel && commitOptions.shouldCancel()) {
@@ -373,6 +509,92 @@ ShadowTreeRevision ShadowTree::getCurrentRevision() const {
   return currentRevision_;
 }
 
+YogaLayoutSnapshot ShadowTree::takeLayoutSnapshot() const {
+  auto rootShadowNode = getCurrentRevision().rootShadowNode;
+  auto const &props = rootShadowNode->getConcreteProps();
+  return YogaLayoutSnapshot::take(
+      *rootShadowNode, props.layoutConstraints, props.layoutContext);
+}
+
+void ShadowTree::restoreLayoutSnapshotOnNextCommit(
+    YogaLayoutSnapshot::Shared layoutSnapshot) const {
+  std::unique_lock<better::shared_mutex> lock(commitMutex_);
+  layoutSnapshot_ = std::move(layoutSnapshot);
+}
+
+void ShadowTree::prepareLayout(
+    LayoutConstraints const &layoutConstraints,
+    LayoutContext const &layoutContext) const {
+  SystraceSection s("ShadowTree::prepareLayout");
+
+  auto revision = getCurrentRevision();
+
+  auto const &props = revision.rootShadowNode->getConcreteProps();
+  if (props.layoutConstraints == layoutConstraints &&
+      props.layoutContext == layoutContext) {
+    // The current revision is already laid out this way.
+    return;
+  }
+
+  auto rootShadowNode =
+      revision.rootShadowNode->clone(layoutConstraints, layoutContext);
+  auto const &rootProps = rootShadowNode->getConcreteProps();
+
+  {
+    std::shared_lock<better::shared_mutex> lock(commitMutex_);
+    if (findPreparedLayout(revision.number, rootProps)) {
+      return;
+    }
+  }
+
+  auto preparedLayout = PreparedLayout{};
+  preparedLayout.baseRevisionNumber = revision.number;
+  rootShadowNode->layoutIfNeeded(&preparedLayout.affectedLayoutableNodes);
+  rootShadowNode->sealRecursive();
+  preparedLayout.rootShadowNode = rootShadowNode;
+
+  std::unique_lock<better::shared_mutex> lock(commitMutex_);
+
+  if (currentRevision_.number != revision.number ||
+      findPreparedLayout(revision.number, rootProps)) {
+    // A concurrent commit made the result obsolete, or a concurrent call
+    // prepared the same layout.
+    return;
+  }
+
+  if (preparedLayouts_.size() >= kMaxPreparedLayouts) {
+    preparedLayouts_.erase(preparedLayouts_.begin());
+  }
+  preparedLayouts_.push_back(std::move(preparedLayout));
+}
+
+RootShadowNode::Shared ShadowTree::getPreparedLayout(
+    LayoutConstraints const &layoutConstraints,
+    LayoutContext const &layoutContext) const {
+  std::shared_lock<better::shared_mutex> lock(commitMutex_);
+  auto rootProps = RootProps{currentRevision_.rootShadowNode->getConcreteProps(),
+                             layoutConstraints,
+                             layoutContext};
+  auto preparedLayout =
+      findPreparedLayout(currentRevision_.number, rootProps);
+  return preparedLayout ? preparedLayout->rootShadowNode : nullptr;
+}
+
+ShadowTree::PreparedLayout const *ShadowTree::findPreparedLayout(
+    ShadowTreeRevision::Number baseRevisionNumber,
+    RootProps const &rootProps) const {
+  for (auto const &preparedLayout : preparedLayouts_) {
+    auto const &props = preparedLayout.rootShadowNode->getConcreteProps();
+    if (preparedLayout.baseRevisionNumber == baseRevisionNumber &&
+        props.layoutConstraints == rootProps.layoutConstraints &&
+        props.layoutContext == rootProps.layoutContext &&
+        props.yogaStyle == rootProps.yogaStyle) {
+      return &preparedLayout;
+    }
+  }
+  return nullptr;
+}
+
 void ShadowTree::commitEmptyTree() const {
   commit(
       [](RootShadowNode const &oldRootShadowNode) -> RootShadowNode::Unshared {
@@ -385,6 +607,29 @@ void ShadowTree::commitEmptyTree() const {
       });
 }
 
+void ShadowTree::removeOutdatedAffectedLayoutableNodes(
+    std::vector<LayoutableShadowNode const *> &affectedLayoutableNodes,
+    size_t numberOfRebasedNodes) {
+  // Nodes of a rebased tree which were laid out again are affected twice: as
+  // nodes of the failed attempt, and as nodes of the rebased tree. The latter
+  // ones have the most recent layout metrics.
+  auto families = std::unordered_set<ShadowNodeFamily const *>{};
+  families.reserve(affectedLayoutableNodes.size() - numberOfRebasedNodes);
+  for (size_t i = numberOfRebasedNodes; i < affectedLayoutableNodes.size();
+       i++) {
+    families.insert(&affectedLayoutableNodes[i]->getFamily());
+  }
+
+  affectedLayoutableNodes.erase(
+      std::remove_if(
+          affectedLayoutableNodes.begin(),
+          affectedLayoutableNodes.begin() + numberOfRebasedNodes,
+          [&](LayoutableShadowNode const *layoutableNode) {
+            return families.count(&layoutableNode->getFamily()) != 0;
+          }),
+      affectedLayoutableNodes.begin() + numberOfRebasedNodes);
+}
+
 void ShadowTree::emitLayoutEvents(
     std::vector<LayoutableShadowNode const *> &affectedLayoutableNodes) const {
   SystraceSection s("ShadowTree::emitLayoutEvents");
@@ -12,6 +12,7 @@
 
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/components/view/YogaLayoutSnapshot.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -42,6 +43,11 @@ class ShadowTree final {
     // Lambda called inside `tryCommit`. If false is returned, commit is
     // cancelled.
     std::function<bool()> shouldCancel;
+    // Indicates that the transaction produces a tree that does not depend on
+    // the old tree besides the root node props. This allows `commit` to rebase
+    // the result of a failed attempt on top of a newer revision instead of
+    // running the transaction (and layout) again.
+    bool dependsOnlyOnRootProps{false};
   };
 
   /*
@@ -69,14 +75,17 @@ class ShadowTree final {
    */
   CommitStatus tryCommit(
       ShadowTreeCommitTransaction transaction,
-      CommitOptions commitOptions = {false}) const;
+      CommitOptions commitOptions = {false, {}, false}) const;
 
   /*
    * Calls `tryCommit` in a loop until it finishes successfully.
+   * Backs off between failed attempts to give the concurrent commit that
+   * caused the failure a chance to finish. The number of failed attempts and
+   * the time wasted on their layout are recorded in the revision's telemetry.
    */
   CommitStatus commit(
       ShadowTreeCommitTransaction transaction,
-      CommitOptions commitOptions = {false}) const;
+      CommitOptions commitOptions = {false, {}, false}) const;
 
   /*
    * Returns a `ShadowTreeRevision` representing the momentary state of
@@ -89,6 +98,42 @@ class ShadowTree final {
    */
   void commitEmptyTree() const;
 
+  /*
+   * Takes a snapshot of the layout of the current revision, which can be
+   * restored onto the first tree of the surface when it is started again.
+   */
+  YogaLayoutSnapshot takeLayoutSnapshot() const;
+
+  /*
+   * Restores a given snapshot onto the next committed tree with children
+   * before the tree is laid out. The snapshot is dropped after the first
+   * successful commit of such a tree.
+   */
+  void restoreLayoutSnapshotOnNextCommit(
+      YogaLayoutSnapshot::Shared layoutSnapshot) const;
+
+  /*
+   * Lays out the current revision with given `layoutConstraints` and
+   * `layoutContext` which the surface is likely to get soon (e.g. after a
+   * rotation) and keeps the result until the next commit. A commit that keeps
+   * the children of the root node and changes its props only to ones which
+   * lay out the same way as the prepared ones reuses the result instead of
+   * laying out the tree again.
+   * Can be called from any thread; meant to be called on a background one.
+   */
+  void prepareLayout(
+      LayoutConstraints const &layoutConstraints,
+      LayoutContext const &layoutContext) const;
+
+  /*
+   * Returns the laid out (and sealed) current revision prepared by
+   * `prepareLayout` for given `layoutConstraints` and `layoutContext`, or
+   * `nullptr` if there is no such one.
+   */
+  RootShadowNode::Shared getPreparedLayout(
+      LayoutConstraints const &layoutConstraints,
+      LayoutContext const &layoutContext) const;
+
   /**
    * Forces the ShadowTree to ping its delegate that an update is available.
    * Useful for animations on Android.
@@ -99,6 +144,67 @@ class ShadowTree final {
   MountingCoordinator::Shared getMountingCoordinator() const;
 
  private:
+  /*
+   * Number of failed attempts after which `commit` starts to sleep (instead of
+   * just yielding) between attempts.
+   */
+  constexpr static int kCommitAttemptsBeforeBackOff = 4;
+
+  /*
+   * Carries information between consecutive attempts of the same commit.
+   */
+  struct CommitAttempts {
+    int numberOfFailedAttempts{0};
+    TelemetryDuration wastedLayoutTime{};
+
+    // The laid out and sealed results of failed attempts and the revision
+    // the last one was based on. The last result is the one that gets
+    // rebased; the previous ones are retained because
+    // `failedAffectedLayoutableNodes` might point to their nodes.
+    // Empty if the attempts cannot be rebased.
+    std::vector<RootShadowNode::Shared> failedRootShadowNodes{};
+    ShadowTreeRevision failedBaseRevision{};
+    std::vector<LayoutableShadowNode const *> failedAffectedLayoutableNodes{};
+  };
+
+  /*
+   * Maximum number of layouts kept by `prepareLayout` for the same revision.
+   */
+  constexpr static int kMaxPreparedLayouts = 4;
+
+  /*
+   * The current revision laid out in advance with different layout
+   * constraints or layout context of the root node.
+   */
+  struct PreparedLayout {
+    ShadowTreeRevision::Number baseRevisionNumber{};
+    RootShadowNode::Shared rootShadowNode{};
+    std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
+  };
+
+  /*
+   * Finds a layout prepared for the given revision with root node props which
+   * are equal to `rootProps` in all parts that affect layout (the layout
+   * constraints, the layout context and the Yoga style).
+   * Must be called with `commitMutex_` locked.
+   */
+  PreparedLayout const *findPreparedLayout(
+      ShadowTreeRevision::Number baseRevisionNumber,
+      RootProps const &rootProps) const;
+
+  CommitStatus tryCommit(
+      ShadowTreeCommitTransaction const &transaction,
+      CommitOptions const &commitOptions,
+      CommitAttempts &attempts) const;
+
+  /*
+   * Removes the first `numberOfRebasedNodes` nodes (the ones carried over from
+   * a failed attempt) which have a more recent counterpart later in the list.
+   */
+  static void removeOutdatedAffectedLayoutableNodes(
+      std::vector<LayoutableShadowNode const *> &affectedLayoutableNodes,
+      size_t numberOfRebasedNodes);
+
   void emitLayoutEvents(
       std::vector<LayoutableShadowNode const *> &affectedLayoutableNodes) const;
 
@@ -106,6 +212,10 @@ class ShadowTree final {
   ShadowTreeDelegate const &delegate_;
   mutable better::shared_mutex commitMutex_;
   mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
+  mutable YogaLayoutSnapshot::Shared
+      layoutSnapshot_; // Protected by `commitMutex_`.
+  mutable std::vector<PreparedLayout>
+      preparedLayouts_; // Protected by `commitMutex_`.
   MountingCoordinator::Shared mountingCoordinator_;
 };
 
@@ -10,53 +10,132 @@
 namespace facebook {
 namespace react {
 
+/*
+ * A reference to the `lookups` token of a `ShadowTree` (or to a snapshot of
+ * the registry, which references the tokens of all its trees) held by a
+ * lookup. The reference is released under the registry mutex and the release
+ * is announced to `remove` calls waiting for the `ShadowTree` to retire (even
+ * if the callback throws).
+ */
+class ShadowTreeRegistryLookup final {
+ public:
+  ShadowTreeRegistryLookup(
+      std::shared_ptr<void const> &&token,
+      std::mutex &mutex,
+      std::condition_variable &retirement)
+      : token_(std::move(token)), mutex_(mutex), retirement_(retirement) {}
+
+  ~ShadowTreeRegistryLookup() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      token_.reset();
+    }
+    retirement_.notify_all();
+  }
+
+ private:
+  std::shared_ptr<void const> token_;
+  std::mutex &mutex_;
+  std::condition_variable &retirement_;
+};
+
+ShadowTreeRegistry::ShadowTreeRegistry()
+    : registry_(std::make_shared<Registry const>()) {}
+
 ShadowTreeRegistry::~ShadowTreeRegistry() {
   assert(
-      registry_.empty() && "Deallocation of non-empty `ShadowTreeRegistry`.");
+      getRegistry()->empty() &&
+      "Deallocation of non-empty `ShadowTreeRegistry`.");
+}
+
+std::shared_ptr<ShadowTreeRegistry::Registry const>
+ShadowTreeRegistry::getRegistry() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return registry_;
 }
 
 void ShadowTreeRegistry::add(std::unique_ptr<ShadowTree> &&shadowTree) const {
-  std::unique_lock<better::shared_mutex> lock(mutex_);
+  std::lock_guard<std::mutex> lock(mutex_);
 
-  registry_.emplace(shadowTree->getSurfaceId(), std::move(shadowTree));
+  auto registry = std::make_shared<Registry>(*registry_);
+  auto surfaceId = shadowTree->getSurfaceId();
+  registry->emplace(
+      surfaceId,
+      RegisteredShadowTree{
+          std::shared_ptr<ShadowTree const>(std::move(shadowTree)),
+          std::make_shared<int const>()});
+  registry_ = registry;
 }
 
-std::unique_ptr<ShadowTree> ShadowTreeRegistry::remove(
+std::shared_ptr<ShadowTree const> ShadowTreeRegistry::remove(
     SurfaceId surfaceId) const {
-  std::unique_lock<better::shared_mutex> lock(mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
 
-  auto iterator = registry_.find(surfaceId);
-  if (iterator == registry_.end()) {
+  auto iterator = registry_->find(surfaceId);
+  if (iterator == registry_->end()) {
     return {};
   }
 
-  auto shadowTree = std::unique_ptr<ShadowTree>(iterator->second.release());
-  registry_.erase(iterator);
+  auto shadowTree = iterator->second.shadowTree;
+  auto lookups = iterator->second.lookups;
+
+  auto registry = std::make_shared<Registry>(*registry_);
+  registry->erase(surfaceId);
+  registry_ = registry;
+
+  // All references to the token besides ours belong to lookups that started
+  // before the removal (and might still be committing to the tree); they are
+  // acquired and released under the mutex, so the count is exact.
+  retirement_.wait(lock, [&] { return lookups.use_count() == 1; });
+
   return shadowTree;
 }
 
 bool ShadowTreeRegistry::visit(
     SurfaceId surfaceId,
     std::function<void(const ShadowTree &shadowTree)> callback) const {
-  std::shared_lock<better::shared_mutex> lock(mutex_);
+  // The token keeps the `ShadowTree` alive because `remove` waits for it.
+  ShadowTree const *shadowTree = nullptr;
+  auto lookups = std::shared_ptr<void const>{};
 
-  auto iterator = registry_.find(surfaceId);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
 
-  if (iterator == registry_.end()) {
-    return false;
+    auto iterator = registry_->find(surfaceId);
+    if (iterator == registry_->end()) {
+      return false;
+    }
+
+    shadowTree = iterator->second.shadowTree.get();
+    lookups = iterator->second.lookups;
   }
 
-  callback(*iterator->second);
+  ShadowTreeRegistryLookup lookup{std::move(lookups), mutex_, retirement_};
+  callback(*shadowTree);
   return true;
 }
 
+std::shared_ptr<ShadowTree const> ShadowTreeRegistry::find(
+    SurfaceId surfaceId) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto iterator = registry_->find(surfaceId);
+  if (iterator == registry_->end()) {
+    return nullptr;
+  }
+
+  return iterator->second.shadowTree;
+}
+
 void ShadowTreeRegistry::enumerate(
     std::function<void(const ShadowTree &shadowTree, bool &stop)> callback)
     const {
-  std::shared_lock<better::shared_mutex> lock(mutex_);
+  auto registry = getRegistry();
+  auto const &shadowTrees = *registry;
+  ShadowTreeRegistryLookup lookup{std::move(registry), mutex_, retirement_};
   bool stop = false;
-  for (auto const &pair : registry_) {
-    callback(*pair.second, stop);
+  for (auto const &pair : shadowTrees) {
+    callback(*pair.second.shadowTree, stop);
     if (stop) {
       break;
     }
@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
 #include <better/map.h>
-#include <better/mutex.h>
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/mounting/ShadowTree.h>
@@ -18,10 +21,15 @@ namespace react {
 
 /*
  * Owning registry of `ShadowTree`s.
+ * The registry is implemented as an immutable snapshot of a map which is
+ * replaced (copy-on-write) on every mutation. Lookups (`visit` and
+ * `enumerate`) hold the mutex only to acquire and release a reference to a
+ * `ShadowTree` (or to the snapshot) and call the callback without it, so
+ * commits to independent surfaces do not contend on the registry.
  */
 class ShadowTreeRegistry final {
  public:
-  ShadowTreeRegistry() = default;
+  ShadowTreeRegistry();
   ~ShadowTreeRegistry();
 
   /*
@@ -34,16 +42,20 @@ class ShadowTreeRegistry final {
   /*
    * Removes a `ShadowTree` instance with given `surfaceId` from the registry
    * and returns it as a result.
-   * The ownership of the instance is also transferred to the caller.
+   * Blocks until all `visit` and `enumerate` calls that might still observe
+   * the instance have finished; after that only the caller and holders of
+   * references returned by `find` share the ownership of the instance.
    * Returns `nullptr` if a `ShadowTree` with given `surfaceId` was not found.
-   * Can be called from any thread.
+   * Can be called from any thread (but not from inside of a `visit` or
+   * `enumerate` callback).
    */
-  std::unique_ptr<ShadowTree> remove(SurfaceId surfaceId) const;
+  std::shared_ptr<ShadowTree const> remove(SurfaceId surfaceId) const;
 
   /*
    * Finds a `ShadowTree` instance with a given `surfaceId` in the registry and
-   * synchronously calls the `callback` with a reference to the instance while
-   * the mutex is being acquired.
+   * synchronously calls the `callback` with a reference to the instance.
+   * The instance is guaranteed to stay registered until the `callback`
+   * returns.
    * Returns `true` if the registry has `ShadowTree` instance with corresponding
    * `surfaceId`, otherwise returns `false` without calling the `callback`.
    * Can be called from any thread.
@@ -52,6 +64,16 @@ class ShadowTreeRegistry final {
       SurfaceId surfaceId,
       std::function<void(const ShadowTree &shadowTree)> callback) const;
 
+  /*
+   * Finds a `ShadowTree` instance with a given `surfaceId` in the registry and
+   * returns a reference to it, or `nullptr` if it was not found.
+   * Unlike `visit`, the reference does not delay `remove`, so it is meant for
+   * long-running work (e.g. laying out in advance on a background thread) that
+   * must not block stopping of the surface.
+   * Can be called from any thread.
+   */
+  std::shared_ptr<ShadowTree const> find(SurfaceId surfaceId) const;
+
   /*
    * Enumerates all stored shadow trees.
    * Set `stop` to `true` to interrupt the enumeration.
@@ -61,9 +83,28 @@ class ShadowTreeRegistry final {
                      callback) const;
 
  private:
-  mutable better::shared_mutex mutex_;
-  mutable better::map<SurfaceId, std::unique_ptr<ShadowTree>>
-      registry_; // Protected by `mutex_`.
+  /*
+   * A registered `ShadowTree` and a token that every `visit` and `enumerate`
+   * call in flight holds a reference to; `remove` waits for the token to be
+   * released by all of them.
+   */
+  struct RegisteredShadowTree {
+    std::shared_ptr<ShadowTree const> shadowTree;
+    std::shared_ptr<void const> lookups;
+  };
+
+  using Registry = better::map<SurfaceId, RegisteredShadowTree>;
+
+  /*
+   * Returns the current snapshot of the registry.
+   */
+  std::shared_ptr<Registry const> getRegistry() const;
+
+  mutable std::mutex mutex_; // Protects `registry_` and all references to
+                             // `lookups` tokens.
+  mutable std::condition_variable
+      retirement_; // Notified when a lookup releases its token.
+  mutable std::shared_ptr<Registry const> registry_;
 };
 
 } // namespace react
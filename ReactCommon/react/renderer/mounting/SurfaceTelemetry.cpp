@@ -19,11 +19,13 @@ void SurfaceTelemetry::incorporate(
   commitTime_ += telemetry.getCommitEndTime() - telemetry.getCommitStartTime();
   diffTime_ += telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
   mountTime_ += telemetry.getMountEndTime() - telemetry.getMountStartTime();
+  wastedLayoutTime_ += telemetry.getWastedLayoutTime();
 
   numberOfTransactions_++;
   numberOfMutations_ += numberOfMutations;
   numberOfTextMeasurements_ += telemetry.getNumberOfTextMeasurements();
   lastRevisionNumber_ = telemetry.getRevisionNumber();
+  numberOfCommitRetries_ += telemetry.getNumberOfCommitRetries();
 
   while (recentTransactionTelemetries_.size() >=
          kMaxNumberOfRecordedCommitTelemetries) {
@@ -49,6 +51,10 @@ TelemetryDuration SurfaceTelemetry::getMountTime() const {
   return mountTime_;
 }
 
+TelemetryDuration SurfaceTelemetry::getWastedLayoutTime() const {
+  return wastedLayoutTime_;
+}
+
 int SurfaceTelemetry::getNumberOfTransactions() const {
   return numberOfTransactions_;
 }
@@ -65,6 +71,10 @@ int SurfaceTelemetry::getLastRevisionNumber() const {
   return lastRevisionNumber_;
 }
 
+int SurfaceTelemetry::getNumberOfCommitRetries() const {
+  return numberOfCommitRetries_;
+}
+
 std::vector<TransactionTelemetry>
 SurfaceTelemetry::getRecentTransactionTelemetries() const {
   auto result = std::vector<TransactionTelemetry>{};
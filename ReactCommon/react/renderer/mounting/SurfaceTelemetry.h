@@ -31,11 +31,13 @@ class SurfaceTelemetry final {
   TelemetryDuration getCommitTime() const;
   TelemetryDuration getDiffTime() const;
   TelemetryDuration getMountTime() const;
+  TelemetryDuration getWastedLayoutTime() const;
 
   int getNumberOfTransactions() const;
   int getNumberOfMutations() const;
   int getNumberOfTextMeasurements() const;
   int getLastRevisionNumber() const;
+  int getNumberOfCommitRetries() const;
 
   std::vector<TransactionTelemetry> getRecentTransactionTelemetries() const;
 
@@ -52,11 +54,13 @@ class SurfaceTelemetry final {
   TelemetryDuration commitTime_{};
   TelemetryDuration diffTime_{};
   TelemetryDuration mountTime_{};
+  TelemetryDuration wastedLayoutTime_{};
 
   int numberOfTransactions_{};
   int numberOfMutations_{};
   int numberOfTextMeasurements_{};
   int lastRevisionNumber_{};
+  int numberOfCommitRetries_{};
 
   better::
       small_vector<TransactionTelemetry, kMaxNumberOfRecordedCommitTelemetries>
@@ -82,6 +82,13 @@ void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setCommitRetries(
+    int numberOfCommitRetries,
+    TelemetryDuration wastedLayoutTime) {
+  numberOfCommitRetries_ = numberOfCommitRetries;
+  wastedLayoutTime_ = wastedLayoutTime;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -138,5 +145,13 @@ int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
 
+int TransactionTelemetry::getNumberOfCommitRetries() const {
+  return numberOfCommitRetries_;
+}
+
+TelemetryDuration TransactionTelemetry::getWastedLayoutTime() const {
+  return wastedLayoutTime_;
+}
+
 } // namespace react
 } // namespace facebook
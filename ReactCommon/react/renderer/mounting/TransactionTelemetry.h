@@ -43,6 +43,15 @@ class TransactionTelemetry final {
 
   void setRevisionNumber(int revisionNumber);
 
+  /*
+   * Records the number of commit attempts which failed because of concurrent
+   * commits before this transaction succeeded, and the time spent on layout in
+   * those failed attempts.
+   */
+  void setCommitRetries(
+      int numberOfCommitRetries,
+      TelemetryDuration wastedLayoutTime);
+
   /*
    * Reading
    */
@@ -57,6 +66,8 @@ class TransactionTelemetry final {
 
   int getNumberOfTextMeasurements() const;
   int getRevisionNumber() const;
+  int getNumberOfCommitRetries() const;
+  TelemetryDuration getWastedLayoutTime() const;
 
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
@@ -70,6 +81,8 @@ class TransactionTelemetry final {
 
   int numberOfTextMeasurements_{0};
   int revisionNumber_{0};
+  int numberOfCommitRetries_{0};
+  TelemetryDuration wastedLayoutTime_{};
 };
 
 } // namespace react
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+
+using namespace facebook::react;
+
+class PreparedLayoutShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  virtual void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override{};
+};
+
+// Root: {100, 100} (or {200, 100} after the change of the constraints)
+//  └─ View: width: 50%, height: 10
+class PreparedLayoutTest : public ::testing::Test {
+ protected:
+  ComponentBuilder builder_{simpleComponentBuilder()};
+  PreparedLayoutShadowTreeDelegate shadowTreeDelegate_{};
+  RootComponentDescriptor rootComponentDescriptor_{
+      ComponentDescriptorParameters{EventDispatcher::Shared{}, nullptr, nullptr}};
+  ShadowTree shadowTree_{SurfaceId{11},
+                         LayoutConstraints{{100, 100}, {100, 100}},
+                         LayoutContext{},
+                         rootComponentDescriptor_,
+                         shadowTreeDelegate_,
+                         {}};
+  LayoutConstraints wideLayoutConstraints_{{200, 100}, {200, 100}};
+
+  PreparedLayoutTest() {
+    // clang-format off
+    auto element =
+        Element<ViewShadowNode>()
+          .props([] {
+            auto sharedProps = std::make_shared<ViewProps>();
+            auto &yogaStyle = sharedProps->yogaStyle;
+            yogaStyle.dimensions()[YGDimensionWidth] = YGValue{50, YGUnitPercent};
+            yogaStyle.dimensions()[YGDimensionHeight] = YGValue{10, YGUnitPoint};
+            return sharedProps;
+          });
+    // clang-format on
+
+    auto viewShadowNode = builder_.build(element);
+    shadowTree_.commit([&](RootShadowNode const &oldRootShadowNode) {
+      return std::make_shared<RootShadowNode>(
+          oldRootShadowNode,
+          ShadowNodeFragment{
+              /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+              /* .children = */
+              std::make_shared<SharedShadowNodeList>(
+                  SharedShadowNodeList{viewShadowNode}),
+          });
+    });
+  }
+
+  void constraintLayout(LayoutConstraints const &layoutConstraints) {
+    shadowTree_.commit([&](RootShadowNode const &oldRootShadowNode) {
+      return oldRootShadowNode.clone(layoutConstraints, LayoutContext{});
+    });
+  }
+
+  Float getViewWidth() const {
+    auto rootShadowNode = shadowTree_.getCurrentRevision().rootShadowNode;
+    return traitCast<LayoutableShadowNode const &>(
+               *rootShadowNode->getChildren().at(0))
+        .getLayoutMetrics()
+        .frame.size.width;
+  }
+};
+
+TEST_F(PreparedLayoutTest, commitOfPreparedLayout) {
+  shadowTree_.prepareLayout(wideLayoutConstraints_, LayoutContext{});
+
+  auto preparedRootShadowNode =
+      shadowTree_.getPreparedLayout(wideLayoutConstraints_, LayoutContext{});
+  ASSERT_NE(preparedRootShadowNode, nullptr);
+  EXPECT_EQ(
+      preparedRootShadowNode->getLayoutMetrics().frame.size, (Size{200, 100}));
+  EXPECT_EQ(getViewWidth(), 50);
+
+  constraintLayout(wideLayoutConstraints_);
+
+  // The committed root node has the props of the transaction and the laid out
+  // children of the prepared one.
+  auto rootShadowNode = shadowTree_.getCurrentRevision().rootShadowNode;
+  EXPECT_EQ(
+      rootShadowNode->getConcreteProps().layoutConstraints,
+      wideLayoutConstraints_);
+  EXPECT_EQ(
+      rootShadowNode->getChildren().at(0),
+      preparedRootShadowNode->getChildren().at(0));
+  EXPECT_EQ(rootShadowNode->getLayoutMetrics().frame.size, (Size{200, 100}));
+  EXPECT_EQ(getViewWidth(), 100);
+
+  // The commit invalidates prepared layouts.
+  EXPECT_EQ(
+      shadowTree_.getPreparedLayout(wideLayoutConstraints_, LayoutContext{}),
+      nullptr);
+}
+
+TEST_F(PreparedLayoutTest, commitOfOtherLayoutConstraints) {
+  shadowTree_.prepareLayout(wideLayoutConstraints_, LayoutContext{});
+  auto preparedRootShadowNode =
+      shadowTree_.getPreparedLayout(wideLayoutConstraints_, LayoutContext{});
+
+  constraintLayout(LayoutConstraints{{300, 100}, {300, 100}});
+
+  EXPECT_NE(
+      shadowTree_.getCurrentRevision().rootShadowNode, preparedRootShadowNode);
+  EXPECT_EQ(getViewWidth(), 150);
+}
+
+TEST_F(PreparedLayoutTest, preparedLayoutOfObsoleteRevision) {
+  shadowTree_.prepareLayout(wideLayoutConstraints_, LayoutContext{});
+  auto preparedRootShadowNode =
+      shadowTree_.getPreparedLayout(wideLayoutConstraints_, LayoutContext{});
+
+  // Another commit makes the prepared layout obsolete.
+  shadowTree_.commit([&](RootShadowNode const &oldRootShadowNode) {
+    return std::static_pointer_cast<RootShadowNode>(
+        oldRootShadowNode.ShadowNode::clone({}));
+  });
+  constraintLayout(wideLayoutConstraints_);
+
+  EXPECT_NE(
+      shadowTree_.getCurrentRevision().rootShadowNode, preparedRootShadowNode);
+  EXPECT_EQ(getViewWidth(), 100);
+}
+
+TEST_F(PreparedLayoutTest, commitOfOtherRootYogaStyle) {
+  shadowTree_.prepareLayout(wideLayoutConstraints_, LayoutContext{});
+  auto preparedRootShadowNode =
+      shadowTree_.getPreparedLayout(wideLayoutConstraints_, LayoutContext{});
+
+  // The same layout constraints, but a root node padding which the prepared
+  // layout does not account for.
+  shadowTree_.commit([&](RootShadowNode const &oldRootShadowNode) {
+    auto props = std::make_shared<RootProps>(
+        oldRootShadowNode.getConcreteProps(),
+        wideLayoutConstraints_,
+        LayoutContext{});
+    props->yogaStyle.padding()[YGEdgeAll] = YGValue{50, YGUnitPoint};
+    return std::static_pointer_cast<RootShadowNode>(
+        oldRootShadowNode.ShadowNode::clone({props}));
+  });
+
+  EXPECT_NE(
+      shadowTree_.getCurrentRevision().rootShadowNode->getChildren().at(0),
+      preparedRootShadowNode->getChildren().at(0));
+  EXPECT_EQ(getViewWidth(), 50);
+}
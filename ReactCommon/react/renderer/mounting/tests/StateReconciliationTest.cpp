@@ -5,7 +5,10 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -167,3 +170,212 @@ TEST(StateReconciliationTest, testStateReconciliation) {
 
   EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state3);
 }
+
+TEST(StateReconciliationTest, testCommitRebasing) {
+  auto builder = simpleComponentBuilder();
+
+  auto shadowNodeAB = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .finalize([](RootShadowNode &shadowNode){
+          shadowNode.sealRecursive();
+        })
+        .children({
+          Element<ViewShadowNode>(),
+          Element<ScrollViewShadowNode>()
+            .reference(shadowNodeAB)
+            .children({
+              Element<ViewShadowNode>()
+            })
+        });
+  // clang-format on
+
+  auto shadowNode = builder.build(element);
+
+  auto &scrollViewComponentDescriptor = shadowNodeAB->getComponentDescriptor();
+  auto &family = shadowNodeAB->getFamily();
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto rootComponentDescriptor =
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr};
+  ShadowTree shadowTree{SurfaceId{11},
+                        LayoutConstraints{},
+                        LayoutContext{},
+                        rootComponentDescriptor,
+                        shadowTreeDelegate,
+                        {}};
+
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            shadowNode->ShadowNode::clone({}));
+      },
+      {true, {}, true});
+
+  auto updateState = [&](State::Shared const &state) {
+    shadowTree.commit([&](RootShadowNode const &oldRootShadowNode) {
+      return std::static_pointer_cast<RootShadowNode>(
+          oldRootShadowNode.cloneTree(
+              family, [&](ShadowNode const &oldShadowNode) {
+                return oldShadowNode.clone(
+                    {ShadowNodeFragment::propsPlaceholder(),
+                     ShadowNodeFragment::childrenPlaceholder(),
+                     state});
+              }));
+    });
+  };
+
+  auto state2 = scrollViewComponentDescriptor.createState(
+      family, std::make_shared<ScrollViewState const>());
+
+  // The transaction performs a concurrent state update during its first
+  // attempt; the failed attempt must be rebased instead of being re-run.
+  auto numberOfTransactionCalls = 0;
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        numberOfTransactionCalls++;
+        if (numberOfTransactionCalls == 1) {
+          updateState(state2);
+        }
+        return std::static_pointer_cast<RootShadowNode>(
+            shadowNode->ShadowNode::clone({}));
+      },
+      {true, {}, true});
+
+  EXPECT_EQ(numberOfTransactionCalls, 1);
+  EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state2);
+  auto telemetry = shadowTree.getCurrentRevision().telemetry;
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 1);
+  EXPECT_GT(telemetry.getWastedLayoutTime(), TelemetryDuration{});
+
+  auto state3 = scrollViewComponentDescriptor.createState(
+      family, std::make_shared<ScrollViewState const>());
+
+  // Without `dependsOnlyOnRootProps`, the transaction is run again.
+  numberOfTransactionCalls = 0;
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        numberOfTransactionCalls++;
+        if (numberOfTransactionCalls == 1) {
+          updateState(state3);
+        }
+        return std::static_pointer_cast<RootShadowNode>(
+            shadowNode->ShadowNode::clone({}));
+      },
+      {true});
+
+  EXPECT_EQ(numberOfTransactionCalls, 2);
+  EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), state3);
+}
+
+TEST(StateReconciliationTest, testConcurrentStateUpdatesAndCommits) {
+  auto builder = simpleComponentBuilder();
+
+  auto shadowNodeAB = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .finalize([](RootShadowNode &shadowNode){
+          shadowNode.sealRecursive();
+        })
+        .children({
+          Element<ScrollViewShadowNode>()
+            .reference(shadowNodeAB)
+            .children({
+              Element<ViewShadowNode>(),
+              Element<ViewShadowNode>()
+            })
+        });
+  // clang-format on
+
+  auto shadowNode = builder.build(element);
+
+  auto &scrollViewComponentDescriptor = shadowNodeAB->getComponentDescriptor();
+  auto &family = shadowNodeAB->getFamily();
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto rootComponentDescriptor =
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr};
+  ShadowTree shadowTree{SurfaceId{11},
+                        LayoutConstraints{},
+                        LayoutContext{},
+                        rootComponentDescriptor,
+                        shadowTreeDelegate,
+                        {}};
+
+  auto const numberOfCommits = 200;
+  auto numberOfTransactionCalls = 0;
+  auto lastState = State::Shared{};
+
+  // Telemetry of all revisions observed by both threads. The current revision
+  // read after a commit might be a commit of the other thread already, so the
+  // telemetry is checked per revision, not per thread.
+  std::mutex telemetryMutex;
+  auto telemetries = std::map<ShadowTreeRevision::Number, TransactionTelemetry>{};
+  auto recordTelemetry = [&]() {
+    auto revision = shadowTree.getCurrentRevision();
+    std::lock_guard<std::mutex> lock(telemetryMutex);
+    telemetries.emplace(revision.number, revision.telemetry);
+  };
+
+  auto commitJavaScriptTree = [&]() {
+    shadowTree.commit(
+        [&](RootShadowNode const &oldRootShadowNode) {
+          numberOfTransactionCalls++;
+          return std::static_pointer_cast<RootShadowNode>(
+              shadowNode->ShadowNode::clone({}));
+        },
+        {true, {}, true});
+  };
+
+  // State updates can only be committed once the scroll view is in the tree.
+  commitJavaScriptTree();
+
+  // Native state updates (e.g. scroll position updates).
+  auto stateUpdatesThread = std::thread([&]() {
+    for (auto i = 0; i < numberOfCommits; i++) {
+      auto state = scrollViewComponentDescriptor.createState(
+          family, std::make_shared<ScrollViewState const>());
+      shadowTree.commit([&](RootShadowNode const &oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            oldRootShadowNode.cloneTree(
+                family, [&](ShadowNode const &oldShadowNode) {
+                  return oldShadowNode.clone(
+                      {ShadowNodeFragment::propsPlaceholder(),
+                       ShadowNodeFragment::childrenPlaceholder(),
+                       state});
+                }));
+      });
+      recordTelemetry();
+      lastState = state;
+    }
+  });
+
+  // JavaScript commits.
+  for (auto i = 0; i < numberOfCommits; i++) {
+    commitJavaScriptTree();
+    recordTelemetry();
+  }
+
+  stateUpdatesThread.join();
+
+  // Rebasing never re-runs JavaScript transactions, regardless of the number
+  // of conflicts.
+  EXPECT_EQ(numberOfTransactionCalls, numberOfCommits + 1);
+  EXPECT_EQ(findDescendantNode(shadowTree, family)->getState(), lastState);
+
+  // Every failed attempt of one thread is caused by a distinct commit of the
+  // other one, and time is wasted only on layouts of failed attempts.
+  auto numberOfCommitRetries = 0;
+  for (auto const &pair : telemetries) {
+    auto const &telemetry = pair.second;
+    numberOfCommitRetries += telemetry.getNumberOfCommitRetries();
+    if (telemetry.getNumberOfCommitRetries() == 0) {
+      EXPECT_EQ(telemetry.getWastedLayoutTime(), TelemetryDuration{});
+    }
+  }
+  EXPECT_LE(numberOfCommitRetries, 2 * numberOfCommits + 1);
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// 200 rows of 25 nodes each: 5000 nodes (plus the root and the scroll view).
+static constexpr int kNumberOfRows = 200;
+static constexpr int kNumberOfCellsPerRow = 24;
+
+class CommitRebasingShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override {}
+};
+
+/*
+ * A scroll view with rows of cells.
+ */
+static ShadowNode::Shared buildScrollView(ComponentBuilder &builder) {
+  auto tag = Tag{3};
+  auto rows = std::vector<ElementFragment>{};
+  for (int row = 0; row < kNumberOfRows; row++) {
+    auto cells = std::vector<ElementFragment>{};
+    for (int cell = 0; cell < kNumberOfCellsPerRow; cell++) {
+      cells.push_back(Element<ViewShadowNode>().tag(tag++).props([] {
+        auto sharedProps = std::make_shared<ViewProps>();
+        auto &yogaStyle = sharedProps->yogaStyle;
+        yogaStyle.flex() = YGFloatOptional{1};
+        yogaStyle.margin()[YGEdgeAll] = YGValue{2, YGUnitPoint};
+        return sharedProps;
+      }));
+    }
+    rows.push_back(Element<ViewShadowNode>()
+                       .tag(tag++)
+                       .props([] {
+                         auto sharedProps = std::make_shared<ViewProps>();
+                         auto &yogaStyle = sharedProps->yogaStyle;
+                         yogaStyle.flexDirection() = YGFlexDirectionRow;
+                         yogaStyle.dimensions()[YGDimensionHeight] =
+                             YGValue{44, YGUnitPoint};
+                         return sharedProps;
+                       })
+                       .children(cells));
+  }
+
+  return builder.build(
+      Element<ScrollViewShadowNode>().tag(2).children(rows));
+}
+
+/*
+ * Clones a given subtree (as JavaScript does with a new tree of the same
+ * families) with a given margin, so the whole subtree has to be laid out
+ * again.
+ */
+static ShadowNode::Unshared cloneWithMargin(
+    ShadowNode const &shadowNode,
+    Float margin) {
+  auto children = ShadowNode::ListOfShared{};
+  for (auto const &childNode : shadowNode.getChildren()) {
+    children.push_back(cloneWithMargin(*childNode, margin));
+  }
+
+  auto props = shadowNode.getComponentDescriptor().cloneProps(
+      shadowNode.getProps(), RawProps{});
+  auto &viewProps =
+      const_cast<ViewProps &>(static_cast<ViewProps const &>(*props));
+  viewProps.yogaStyle.margin()[YGEdgeAll] = YGValue{margin, YGUnitPoint};
+
+  return shadowNode.clone(
+      {props, std::make_shared<ShadowNode::ListOfShared const>(children)});
+}
+
+/*
+ * Commits a new JavaScript tree of 5000 nodes per iteration (as
+ * `UIManager::completeSurface` does). During its first attempt, a state
+ * update of the scroll view (e.g. a scroll position update) is committed, so
+ * the attempt fails. The argument enables `dependsOnlyOnRootProps`, which
+ * rebases the failed attempt instead of running the transaction and the
+ * layout again.
+ */
+static void commitConflictingWithStateUpdate(benchmark::State &state) {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, nullptr, nullptr});
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ScrollViewComponentDescriptor>());
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto rootComponentDescriptor = RootComponentDescriptor{
+      ComponentDescriptorParameters{EventDispatcher::Shared{}, nullptr, nullptr}};
+  auto shadowTreeDelegate = CommitRebasingShadowTreeDelegate{};
+  ShadowTree shadowTree{SurfaceId{1},
+                        LayoutConstraints{{375, 0}, {375, 100000}},
+                        LayoutContext{},
+                        rootComponentDescriptor,
+                        shadowTreeDelegate,
+                        {}};
+
+  auto commitOptions = ShadowTree::CommitOptions{};
+  commitOptions.enableStateReconciliation = true;
+  commitOptions.dependsOnlyOnRootProps = state.range(0) != 0;
+
+  auto commitJavaScriptTree = [&](ShadowNode::Shared const &scrollViewNode,
+                                  std::function<void()> const &callback) {
+    shadowTree.commit(
+        [&](RootShadowNode const &oldRootShadowNode) {
+          callback();
+          return std::make_shared<RootShadowNode>(
+              oldRootShadowNode,
+              ShadowNodeFragment{
+                  /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+                  /* .children = */
+                  std::make_shared<SharedShadowNodeList>(
+                      SharedShadowNodeList{scrollViewNode}),
+              });
+        },
+        commitOptions);
+  };
+
+  auto scrollViewNode = buildScrollView(builder);
+  commitJavaScriptTree(scrollViewNode, [] {});
+
+  auto const &family = scrollViewNode->getFamily();
+  auto const &scrollViewComponentDescriptor =
+      scrollViewNode->getComponentDescriptor();
+
+  auto iteration = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    scrollViewNode = cloneWithMargin(*scrollViewNode, ++iteration % 2 + 2);
+    auto scrollViewState = scrollViewComponentDescriptor.createState(
+        family, std::make_shared<ScrollViewState const>());
+    auto numberOfTransactionCalls = 0;
+    state.ResumeTiming();
+
+    commitJavaScriptTree(scrollViewNode, [&] {
+      if (++numberOfTransactionCalls != 1) {
+        return;
+      }
+      shadowTree.commit([&](RootShadowNode const &oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            oldRootShadowNode.cloneTree(
+                family, [&](ShadowNode const &oldShadowNode) {
+                  return oldShadowNode.clone(
+                      {ShadowNodeFragment::propsPlaceholder(),
+                       ShadowNodeFragment::childrenPlaceholder(),
+                       scrollViewState});
+                }));
+      });
+    });
+  }
+}
+BENCHMARK(commitConflictingWithStateUpdate)
+    ->ArgName("rebased")
+    ->Arg(0)
+    ->Arg(1);
+
+} // namespace react
+} // namespace facebook
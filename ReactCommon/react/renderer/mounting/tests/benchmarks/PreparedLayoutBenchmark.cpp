@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// 200 sections of 25 nodes each: 5000 nodes (plus the root and the list).
+static constexpr int kNumberOfSections = 200;
+static constexpr int kNumberOfChipsPerSection = 24;
+
+class PreparedLayoutShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override {}
+};
+
+/*
+ * A list of sections with wrapping rows of chips of different widths: the
+ * number of lines (and so the layout of the whole list) depends on the width
+ * of the surface.
+ */
+static ShadowNode::Shared buildList(ComponentBuilder &builder) {
+  auto tag = Tag{3};
+  auto sections = std::vector<ElementFragment>{};
+  for (int section = 0; section < kNumberOfSections; section++) {
+    auto chips = std::vector<ElementFragment>{};
+    for (int chip = 0; chip < kNumberOfChipsPerSection; chip++) {
+      auto width = Float(40 + (section + chip * 7) % 50);
+      chips.push_back(Element<ViewShadowNode>().tag(tag++).props([=] {
+        auto sharedProps = std::make_shared<ViewProps>();
+        auto &yogaStyle = sharedProps->yogaStyle;
+        yogaStyle.dimensions()[YGDimensionWidth] = YGValue{width, YGUnitPoint};
+        yogaStyle.dimensions()[YGDimensionHeight] = YGValue{24, YGUnitPoint};
+        yogaStyle.margin()[YGEdgeAll] = YGValue{4, YGUnitPoint};
+        return sharedProps;
+      }));
+    }
+    sections.push_back(Element<ViewShadowNode>()
+                           .tag(tag++)
+                           .props([] {
+                             auto sharedProps = std::make_shared<ViewProps>();
+                             auto &yogaStyle = sharedProps->yogaStyle;
+                             yogaStyle.flexDirection() = YGFlexDirectionRow;
+                             yogaStyle.flexWrap() = YGWrapWrap;
+                             yogaStyle.padding()[YGEdgeAll] =
+                                 YGValue{12, YGUnitPoint};
+                             return sharedProps;
+                           })
+                           .children(chips));
+  }
+
+  return builder.build(Element<ViewShadowNode>().tag(2).children(sections));
+}
+
+/*
+ * Commits a change of the layout constraints of a surface of 5000 nodes per
+ * iteration, toggling between the portrait and landscape widths (as
+ * `Scheduler::constraintSurfaceLayout` does on rotation). The argument
+ * enables laying out the other orientation in advance with
+ * `ShadowTree::prepareLayout`, which is not measured (it is meant to run on a
+ * background thread before the change).
+ */
+static void constraintSurfaceLayout(benchmark::State &state) {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              EventDispatcher::Shared{}, nullptr, nullptr});
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto rootComponentDescriptor = RootComponentDescriptor{
+      ComponentDescriptorParameters{EventDispatcher::Shared{}, nullptr, nullptr}};
+  auto shadowTreeDelegate = PreparedLayoutShadowTreeDelegate{};
+  auto layoutConstraints = std::vector<LayoutConstraints>{
+      {{375, 0}, {375, 100000}},
+      {{812, 0}, {812, 100000}},
+  };
+  ShadowTree shadowTree{SurfaceId{1},
+                        layoutConstraints[0],
+                        LayoutContext{},
+                        rootComponentDescriptor,
+                        shadowTreeDelegate,
+                        {}};
+
+  auto listShadowNode = buildList(builder);
+  shadowTree.commit([&](RootShadowNode const &oldRootShadowNode) {
+    return std::make_shared<RootShadowNode>(
+        oldRootShadowNode,
+        ShadowNodeFragment{
+            /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+            /* .children = */
+            std::make_shared<SharedShadowNodeList>(
+                SharedShadowNodeList{listShadowNode}),
+        });
+  });
+
+  auto shouldPrepare = state.range(0) != 0;
+  auto iteration = size_t{0};
+  for (auto _ : state) {
+    auto const &nextLayoutConstraints =
+        layoutConstraints[++iteration % layoutConstraints.size()];
+
+    if (shouldPrepare) {
+      state.PauseTiming();
+      shadowTree.prepareLayout(nextLayoutConstraints, LayoutContext{});
+      state.ResumeTiming();
+    }
+
+    shadowTree.commit([&](RootShadowNode const &oldRootShadowNode) {
+      return oldRootShadowNode.clone(nextLayoutConstraints, LayoutContext{});
+    });
+  }
+}
+BENCHMARK(constraintSurfaceLayout)->ArgName("prepared")->Arg(0)->Arg(1);
+
+} // namespace react
+} // namespace facebook
@@ -32,6 +32,7 @@ Scheduler::Scheduler(
     UIManagerAnimationDelegate *animationDelegate,
     SchedulerDelegate *delegate) {
   runtimeExecutor_ = schedulerToolbox.runtimeExecutor;
+  backgroundExecutor_ = schedulerToolbox.backgroundExecutor;
 
   reactNativeConfig_ =
       schedulerToolbox.contextContainer
@@ -48,7 +49,7 @@ Scheduler::Scheduler(
   auto eventPipe = [uiManager](
                        jsi::Runtime &runtime,
                        const EventTarget *eventTarget,
-                       const std::string &type,
+                       const EventType &type,
                        const ValueFactory &payloadFactory) {
     uiManager->visitBinding([&](UIManagerBinding const &uiManagerBinding) {
       uiManagerBinding.dispatchEvent(
@@ -178,8 +179,8 @@ void Scheduler::startSurface(
     const folly::dynamic &initialProps,
     const LayoutConstraints &layoutConstraints,
     const LayoutContext &layoutContext,
-    std::weak_ptr<MountingOverrideDelegate const> mountingOverrideDelegate)
-    const {
+    std::weak_ptr<MountingOverrideDelegate const> mountingOverrideDelegate,
+    YogaLayoutSnapshot::Shared layoutSnapshot) const {
   SystraceSection s("Scheduler::startSurface");
 
   auto shadowTree = std::make_unique<ShadowTree>(
@@ -190,6 +191,10 @@ void Scheduler::startSurface(
       *uiManager_,
       mountingOverrideDelegate);
 
+  if (layoutSnapshot) {
+    shadowTree->restoreLayoutSnapshotOnNextCommit(std::move(layoutSnapshot));
+  }
+
   auto uiManager = uiManager_;
 
   uiManager->getShadowTreeRegistry().add(std::move(shadowTree));
@@ -268,6 +273,18 @@ void Scheduler::stopSurface(SurfaceId surfaceId) const {
   });
 }
 
+YogaLayoutSnapshot Scheduler::takeSurfaceLayoutSnapshot(
+    SurfaceId surfaceId) const {
+  SystraceSection s("Scheduler::takeSurfaceLayoutSnapshot");
+
+  auto layoutSnapshot = YogaLayoutSnapshot{};
+  uiManager_->getShadowTreeRegistry().visit(
+      surfaceId, [&](const ShadowTree &shadowTree) {
+        layoutSnapshot = shadowTree.takeLayoutSnapshot();
+      });
+  return layoutSnapshot;
+}
+
 Size Scheduler::measureSurface(
     SurfaceId surfaceId,
     const LayoutConstraints &layoutConstraints,
@@ -275,11 +292,18 @@ Size Scheduler::measureSurface(
   SystraceSection s("Scheduler::measureSurface");
 
   auto currentRootShadowNode = RootShadowNode::Shared{};
+  auto preparedRootShadowNode = RootShadowNode::Shared{};
   uiManager_->getShadowTreeRegistry().visit(
       surfaceId, [&](const ShadowTree &shadowTree) {
         currentRootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+        preparedRootShadowNode =
+            shadowTree.getPreparedLayout(layoutConstraints, layoutContext);
       });
 
+  if (preparedRootShadowNode) {
+    return preparedRootShadowNode->getLayoutMetrics().frame.size;
+  }
+
   auto rootShadowNode =
       currentRootShadowNode->clone(layoutConstraints, layoutContext);
   rootShadowNode->layoutIfNeeded();
@@ -310,6 +334,29 @@ void Scheduler::constraintSurfaceLayout(
       });
 }
 
+void Scheduler::prepareSurfaceLayout(
+    SurfaceId surfaceId,
+    const LayoutConstraints &layoutConstraints,
+    const LayoutContext &layoutContext) const {
+  SystraceSection s("Scheduler::prepareSurfaceLayout");
+
+  auto uiManager = uiManager_;
+  auto prepareLayout = [=] {
+    // Laying out takes a while, so the `ShadowTree` is not visited to not
+    // block stopping of the surface in the meantime.
+    auto shadowTree = uiManager->getShadowTreeRegistry().find(surfaceId);
+    if (shadowTree) {
+      shadowTree->prepareLayout(layoutConstraints, layoutContext);
+    }
+  };
+
+  if (backgroundExecutor_) {
+    backgroundExecutor_(prepareLayout);
+  } else {
+    prepareLayout();
+  }
+}
+
 ComponentDescriptor const *
 Scheduler::findComponentDescriptorByHandle_DO_NOT_USE_THIS_IS_BROKEN(
     ComponentHandle handle) const {
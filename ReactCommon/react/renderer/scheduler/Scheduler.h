@@ -14,6 +14,7 @@
 #include <react/config/ReactNativeConfig.h>
 #include <react/renderer/componentregistry/ComponentDescriptorFactory.h>
 #include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/YogaLayoutSnapshot.h>
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
@@ -47,7 +48,8 @@ class Scheduler final : public UIManagerDelegate {
       const LayoutConstraints &layoutConstraints = {},
       const LayoutContext &layoutContext = {},
       std::weak_ptr<MountingOverrideDelegate const> mountingOverrideDelegate =
-          {}) const;
+          {},
+      YogaLayoutSnapshot::Shared layoutSnapshot = {}) const;
 
   void renderTemplateToSurface(
       SurfaceId surfaceId,
@@ -55,6 +57,15 @@ class Scheduler final : public UIManagerDelegate {
 
   void stopSurface(SurfaceId surfaceId) const;
 
+  /*
+   * Takes a snapshot of the layout of a Surface, which can be passed to
+   * `startSurface` when the Surface is started again to skip laying out the
+   * parts of the first tree that stay the same.
+   * Must be called before `stopSurface`.
+   * Can be called from any thread.
+   */
+  YogaLayoutSnapshot takeSurfaceLayoutSnapshot(SurfaceId surfaceId) const;
+
   Size measureSurface(
       SurfaceId surfaceId,
       const LayoutConstraints &layoutConstraints,
@@ -72,6 +83,21 @@ class Scheduler final : public UIManagerDelegate {
       const LayoutConstraints &layoutConstraints,
       const LayoutContext &layoutContext) const;
 
+  /*
+   * Lays out a Surface with given `layoutConstraints` and `layoutContext`
+   * which it is likely to get soon (e.g. after a rotation or when the keyboard
+   * appears) in advance, using the background executor if there is one.
+   * A subsequent `constraintSurfaceLayout` (or `measureSurface`) call with
+   * the same `layoutConstraints` and `layoutContext` reuses the result unless
+   * something else was committed to the Surface in the meantime.
+   * Can be called from any thread, but the background executor runs the work
+   * synchronously if the method is called on the main thread.
+   */
+  void prepareSurfaceLayout(
+      SurfaceId surfaceId,
+      const LayoutConstraints &layoutConstraints,
+      const LayoutContext &layoutContext) const;
+
   /*
    * This is broken. Please do not use.
    * `ComponentDescriptor`s are not designed to be used outside of `UIManager`,
@@ -122,6 +148,7 @@ class Scheduler final : public UIManagerDelegate {
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   std::unique_ptr<const RootComponentDescriptor> rootComponentDescriptor_;
   RuntimeExecutor runtimeExecutor_;
+  BackgroundExecutor backgroundExecutor_;
   std::shared_ptr<UIManager> uiManager_;
   std::shared_ptr<const ReactNativeConfig> reactNativeConfig_;
 
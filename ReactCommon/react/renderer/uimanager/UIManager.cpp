@@ -96,6 +96,10 @@ void UIManager::completeSurface(
     ShadowTree::CommitOptions commitOptions) const {
   SystraceSection s("UIManager::completeSurface");
 
+  // The new tree consists of the given children and the props of the old root
+  // node only.
+  commitOptions.dependsOnlyOnRootProps = true;
+
   shadowTreeRegistry_.visit(surfaceId, [&](ShadowTree const &shadowTree) {
     shadowTree.commit(
         [&](RootShadowNode const &oldRootShadowNode) {
@@ -199,6 +203,82 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
       shadowNode.getFamily(), *layoutableAncestorShadowNode, policy);
 }
 
+std::vector<LayoutMetrics> UIManager::getRelativeLayoutMetrics(
+    ShadowNode::ListOfShared const &shadowNodes,
+    ShadowNode const *ancestorShadowNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) const {
+  SystraceSection s("UIManager::getRelativeLayoutMetrics (batch)");
+
+  auto results = std::vector<LayoutMetrics>(
+      shadowNodes.size(), EmptyLayoutMetrics);
+
+  // Groups node indices by the ancestor the nodes are measured against:
+  // either the newest clone of `ancestorShadowNode` or the root node of the
+  // surface the node belongs to.
+  struct Batch {
+    ShadowNode::Shared ancestorShadowNode;
+    std::vector<ShadowNodeFamily const *> families;
+    std::vector<size_t> indices;
+  };
+
+  auto batches = better::map<SurfaceId, Batch>{};
+
+  auto owningAncestorShadowNode = ShadowNode::Shared{};
+  if (ancestorShadowNode) {
+    // See the non-batched version for why the newest clone is used.
+    owningAncestorShadowNode = getNewestCloneOfShadowNode(*ancestorShadowNode);
+    if (!owningAncestorShadowNode) {
+      return results;
+    }
+  }
+
+  for (size_t i = 0; i < shadowNodes.size(); i++) {
+    auto const &shadowNode = shadowNodes[i];
+    if (!shadowNode) {
+      continue;
+    }
+
+    auto surfaceId = shadowNode->getSurfaceId();
+    auto iterator = batches.find(surfaceId);
+    if (iterator == batches.end()) {
+      auto batch = Batch{};
+      if (owningAncestorShadowNode) {
+        batch.ancestorShadowNode = owningAncestorShadowNode;
+      } else {
+        shadowTreeRegistry_.visit(
+            surfaceId, [&](ShadowTree const &shadowTree) {
+              batch.ancestorShadowNode =
+                  shadowTree.getCurrentRevision().rootShadowNode;
+            });
+      }
+      iterator = batches.emplace(surfaceId, std::move(batch)).first;
+    }
+
+    iterator->second.families.push_back(&shadowNode->getFamily());
+    iterator->second.indices.push_back(i);
+  }
+
+  for (auto const &pair : batches) {
+    auto const &batch = pair.second;
+    auto layoutableAncestorShadowNode =
+        traitCast<LayoutableShadowNode const *>(batch.ancestorShadowNode.get());
+
+    if (!layoutableAncestorShadowNode) {
+      continue;
+    }
+
+    auto layoutMetricsList =
+        LayoutableShadowNode::computeRelativeLayoutMetrics(
+            batch.families, *layoutableAncestorShadowNode, policy);
+
+    for (size_t i = 0; i < batch.indices.size(); i++) {
+      results[batch.indices[i]] = layoutMetricsList[i];
+    }
+  }
+
+  return results;
+}
+
 void UIManager::updateStateWithAutorepeat(
     StateUpdate const &stateUpdate) const {
   auto &callback = stateUpdate.callback;
@@ -126,6 +126,18 @@ class UIManager final : public ShadowTreeDelegate {
       ShadowNode const *ancestorShadowNode,
       LayoutableShadowNode::LayoutInspectingPolicy policy) const;
 
+  /*
+   * Batched version of `getRelativeLayoutMetrics`.
+   * The most recently committed revision of every involved surface is
+   * retrieved only once for the whole batch and ancestor chains shared by the
+   * nodes are traversed once. The result has the same size and order as
+   * `shadowNodes`.
+   */
+  std::vector<LayoutMetrics> getRelativeLayoutMetrics(
+      ShadowNode::ListOfShared const &shadowNodes,
+      ShadowNode const *ancestorShadowNode,
+      LayoutableShadowNode::LayoutInspectingPolicy policy) const;
+
   /*
    * Creates a new shadow node with given state data, clones what's necessary
    * and performs a commit.
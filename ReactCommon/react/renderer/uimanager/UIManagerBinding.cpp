@@ -12,6 +12,9 @@
 #include <glog/logging.h>
 #include <jsi/JSIDynamic.h>
 
+#include <cmath>
+#include <limits>
+
 namespace facebook {
 namespace react {
 
@@ -134,11 +137,16 @@ void UIManagerBinding::stopSurface(jsi::Runtime &runtime, SurfaceId surfaceId)
 void UIManagerBinding::dispatchEvent(
     jsi::Runtime &runtime,
     EventTarget const *eventTarget,
-    std::string const &type,
+    EventType const &type,
     ValueFactory const &payloadFactory) const {
   SystraceSection s("UIManagerBinding::dispatchEvent");
 
-  auto payload = payloadFactory(runtime);
+  auto payload = jsi::Value{};
+  {
+    EventPayloadPropNames::ThreadLocalScope propNamesScope{
+        eventPayloadPropNames_};
+    payload = payloadFactory(runtime);
+  }
 
   // If a payload is null, the factory has decided to cancel the event
   if (payload.isNull()) {
@@ -157,7 +165,10 @@ void UIManagerBinding::dispatchEvent(
         LOG(ERROR) << "payload for dispatchEvent is not an object: " << eventTarget->getTag();
       }
       assert(payload.isObject());
-      payload.asObject(runtime).setProperty(runtime, "target", eventTarget->getTag());
+      payload.asObject(runtime).setProperty(
+          runtime,
+          eventPayloadPropNames_.get(runtime, EventPayloadKey::Target),
+          eventTarget->getTag());
       return instanceHandle;
     }()
     : jsi::Value::null();
@@ -168,10 +179,27 @@ void UIManagerBinding::dispatchEvent(
   eventHandlerWrapper.callback.call(
       runtime,
       {std::move(instanceHandle),
-       jsi::String::createFromUtf8(runtime, type),
+       jsi::Value(runtime, getEventTypeName(runtime, type)),
        std::move(payload)});
 }
 
+jsi::String const &UIManagerBinding::getEventTypeName(
+    jsi::Runtime &runtime,
+    EventType const &type) const {
+  auto id = type.getId();
+  if (id >= eventTypeNames_.size()) {
+    eventTypeNames_.resize(id + 1);
+  }
+
+  auto &name = eventTypeNames_[id];
+  if (!name) {
+    name = std::make_unique<jsi::String>(
+        jsi::String::createFromUtf8(runtime, type.getName()));
+  }
+
+  return *name;
+}
+
 void UIManagerBinding::invalidate() const {
   uiManager_->setDelegate(nullptr);
 }
@@ -179,7 +207,9 @@ void UIManagerBinding::invalidate() const {
 jsi::Value UIManagerBinding::get(
     jsi::Runtime &runtime,
     jsi::PropNameID const &name) {
-  auto methodName = name.utf8(runtime);
+  // Reused across calls to avoid allocating a string on every lookup.
+  static thread_local std::string methodName;
+  name.utf8(runtime, methodName);
 
   // Convert shared_ptr<UIManager> to a raw ptr
   // Why? Because:
@@ -528,6 +558,106 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Semantic: Computes layout metrics of all nodes in the given array
+  // relatively to `ancestorNode` (or to the root node if `ancestorNode` is
+  // `null`) and writes `left`, `top`, `width` and `height` of every node into
+  // the given preallocated `Float64Array` (four elements per node). Metrics of
+  // nodes that cannot be measured are written as `NaN`s. Returns the number
+  // of nodes written. Throws if the array is not a `Float64Array`.
+  if (methodName == "getRelativeLayoutMetricsBatch") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        4,
+        [uiManager](
+            jsi::Runtime & runtime,
+            jsi::Value const &thisValue,
+            jsi::Value const *arguments,
+            size_t count) -> jsi::Value {
+          if (count < 3 || !arguments[0].isObject() ||
+              !arguments[2].isObject()) {
+            throw jsi::JSError(
+                runtime,
+                "getRelativeLayoutMetricsBatch: expected an array of nodes, "
+                "an ancestor node (or null) and a Float64Array");
+          }
+
+          // The result is written through raw memory: the array must be an
+          // aligned view of 8-byte elements which lies within its buffer.
+          auto resultArray = arguments[2].getObject(runtime);
+          auto bytesPerElement =
+              resultArray.getProperty(runtime, "BYTES_PER_ELEMENT");
+          auto byteOffsetValue = resultArray.getProperty(runtime, "byteOffset");
+          auto lengthValue = resultArray.getProperty(runtime, "length");
+          auto bufferValue = resultArray.getProperty(runtime, "buffer");
+          if (!bytesPerElement.isNumber() ||
+              bytesPerElement.getNumber() != sizeof(double) ||
+              !byteOffsetValue.isNumber() || !lengthValue.isNumber() ||
+              !bufferValue.isObject() ||
+              !bufferValue.getObject(runtime).isArrayBuffer(runtime)) {
+            throw jsi::JSError(
+                runtime,
+                "getRelativeLayoutMetricsBatch: "
+                "the result must be a Float64Array");
+          }
+          auto arrayBuffer =
+              bufferValue.getObject(runtime).getArrayBuffer(runtime);
+          auto byteLength = (double)arrayBuffer.size(runtime);
+          auto byteOffset = byteOffsetValue.getNumber();
+          auto length = lengthValue.getNumber();
+          if (!(byteOffset >= 0 && length >= 0 &&
+                std::fmod(byteOffset, sizeof(double)) == 0 &&
+                byteOffset + length * sizeof(double) <= byteLength)) {
+            throw jsi::JSError(
+                runtime,
+                "getRelativeLayoutMetricsBatch: "
+                "the result array exceeds its buffer");
+          }
+
+          auto nodesArray = arguments[0].getObject(runtime).getArray(runtime);
+          auto size = nodesArray.size(runtime);
+
+          auto shadowNodes = ShadowNode::ListOfShared{};
+          shadowNodes.reserve(size);
+          for (size_t i = 0; i < size; i++) {
+            shadowNodes.push_back(shadowNodeFromValue(
+                runtime, nodesArray.getValueAtIndex(runtime, i)));
+          }
+
+          auto ancestorShadowNode = arguments[1].isObject()
+              ? shadowNodeFromValue(runtime, arguments[1])
+              : ShadowNode::Shared{};
+          auto includeViewportOffset =
+              count > 3 && arguments[3].isBool() && arguments[3].getBool();
+
+          auto layoutMetricsList = uiManager->getRelativeLayoutMetrics(
+              shadowNodes,
+              ancestorShadowNode.get(),
+              {/* .includeTransform = */ true, includeViewportOffset});
+
+          auto data = reinterpret_cast<double *>(
+              arrayBuffer.data(runtime) + (size_t)byteOffset);
+
+          auto resultCount =
+              std::min(layoutMetricsList.size(), (size_t)length / 4);
+          for (size_t i = 0; i < resultCount; i++) {
+            auto const &layoutMetrics = layoutMetricsList[i];
+            auto frame = layoutMetrics.frame;
+            if (layoutMetrics == EmptyLayoutMetrics) {
+              data[i * 4 + 0] = data[i * 4 + 1] = data[i * 4 + 2] =
+                  data[i * 4 + 3] = std::numeric_limits<double>::quiet_NaN();
+              continue;
+            }
+            data[i * 4 + 0] = (double)frame.origin.x;
+            data[i * 4 + 1] = (double)frame.origin.y;
+            data[i * 4 + 2] = (double)frame.size.width;
+            data[i * 4 + 3] = (double)frame.size.height;
+          }
+
+          return jsi::Value{(double)resultCount};
+        });
+  }
+
   if (methodName == "dispatchCommand") {
     return jsi::Function::createFromHostFunction(
         runtime,
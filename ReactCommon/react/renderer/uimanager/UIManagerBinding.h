@@ -9,6 +9,8 @@
 
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
+#include <react/renderer/core/EventPayload.h>
+#include <react/renderer/core/EventType.h>
 #include <react/renderer/core/RawValue.h>
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/primitives.h>
@@ -63,7 +65,7 @@ class UIManagerBinding : public jsi::HostObject {
   void dispatchEvent(
       jsi::Runtime &runtime,
       EventTarget const *eventTarget,
-      std::string const &type,
+      EventType const &type,
       ValueFactory const &payloadFactory) const;
 
   /*
@@ -81,8 +83,20 @@ class UIManagerBinding : public jsi::HostObject {
   jsi::Value get(jsi::Runtime &runtime, jsi::PropNameID const &name) override;
 
  private:
+  /*
+   * Returns a JavaScript string with the name of a given event type, creating
+   * it only once per event type.
+   */
+  jsi::String const &getEventTypeName(
+      jsi::Runtime &runtime,
+      EventType const &type) const;
+
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<EventHandler const> eventHandler_;
+
+  // Indexed by `EventType::getId()`. Only accessed on the JavaScript thread.
+  mutable std::vector<std::unique_ptr<jsi::String>> eventTypeNames_;
+  mutable EventPayloadPropNames eventPayloadPropNames_;
 };
 
 } // namespace react
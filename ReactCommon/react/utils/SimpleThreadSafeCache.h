@@ -27,19 +27,28 @@ class SimpleThreadSafeCache {
    * Returns a value from the map with a given key.
    * If the value wasn't found in the cache, constructs the value using given
    * generator function, stores it inside a cache and returns it.
-   * Can be called from any thread.
+   * Can be called from any thread. The generator is called without holding
+   * the lock, so concurrent lookups of different keys don't wait for each
+   * other.
+   * Concurrent lookups of the same key may both call the generator, and the
+   * value stored last wins. This is fine for generators which return equal
+   * values for equal keys (text measurements, converted attributed strings):
+   * both callers get a correct value and only the work is done twice.
+   * Generators which must run once per key must not rely on this cache.
    */
   ValueT get(const KeyT &key, std::function<ValueT(const KeyT &key)> generator)
       const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto iterator = map_.find(key);
-    if (iterator == map_.end()) {
-      auto value = generator(key);
-      map_.set(key, value);
-      return value;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto iterator = map_.find(key);
+      if (iterator != map_.end()) {
+        return iterator->second;
+      }
     }
 
-    return iterator->second;
+    auto value = generator(key);
+    set(key, value);
+    return value;
   }
 
   /*
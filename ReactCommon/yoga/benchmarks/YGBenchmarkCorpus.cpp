@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YGBenchmarkCorpus.h"
+
+namespace facebook {
+namespace yoga {
+namespace benchmark {
+
+namespace {
+
+// A social feed: a navigation bar and posts with a header, text of varying
+// length, a photo and a bar of actions.
+const char kFeed[] = R"(
+view width=375 height=812 flex-direction=column
+  view height=44 flex-direction=row align-items=center padding-horizontal=16
+    view width=24 height=24
+    text chars=4 flex-grow=1 margin-horizontal=12
+    view width=24 height=24
+    view width=24 height=24 margin-left=16
+  view flex-grow=1 flex-shrink=1 overflow=scroll
+    view flex-direction=column repeat=40
+      view flex-direction=row align-items=center padding=12
+        view width=40 height=40 margin-right=8
+        view flex-direction=column flex-grow=1 flex-shrink=1
+          text chars=8-24
+          text chars=6-14 margin-top=2
+        view width=24 height=24
+      text chars=0-280 margin-horizontal=12 margin-bottom=8
+      view width=100% aspect-ratio=1.33
+      view height=44 flex-direction=row align-items=center padding-horizontal=12
+        view flex-direction=row align-items=center margin-right=16 repeat=3
+          view width=20 height=20 margin-right=4
+          text chars=1-4
+        view flex-grow=1
+        view width=20 height=20
+      text chars=20-60 margin-horizontal=12 margin-bottom=12
+      view height=8
+  view height=49 flex-direction=row justify-content=space-around align-items=center
+    view width=28 height=28 repeat=5
+)";
+
+// A photo grid in three columns with a header, wrapping rows of square cells
+// and badges positioned absolutely.
+const char kGrid[] = R"(
+view width=375 height=812 flex-direction=column
+  view height=44 flex-direction=row align-items=center padding-horizontal=16
+    text chars=6 flex-grow=1
+    view width=24 height=24
+  view flex-direction=row padding=16
+    view width=86 height=86 margin-right=24
+    view flex-direction=row flex-grow=1 justify-content=space-around align-items=center
+      view flex-direction=column align-items=center repeat=3
+        text chars=3-5
+        text chars=9
+  view flex-grow=1 flex-shrink=1 overflow=scroll
+    view flex-direction=row flex-wrap=wrap padding=1
+      view width=33.333% aspect-ratio=1 padding=1 repeat=150
+        view flex-grow=1
+          view position=absolute right=6 top=6 width=16 height=16
+)";
+
+// A settings form: sections nest groups of rows several levels deep, every
+// row has a label, an input with a value and an accessory.
+const char kForm[] = R"(
+view width=375 height=812 flex-direction=column
+  view height=44 flex-direction=row align-items=center justify-content=space-between padding-horizontal=16
+    text chars=6
+    text chars=8
+    text chars=4
+  view flex-grow=1 flex-shrink=1 overflow=scroll
+    view flex-direction=column padding=16 repeat=4
+      text chars=12-32 margin-bottom=8
+      view flex-direction=column border=1 padding-left=8
+        view flex-direction=row align-items=center min-height=44 padding-vertical=6 repeat=3
+          text chars=6-18 width=35%
+          view flex-direction=row flex-grow=1 align-items=center
+            view flex-grow=1 flex-shrink=1 min-height=32 padding-horizontal=8 justify-content=center border=1
+              text chars=4-40
+            view width=24 height=24 margin-left=8
+        view flex-direction=column padding-left=12
+          text chars=20-60 margin-vertical=6
+          view flex-direction=row align-items=center min-height=44 repeat=2
+            text chars=6-18 flex-grow=1 flex-shrink=1
+            view width=51 height=31 padding=2
+              view width=27 height=27
+          view flex-direction=column padding-left=12
+            view flex-direction=column padding-left=12
+              view flex-direction=column padding-left=12
+                view flex-direction=row align-items=center min-height=44 repeat=2
+                  text chars=6-18 width=40%
+                  view flex-grow=1 flex-shrink=1 min-height=32 padding-horizontal=8 justify-content=center border=1
+                    text chars=4-40
+                view flex-direction=column padding-left=12
+                  view flex-direction=column padding-left=12
+                    view flex-direction=row flex-wrap=wrap
+                      view padding-horizontal=12 padding-vertical=6 margin=4 border=1 repeat=6
+                        text chars=3-12
+      text chars=40-120 margin-top=8
+  view height=84 flex-direction=row padding=16
+    view flex-grow=1 height=48 justify-content=center align-items=center margin-right=8 border=1
+      text chars=6
+    view flex-grow=1 height=48 justify-content=center align-items=center
+      text chars=4
+)";
+
+// An article: a title, an author byline and paragraphs of text interleaved
+// with quotes and images with captions.
+const char kArticle[] = R"(
+view width=375 height=812 flex-direction=column
+  view height=44 flex-direction=row align-items=center padding-horizontal=16
+    view width=24 height=24
+    view flex-grow=1
+    view width=24 height=24
+  view flex-grow=1 flex-shrink=1 overflow=scroll
+    view flex-direction=column padding-horizontal=20 padding-vertical=16
+      text chars=40-90 margin-bottom=12
+      view flex-direction=row align-items=center margin-bottom=16
+        view width=32 height=32 margin-right=8
+        view flex-direction=column flex-shrink=1
+          text chars=10-20
+          text chars=12-24
+      view flex-direction=column repeat=12
+        text chars=200-900 margin-bottom=12
+        text chars=150-600 margin-bottom=12
+        view flex-direction=row margin-bottom=12
+          view width=3 margin-right=12
+          text chars=60-240 flex-shrink=1
+        view width=100% aspect-ratio=1.78 margin-bottom=4
+        text chars=20-80 margin-bottom=16 align-self=center
+)";
+
+// A wall of tags: several hundred chips of an icon and a label wrapping in a
+// wide row, with many items on every line.
+const char kTags[] = R"(
+view width=1024 height=768 flex-direction=column
+  view height=56 flex-direction=row align-items=center padding-horizontal=24
+    text chars=12 flex-grow=1
+    view width=32 height=32
+  view flex-grow=1 flex-shrink=1 overflow=scroll
+    view flex-direction=row flex-wrap=wrap padding=8
+      view flex-direction=row align-items=center padding-horizontal=8 padding-vertical=4 margin=4 border=1 repeat=400
+        view width=12 height=12 margin-right=4
+        text chars=3-16 flex-shrink=1
+)";
+
+} // namespace
+
+const std::vector<YGBenchmarkCorpusEntry>& YGBenchmarkCorpus() {
+  static const std::vector<YGBenchmarkCorpusEntry> corpus = {
+      {"feed", kFeed},
+      {"grid", kGrid},
+      {"form", kForm},
+      {"article", kArticle},
+      {"tags", kTags},
+  };
+  return corpus;
+}
+
+} // namespace benchmark
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace facebook {
+namespace yoga {
+namespace benchmark {
+
+struct YGBenchmarkCorpusEntry {
+  const char* name;
+  // Serialized tree, see `YGBenchmarkTree`.
+  const char* tree;
+};
+
+// Trees modeled after real-world screens: feeds, grids, deeply nested forms
+// and text-heavy screens.
+const std::vector<YGBenchmarkCorpusEntry>& YGBenchmarkCorpus();
+
+} // namespace benchmark
+} // namespace yoga
+} // namespace facebook
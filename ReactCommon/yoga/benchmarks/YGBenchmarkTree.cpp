@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YGBenchmarkTree.h"
+
+#include <yoga/YGNode.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace facebook {
+namespace yoga {
+namespace benchmark {
+
+namespace {
+
+constexpr float kCharWidth = 7;
+constexpr float kLineHeight = 17;
+constexpr uint32_t kChangedChars = 13;
+
+[[noreturn]] void fail(const std::string& line, const char* message) {
+  fprintf(stderr, "Malformed benchmark tree (%s): %s\n", message, line.c_str());
+  abort();
+}
+
+uint32_t getChars(YGNodeRef node) {
+  return (uint32_t)(uintptr_t) YGNodeGetContext(node);
+}
+
+YGSize measureText(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  const float textWidth = getChars(node) * kCharWidth;
+
+  float measuredWidth = textWidth;
+  if (widthMode == YGMeasureModeExactly ||
+      (widthMode == YGMeasureModeAtMost && width < textWidth)) {
+    measuredWidth = width;
+  }
+
+  const float charsPerLine =
+      std::floor(std::fmax(measuredWidth, kCharWidth) / kCharWidth);
+  float measuredHeight =
+      std::fmax(std::ceil(getChars(node) / charsPerLine), 1) * kLineHeight;
+  if (heightMode == YGMeasureModeExactly ||
+      (heightMode == YGMeasureModeAtMost && height < measuredHeight)) {
+    measuredHeight = height;
+  }
+
+  return {measuredWidth, measuredHeight};
+}
+
+struct Value {
+  float number;
+  YGUnit unit;
+};
+
+Value parseValue(const std::string& line, const std::string& value) {
+  if (value == "auto") {
+    return {YGUndefined, YGUnitAuto};
+  }
+  char* end = nullptr;
+  const float number = std::strtof(value.c_str(), &end);
+  if (end == value.c_str()) {
+    fail(line, "value is not a number");
+  }
+  if (*end == '%' && *(end + 1) == '\0') {
+    return {number, YGUnitPercent};
+  }
+  if (*end != '\0') {
+    fail(line, "value has an unknown unit");
+  }
+  return {number, YGUnitPoint};
+}
+
+using Setter = std::function<void(YGNodeRef, Value)>;
+
+void addEdgeSetters(
+    std::unordered_map<std::string, Setter>& setters,
+    const std::string& name,
+    void (*setPoints)(YGNodeRef, YGEdge, float),
+    void (*setPercent)(YGNodeRef, YGEdge, float),
+    void (*setAuto)(YGNodeRef, YGEdge)) {
+  const std::pair<const char*, YGEdge> edges[] = {
+      {"", YGEdgeAll},
+      {"-left", YGEdgeLeft},
+      {"-top", YGEdgeTop},
+      {"-right", YGEdgeRight},
+      {"-bottom", YGEdgeBottom},
+      {"-start", YGEdgeStart},
+      {"-end", YGEdgeEnd},
+      {"-horizontal", YGEdgeHorizontal},
+      {"-vertical", YGEdgeVertical},
+  };
+  for (const auto& edge : edges) {
+    const YGEdge yogaEdge = edge.second;
+    setters[name + edge.first] = [=](YGNodeRef node, Value value) {
+      if (value.unit == YGUnitPercent && setPercent != nullptr) {
+        setPercent(node, yogaEdge, value.number);
+      } else if (value.unit == YGUnitAuto && setAuto != nullptr) {
+        setAuto(node, yogaEdge);
+      } else {
+        setPoints(node, yogaEdge, value.number);
+      }
+    };
+  }
+}
+
+Setter dimensionSetter(
+    void (*setPoints)(YGNodeRef, float),
+    void (*setPercent)(YGNodeRef, float),
+    void (*setAuto)(YGNodeRef)) {
+  return [=](YGNodeRef node, Value value) {
+    if (value.unit == YGUnitPercent && setPercent != nullptr) {
+      setPercent(node, value.number);
+    } else if (value.unit == YGUnitAuto && setAuto != nullptr) {
+      setAuto(node);
+    } else {
+      setPoints(node, value.number);
+    }
+  };
+}
+
+const std::unordered_map<std::string, Setter>& getSetters() {
+  static const auto setters = [] {
+    std::unordered_map<std::string, Setter> setters;
+    setters["width"] = dimensionSetter(
+        YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
+    setters["height"] = dimensionSetter(
+        YGNodeStyleSetHeight,
+        YGNodeStyleSetHeightPercent,
+        YGNodeStyleSetHeightAuto);
+    setters["min-width"] = dimensionSetter(
+        YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent, nullptr);
+    setters["min-height"] = dimensionSetter(
+        YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent, nullptr);
+    setters["max-width"] = dimensionSetter(
+        YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent, nullptr);
+    setters["max-height"] = dimensionSetter(
+        YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent, nullptr);
+    setters["flex-basis"] = dimensionSetter(
+        YGNodeStyleSetFlexBasis,
+        YGNodeStyleSetFlexBasisPercent,
+        YGNodeStyleSetFlexBasisAuto);
+    setters["flex-grow"] = [](YGNodeRef node, Value value) {
+      YGNodeStyleSetFlexGrow(node, value.number);
+    };
+    setters["flex-shrink"] = [](YGNodeRef node, Value value) {
+      YGNodeStyleSetFlexShrink(node, value.number);
+    };
+    setters["aspect-ratio"] = [](YGNodeRef node, Value value) {
+      YGNodeStyleSetAspectRatio(node, value.number);
+    };
+    addEdgeSetters(
+        setters,
+        "margin",
+        YGNodeStyleSetMargin,
+        YGNodeStyleSetMarginPercent,
+        YGNodeStyleSetMarginAuto);
+    addEdgeSetters(
+        setters,
+        "padding",
+        YGNodeStyleSetPadding,
+        YGNodeStyleSetPaddingPercent,
+        nullptr);
+    addEdgeSetters(setters, "border", YGNodeStyleSetBorder, nullptr, nullptr);
+    const std::pair<const char*, YGEdge> positions[] = {
+        {"left", YGEdgeLeft},
+        {"top", YGEdgeTop},
+        {"right", YGEdgeRight},
+        {"bottom", YGEdgeBottom},
+    };
+    for (const auto& position : positions) {
+      const YGEdge edge = position.second;
+      setters[position.first] = [=](YGNodeRef node, Value value) {
+        if (value.unit == YGUnitPercent) {
+          YGNodeStyleSetPositionPercent(node, edge, value.number);
+        } else {
+          YGNodeStyleSetPosition(node, edge, value.number);
+        }
+      };
+    }
+    return setters;
+  }();
+  return setters;
+}
+
+const std::unordered_map<std::string, std::function<void(YGNodeRef)>>&
+getKeywordSetters() {
+  static const auto setters = [] {
+    std::unordered_map<std::string, std::function<void(YGNodeRef)>> setters;
+    const std::pair<const char*, YGFlexDirection> directions[] = {
+        {"column", YGFlexDirectionColumn},
+        {"column-reverse", YGFlexDirectionColumnReverse},
+        {"row", YGFlexDirectionRow},
+        {"row-reverse", YGFlexDirectionRowReverse},
+    };
+    for (const auto& direction : directions) {
+      const YGFlexDirection value = direction.second;
+      setters[std::string{"flex-direction="} + direction.first] =
+          [=](YGNodeRef node) { YGNodeStyleSetFlexDirection(node, value); };
+    }
+    const std::pair<const char*, YGJustify> justifications[] = {
+        {"flex-start", YGJustifyFlexStart},
+        {"center", YGJustifyCenter},
+        {"flex-end", YGJustifyFlexEnd},
+        {"space-between", YGJustifySpaceBetween},
+        {"space-around", YGJustifySpaceAround},
+        {"space-evenly", YGJustifySpaceEvenly},
+    };
+    for (const auto& justification : justifications) {
+      const YGJustify value = justification.second;
+      setters[std::string{"justify-content="} + justification.first] =
+          [=](YGNodeRef node) { YGNodeStyleSetJustifyContent(node, value); };
+    }
+    const std::pair<const char*, YGAlign> alignments[] = {
+        {"auto", YGAlignAuto},
+        {"flex-start", YGAlignFlexStart},
+        {"center", YGAlignCenter},
+        {"flex-end", YGAlignFlexEnd},
+        {"stretch", YGAlignStretch},
+        {"baseline", YGAlignBaseline},
+    };
+    for (const auto& alignment : alignments) {
+      const YGAlign value = alignment.second;
+      setters[std::string{"align-items="} + alignment.first] =
+          [=](YGNodeRef node) { YGNodeStyleSetAlignItems(node, value); };
+      setters[std::string{"align-self="} + alignment.first] =
+          [=](YGNodeRef node) { YGNodeStyleSetAlignSelf(node, value); };
+      setters[std::string{"align-content="} + alignment.first] =
+          [=](YGNodeRef node) { YGNodeStyleSetAlignContent(node, value); };
+    }
+    setters["flex-wrap=wrap"] = [](YGNodeRef node) {
+      YGNodeStyleSetFlexWrap(node, YGWrapWrap);
+    };
+    setters["flex-wrap=nowrap"] = [](YGNodeRef node) {
+      YGNodeStyleSetFlexWrap(node, YGWrapNoWrap);
+    };
+    setters["position=absolute"] = [](YGNodeRef node) {
+      YGNodeStyleSetPositionType(node, YGPositionTypeAbsolute);
+    };
+    setters["position=relative"] = [](YGNodeRef node) {
+      YGNodeStyleSetPositionType(node, YGPositionTypeRelative);
+    };
+    setters["display=none"] = [](YGNodeRef node) {
+      YGNodeStyleSetDisplay(node, YGDisplayNone);
+    };
+    setters["overflow=hidden"] = [](YGNodeRef node) {
+      YGNodeStyleSetOverflow(node, YGOverflowHidden);
+    };
+    setters["overflow=scroll"] = [](YGNodeRef node) {
+      YGNodeStyleSetOverflow(node, YGOverflowScroll);
+    };
+    return setters;
+  }();
+  return setters;
+}
+
+// One line of the serialized form.
+struct NodeSpec {
+  std::string line;
+  bool isText = false;
+  uint32_t minChars = 0;
+  uint32_t maxChars = 0;
+  uint32_t repeat = 1;
+  std::vector<std::string> attributes;
+  std::vector<std::unique_ptr<NodeSpec>> children;
+};
+
+std::unique_ptr<NodeSpec> parseLine(const std::string& line) {
+  auto spec = std::make_unique<NodeSpec>();
+  spec->line = line;
+
+  std::istringstream tokens{line};
+  std::string kind;
+  tokens >> kind;
+  if (kind == "text") {
+    spec->isText = true;
+  } else if (kind != "view") {
+    fail(line, "unknown node kind");
+  }
+
+  std::string token;
+  while (tokens >> token) {
+    if (token.compare(0, 7, "repeat=") == 0) {
+      spec->repeat = (uint32_t) std::stoul(token.substr(7));
+    } else if (token.compare(0, 6, "chars=") == 0 && spec->isText) {
+      const auto range = token.substr(6);
+      const auto dash = range.find('-');
+      spec->minChars = (uint32_t) std::stoul(range.substr(0, dash));
+      spec->maxChars = dash == std::string::npos
+          ? spec->minChars
+          : (uint32_t) std::stoul(range.substr(dash + 1));
+    } else {
+      spec->attributes.push_back(token);
+    }
+  }
+  return spec;
+}
+
+std::unique_ptr<NodeSpec> parse(const char* serialized) {
+  std::unique_ptr<NodeSpec> root;
+  // Innermost node last, along with its indentation.
+  std::vector<std::pair<NodeSpec*, size_t>> ancestors;
+
+  std::istringstream lines{serialized};
+  std::string line;
+  while (std::getline(lines, line)) {
+    const size_t indentation = line.find_first_not_of(' ');
+    if (indentation == std::string::npos || line[indentation] == '#') {
+      continue;
+    }
+
+    auto spec = parseLine(line);
+    while (!ancestors.empty() && ancestors.back().second >= indentation) {
+      ancestors.pop_back();
+    }
+    NodeSpec* node = spec.get();
+    if (ancestors.empty()) {
+      if (root != nullptr) {
+        fail(line, "more than one root");
+      }
+      root = std::move(spec);
+    } else {
+      ancestors.back().first->children.push_back(std::move(spec));
+    }
+    ancestors.emplace_back(node, indentation);
+  }
+
+  if (root == nullptr) {
+    fail("", "no nodes");
+  }
+  return root;
+}
+
+void applyAttribute(
+    YGNodeRef node,
+    const std::string& line,
+    const std::string& attribute) {
+  const auto& keywordSetters = getKeywordSetters();
+  const auto keywordSetter = keywordSetters.find(attribute);
+  if (keywordSetter != keywordSetters.end()) {
+    keywordSetter->second(node);
+    return;
+  }
+
+  const auto equals = attribute.find('=');
+  const auto& setters = getSetters();
+  const auto setter = setters.find(attribute.substr(0, equals));
+  if (equals == std::string::npos || setter == setters.end()) {
+    fail(line, "unknown attribute");
+  }
+  setter->second(node, parseValue(line, attribute.substr(equals + 1)));
+}
+
+} // namespace
+
+YGBenchmarkTree::YGBenchmarkTree(const char* serialized) {
+  config_ = YGConfigNew();
+  YGConfigSetPointScaleFactor(config_, 3);
+
+  // Linear congruential generator, so trees are the same on every platform.
+  uint32_t seed = 1;
+  const auto random = [&](uint32_t min, uint32_t max) {
+    seed = seed * 1664525 + 1013904223;
+    return min + (seed >> 8) % (max - min + 1);
+  };
+
+  std::function<YGNodeRef(const NodeSpec&)> build =
+      [&](const NodeSpec& spec) -> YGNodeRef {
+    const YGNodeRef node = YGNodeNewWithConfig(config_);
+    nodeCount_++;
+    for (const auto& attribute : spec.attributes) {
+      applyAttribute(node, spec.line, attribute);
+    }
+
+    if (spec.isText) {
+      if (!spec.children.empty()) {
+        fail(spec.line, "text with children");
+      }
+      const uint32_t chars = random(spec.minChars, spec.maxChars);
+      YGNodeSetContext(node, (void*) (uintptr_t) chars);
+      YGNodeSetNodeType(node, YGNodeTypeText);
+      YGNodeSetMeasureFunc(node, measureText);
+    }
+
+    for (const auto& child : spec.children) {
+      for (uint32_t i = 0; i < child->repeat; i++) {
+        YGNodeInsertChild(node, build(*child), YGNodeGetChildCount(node));
+      }
+    }
+
+    if (YGNodeGetChildCount(node) == 0) {
+      leaves_.push_back(node);
+    }
+    return node;
+  };
+
+  const auto spec = parse(serialized);
+  if (spec->repeat != 1) {
+    fail(spec->line, "repeated root");
+  }
+  root_ = build(*spec);
+  changedLeaves_.resize(leaves_.size());
+}
+
+YGBenchmarkTree::~YGBenchmarkTree() {
+  YGNodeFreeRecursive(root_);
+  YGConfigFree(config_);
+}
+
+double YGBenchmarkTree::getBytesPerNode() const {
+  std::function<size_t(YGNodeConstRef)> getBytes = [&](YGNodeConstRef node) {
+    size_t bytes = sizeof(YGNode) + node->getStyle().getAllocatedBytes() +
+        node->getChildren().capacity() * sizeof(YGNodeRef);
+    for (const auto child : node->getChildren()) {
+      bytes += getBytes(child);
+    }
+    return bytes;
+  };
+  return (double) getBytes(root_) / nodeCount_;
+}
+
+void YGBenchmarkTree::changeLeaf(size_t index) {
+  index %= leaves_.size();
+  const YGNodeRef leaf = leaves_[index];
+  const bool wasChanged = changedLeaves_[index];
+  changedLeaves_[index] = !wasChanged;
+
+  if (YGNodeHasMeasureFunc(leaf)) {
+    const uint32_t chars = getChars(leaf);
+    YGNodeSetContext(
+        leaf,
+        (void*) (uintptr_t)(
+            wasChanged ? chars - kChangedChars : chars + kChangedChars));
+    YGNodeMarkDirty(leaf);
+    return;
+  }
+
+  const YGValue margin = YGNodeStyleGetMargin(leaf, YGEdgeBottom);
+  const float points = margin.unit == YGUnitPoint ? margin.value : 0;
+  YGNodeStyleSetMargin(leaf, YGEdgeBottom, wasChanged ? points - 1 : points + 1);
+}
+
+void YGBenchmarkTree::calculateLayout() {
+  YGNodeCalculateLayout(root_, YGUndefined, YGUndefined, YGDirectionLTR);
+}
+
+} // namespace benchmark
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <yoga/Yoga.h>
+#include <cstddef>
+#include <vector>
+
+namespace facebook {
+namespace yoga {
+namespace benchmark {
+
+// A Yoga tree built from its serialized form. Every line of the serialized
+// form describes one node, indented by two spaces per level:
+//
+//   # Comment
+//   view flex-direction=row padding=12
+//     view width=40 height=40 margin-right=8
+//     text chars=20-140 flex-shrink=1
+//
+// A node is either a `view` or a `text`. Text nodes have a deterministic
+// measure function which lays out `chars` characters of fixed size in lines;
+// `chars=a-b` picks a (deterministic) number of characters between `a` and
+// `b` for every instance. `repeat=n` inserts the node and its subtree `n`
+// times. Other attributes set the Yoga style property with the same name as
+// in CSS; values are points, percents (`50%`) or `auto`.
+class YGBenchmarkTree {
+public:
+  explicit YGBenchmarkTree(const char* serialized);
+  ~YGBenchmarkTree();
+
+  YGBenchmarkTree(const YGBenchmarkTree&) = delete;
+  YGBenchmarkTree& operator=(const YGBenchmarkTree&) = delete;
+
+  YGNodeRef getRoot() const { return root_; }
+
+  // Nodes without children, in tree order.
+  const std::vector<YGNodeRef>& getLeaves() const { return leaves_; }
+
+  size_t getNodeCount() const { return nodeCount_; }
+
+  // Memory taken by the Yoga nodes of the tree (including their lists of
+  // children and the values their styles allocate), divided by the number of
+  // nodes.
+  double getBytesPerNode() const;
+
+  // Changes the leaf with the given index so that it has to be laid out
+  // again, and back on the next call: text gets a different number of
+  // characters, views a different bottom margin.
+  void changeLeaf(size_t index);
+
+  void calculateLayout();
+
+private:
+  YGConfigRef config_;
+  YGNodeRef root_;
+  std::vector<YGNodeRef> leaves_;
+  std::vector<bool> changedLeaves_;
+  size_t nodeCount_ = 0;
+};
+
+} // namespace benchmark
+} // namespace yoga
+} // namespace facebook
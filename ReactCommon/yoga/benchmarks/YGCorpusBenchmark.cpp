@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+#include <string>
+
+#include "YGBenchmarkCorpus.h"
+#include "YGBenchmarkTree.h"
+
+namespace facebook {
+namespace yoga {
+namespace benchmark {
+
+namespace {
+
+// Only the size of the tree is reported here, so that the timed runs use Yoga
+// as it is shipped. Cache statistics of the same layout passes are reported by
+// `YGCorpusStatistics.cpp`, which is built with Yoga layout events.
+void reportTree(::benchmark::State& state, const YGBenchmarkTree& tree) {
+  state.counters["nodes"] = tree.getNodeCount();
+  state.counters["bytesPerNode"] = tree.getBytesPerNode();
+}
+
+// Lays out the whole tree from scratch.
+void fullLayout(::benchmark::State& state, const char* serialized) {
+  YGBenchmarkTree tree{serialized};
+
+  for (auto _ : state) {
+    YGNodeMarkDirtyAndPropogateToDescendants(tree.getRoot());
+    tree.calculateLayout();
+  }
+
+  reportTree(state, tree);
+}
+
+// Lays out the tree again after changing a single leaf; every iteration
+// changes the next leaf.
+void singleLeafRelayout(::benchmark::State& state, const char* serialized) {
+  YGBenchmarkTree tree{serialized};
+  tree.calculateLayout();
+
+  size_t iteration = 0;
+  for (auto _ : state) {
+    tree.changeLeaf(iteration++);
+    tree.calculateLayout();
+  }
+
+  reportTree(state, tree);
+}
+
+const bool registered = [] {
+  for (const auto& entry : YGBenchmarkCorpus()) {
+    ::benchmark::RegisterBenchmark(
+        (std::string{"fullLayout/"} + entry.name).c_str(),
+        fullLayout,
+        entry.tree);
+    ::benchmark::RegisterBenchmark(
+        (std::string{"singleLeafRelayout/"} + entry.name).c_str(),
+        singleLeafRelayout,
+        entry.tree);
+  }
+  return true;
+}();
+
+} // namespace
+
+} // namespace benchmark
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <yoga/Yoga.h>
+#include <yoga/event/event.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "YGBenchmarkCorpus.h"
+#include "YGBenchmarkTree.h"
+
+#ifndef YG_ENABLE_EVENTS
+#error "Cache statistics of the benchmarks require Yoga built with events."
+#endif
+
+// Heap allocations made by the binary, reported per layout pass.
+static std::atomic<size_t> gAllocationCount{0};
+
+void* operator new(size_t size) {
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size != 0 ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace facebook {
+namespace yoga {
+namespace benchmark {
+
+namespace {
+
+constexpr size_t kStatisticsPasses = 32;
+
+// Sums of `LayoutData` of the layout passes run by `collect`.
+struct LayoutStatistics {
+  double passes = 0;
+  double layouts = 0;
+  double cachedLayouts = 0;
+  double measures = 0;
+  double cachedMeasures = 0;
+  double measureCallbacks = 0;
+  double allocations = 0;
+
+  // Collects statistics of the layout passes run by `runPasses`.
+  template <typename RunPasses>
+  static LayoutStatistics collect(RunPasses runPasses) {
+    LayoutStatistics statistics;
+    Event::subscribe([&](const YGNode&, Event::Type type, Event::Data data) {
+      if (type != Event::LayoutPassEnd) {
+        return;
+      }
+      const LayoutData& layoutData =
+          *data.get<Event::LayoutPassEnd>().layoutData;
+      statistics.passes++;
+      statistics.layouts += layoutData.layouts;
+      statistics.cachedLayouts += layoutData.cachedLayouts;
+      statistics.measures += layoutData.measures;
+      statistics.cachedMeasures += layoutData.cachedMeasures;
+      statistics.measureCallbacks += layoutData.measureCallbacks;
+    });
+    const size_t allocationCount =
+        gAllocationCount.load(std::memory_order_relaxed);
+    runPasses();
+    statistics.allocations =
+        gAllocationCount.load(std::memory_order_relaxed) - allocationCount;
+    Event::reset();
+    return statistics;
+  }
+
+  void print(const std::string& name) const {
+    const double total = layouts + cachedLayouts + measures + cachedMeasures;
+    std::printf(
+        "%-43s %14.3f %14.1f %15.1f %23.1f %18.1f\n",
+        name.c_str(),
+        total > 0 ? (cachedLayouts + cachedMeasures) / total : 0,
+        (layouts + cachedLayouts) / passes,
+        (measures + cachedMeasures) / passes,
+        measureCallbacks / passes,
+        allocations / passes);
+  }
+};
+
+// The same layout passes as the `fullLayout` benchmark.
+LayoutStatistics fullLayout(const char* serialized) {
+  YGBenchmarkTree tree{serialized};
+  return LayoutStatistics::collect([&] {
+    YGNodeMarkDirtyAndPropogateToDescendants(tree.getRoot());
+    tree.calculateLayout();
+  });
+}
+
+// The same kind of layout passes as the `singleLeafRelayout` benchmark.
+LayoutStatistics singleLeafRelayout(const char* serialized) {
+  YGBenchmarkTree tree{serialized};
+  tree.calculateLayout();
+
+  const size_t passes = std::min(kStatisticsPasses, tree.getLeaves().size());
+  return LayoutStatistics::collect([&] {
+    // Spread the changes over the whole tree.
+    for (size_t i = 0; i < passes; i++) {
+      tree.changeLeaf(i * tree.getLeaves().size() / passes);
+      tree.calculateLayout();
+    }
+  });
+}
+
+} // namespace
+
+} // namespace benchmark
+} // namespace yoga
+} // namespace facebook
+
+// Prints cache statistics of the layout passes of the corpus benchmarks. Yoga
+// publishes layout events in this build, so it is not timed.
+int main() {
+  using namespace facebook::yoga::benchmark;
+
+  std::printf(
+      "%-43s %14s %14s %15s %23s %18s\n",
+      "Benchmark",
+      "cacheHitRatio",
+      "layoutsPerPass",
+      "measuresPerPass",
+      "measureCallbacksPerPass",
+      "allocationsPerPass");
+  for (const auto& entry : YGBenchmarkCorpus()) {
+    fullLayout(entry.tree).print(std::string{"fullLayout/"} + entry.name);
+    singleLeafRelayout(entry.tree).print(
+        std::string{"singleLeafRelayout/"} + entry.name);
+  }
+  return 0;
+}
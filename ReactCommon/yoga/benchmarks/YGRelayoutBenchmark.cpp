@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+#include <vector>
+
+namespace {
+
+// A list of `numberOfRows` rows with five cells each. Cells share the width of
+// the row, so most of the layout is off the pixel grid before rounding.
+struct ListTree {
+  YGConfigRef config;
+  YGNodeRef root;
+  std::vector<YGNodeRef> leaves;
+
+  explicit ListTree(uint32_t numberOfRows) {
+    config = YGConfigNew();
+    YGConfigSetPointScaleFactor(config, 3);
+
+    root = YGNodeNewWithConfig(config);
+    YGNodeStyleSetWidth(root, 375);
+
+    for (uint32_t i = 0; i < numberOfRows; i++) {
+      const YGNodeRef row = YGNodeNewWithConfig(config);
+      YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+      YGNodeStyleSetPadding(row, YGEdgeAll, 4.5f);
+      YGNodeInsertChild(root, row, i);
+
+      for (uint32_t j = 0; j < 5; j++) {
+        const YGNodeRef cell = YGNodeNewWithConfig(config);
+        YGNodeStyleSetFlexGrow(cell, 1);
+        YGNodeStyleSetHeight(cell, 33.3f);
+        YGNodeStyleSetMargin(cell, YGEdgeLeft, 1.7f);
+        YGNodeInsertChild(row, cell, j);
+        leaves.push_back(cell);
+      }
+    }
+
+    YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  }
+
+  ~ListTree() {
+    YGNodeFreeRecursive(root);
+    YGConfigFree(config);
+  }
+};
+
+// Lays out the tree again after changing the height of a single leaf.
+// Everything but the ancestors of the leaf and their children comes from the
+// layout cache.
+void singleLeafChange(benchmark::State& state) {
+  ListTree tree{(uint32_t) state.range(0)};
+
+  size_t iteration = 0;
+  for (auto _ : state) {
+    const YGNodeRef leaf = tree.leaves[iteration % tree.leaves.size()];
+    const float height = YGNodeStyleGetHeight(leaf).value;
+    YGNodeStyleSetHeight(leaf, height == 33.3f ? 40.1f : 33.3f);
+    YGNodeCalculateLayout(
+        tree.root, YGUndefined, YGUndefined, YGDirectionLTR);
+    benchmark::DoNotOptimize(YGNodeLayoutGetHeight(tree.root));
+    iteration++;
+  }
+}
+BENCHMARK(singleLeafChange)->Arg(10)->Arg(100)->Arg(1000);
+
+} // namespace
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+#include <yoga/YGConfig.h>
+#include <yoga/Yoga.h>
+
+// Lays out `length` characters of 10x10 points in lines as wide as possible.
+struct Text {
+  int length;
+  int measureCount;
+};
+
+static YGSize measureText(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  auto text = static_cast<Text*>(YGNodeGetContext(node));
+  text->measureCount++;
+
+  const float naturalWidth = text->length * 10.0f;
+  float measuredWidth = naturalWidth;
+  if (widthMode == YGMeasureModeExactly) {
+    measuredWidth = width;
+  } else if (widthMode == YGMeasureModeAtMost) {
+    measuredWidth = std::min(width, naturalWidth);
+  }
+  const int lines = measuredWidth > 0
+      ? static_cast<int>(std::ceil(naturalWidth / measuredWidth))
+      : text->length;
+  float measuredHeight = std::max(lines, 1) * 10.0f;
+  if (heightMode == YGMeasureModeExactly) {
+    measuredHeight = height;
+  } else if (heightMode == YGMeasureModeAtMost) {
+    measuredHeight = std::min(height, measuredHeight);
+  }
+  return {measuredWidth, measuredHeight};
+}
+
+class YGIncrementalLayoutTest : public ::testing::Test {
+protected:
+  YGConfigRef config;
+  YGNodeRef root;
+
+  YGIncrementalLayoutTest() : config(YGConfigNew()) {
+    config->incrementalLayout = true;
+    root = YGNodeNewWithConfig(config);
+  }
+
+  ~YGIncrementalLayoutTest() {
+    YGNodeFreeRecursive(root);
+    YGConfigFree(config);
+  }
+
+  YGNodeRef addText(YGNodeRef owner, Text& text) {
+    const YGNodeRef node = YGNodeNewWithConfig(config);
+    YGNodeSetContext(node, &text);
+    YGNodeSetMeasureFunc(node, measureText);
+    YGNodeInsertChild(owner, node, YGNodeGetChildCount(owner));
+    return node;
+  }
+};
+
+TEST_F(YGIncrementalLayoutTest, changed_text_in_wrapping_column_is_resized) {
+  Text text{2, 0};
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionColumnReverse);
+  YGNodeStyleSetFlexWrap(root, YGWrapWrap);
+  const YGNodeRef node = addText(root, text);
+  YGNodeStyleSetMargin(node, YGEdgeRight, 9);
+  YGNodeStyleSetAlignItems(node, YGAlignFlexStart);
+
+  YGNodeCalculateLayout(root, 200, 60, YGDirectionLTR);
+  ASSERT_FLOAT_EQ(YGNodeLayoutGetWidth(node), 20);
+
+  text.length = 8;
+  YGNodeMarkDirty(node);
+  YGNodeCalculateLayout(root, 200, 60, YGDirectionLTR);
+
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetLeft(node), 0);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetTop(node), 41);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetWidth(node), 80);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetHeight(node), 19);
+}
+
+TEST_F(YGIncrementalLayoutTest, text_dirtied_twice_is_resized) {
+  Text text{30, 0};
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionColumnReverse);
+  YGNodeStyleSetFlexWrap(root, YGWrapWrap);
+  YGNodeStyleSetFlexGrow(root, 1);
+  const YGNodeRef node = addText(root, text);
+  YGNodeStyleSetMargin(node, YGEdgeLeft, 8);
+  YGNodeStyleSetHeight(node, 100);
+
+  YGNodeCalculateLayout(root, 200, 120, YGDirectionLTR);
+  ASSERT_FLOAT_EQ(YGNodeLayoutGetWidth(node), 300);
+
+  YGNodeMarkDirty(node);
+  YGNodeCalculateLayout(root, 200, 120, YGDirectionLTR);
+  ASSERT_FLOAT_EQ(YGNodeLayoutGetWidth(node), 300);
+
+  text.length = 20;
+  YGNodeMarkDirty(node);
+  YGNodeCalculateLayout(root, 200, 120, YGDirectionLTR);
+
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetLeft(node), 8);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetWidth(node), 200);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetHeight(node), 108);
+}
+
+TEST_F(YGIncrementalLayoutTest, text_dirtied_with_same_content_keeps_overflow) {
+  Text text{40, 0};
+  Text otherText{10, 0};
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  YGNodeStyleSetMargin(root, YGEdgeLeft, 6);
+  YGNodeStyleSetPadding(root, YGEdgeRight, 4);
+  const YGNodeRef row = YGNodeNewWithConfig(config);
+  YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+  YGNodeStyleSetAlignItems(row, YGAlignFlexStart);
+  YGNodeStyleSetFlexGrow(row, 1);
+  YGNodeInsertChild(root, row, 0);
+  const YGNodeRef column = YGNodeNewWithConfig(config);
+  YGNodeStyleSetFlexDirection(column, YGFlexDirectionColumnReverse);
+  YGNodeStyleSetHeight(column, 87);
+  YGNodeInsertChild(row, column, 0);
+  const YGNodeRef node = addText(column, text);
+  YGNodeStyleSetFlexGrow(node, 2);
+  YGNodeStyleSetHeight(node, 93);
+  const YGNodeRef otherNode = addText(column, otherText);
+  YGNodeStyleSetFlexDirection(otherNode, YGFlexDirectionColumnReverse);
+  YGNodeStyleSetFlexGrow(otherNode, 2);
+  YGNodeStyleSetFlexShrink(otherNode, 0);
+  YGNodeStyleSetMargin(otherNode, YGEdgeTop, 3);
+
+  // The overflow of the row comes from an earlier layout of the column, which
+  // its cache entries do not record.
+  for (const float width : {188, 335, 248, 95}) {
+    YGNodeCalculateLayout(root, width, 287, YGDirectionLTR);
+  }
+  ASSERT_TRUE(YGNodeLayoutGetHadOverflow(row));
+
+  YGNodeMarkDirty(node);
+  YGNodeMarkDirty(otherNode);
+  YGNodeCalculateLayout(root, 95, 287, YGDirectionLTR);
+
+  EXPECT_TRUE(YGNodeLayoutGetHadOverflow(row));
+  EXPECT_TRUE(YGNodeLayoutGetHadOverflow(column));
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetTop(node), -6);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetTop(otherNode), -26);
+}
+
+TEST_F(YGIncrementalLayoutTest, text_dirtied_with_same_content_is_measured_once) {
+  Text text{5, 0};
+  Text otherText{5, 0};
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  YGNodeStyleSetAlignItems(root, YGAlignFlexStart);
+  const YGNodeRef otherNode = addText(root, otherText);
+  const YGNodeRef node = addText(root, text);
+  YGNodeStyleSetFlexGrow(node, 1);
+
+  YGNodeCalculateLayout(root, 100, 100, YGDirectionLTR);
+  text.measureCount = 0;
+  otherText.measureCount = 0;
+
+  YGNodeMarkDirty(node);
+  YGNodeCalculateLayout(root, 100, 100, YGDirectionLTR);
+
+  EXPECT_EQ(text.measureCount, 1);
+  EXPECT_EQ(otherText.measureCount, 0);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetWidth(otherNode), 50);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetLeft(node), 50);
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetWidth(node), 50);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <yoga/Yoga.h>
+
+static YGSize measureText(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  return {14.6f, 17.1f};
+}
+
+// Row: {width, 100}
+//  ├─ View: {spacerWidth, 10}
+//  └─ View: {50, 20}
+//      └─ Text: {14.6, 17.1}, at the left of the view
+static YGNodeRef createRow(YGConfigRef config, float spacerWidth) {
+  const YGNodeRef row = YGNodeNewWithConfig(config);
+  YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+  YGNodeStyleSetAlignItems(row, YGAlignFlexStart);
+
+  const YGNodeRef spacer = YGNodeNewWithConfig(config);
+  YGNodeStyleSetWidth(spacer, spacerWidth);
+  YGNodeStyleSetHeight(spacer, 10);
+  YGNodeInsertChild(row, spacer, 0);
+
+  const YGNodeRef view = YGNodeNewWithConfig(config);
+  YGNodeStyleSetWidth(view, 50);
+  YGNodeStyleSetHeight(view, 20);
+  YGNodeStyleSetAlignItems(view, YGAlignFlexStart);
+  YGNodeInsertChild(row, view, 1);
+
+  const YGNodeRef text = YGNodeNewWithConfig(config);
+  YGNodeSetMeasureFunc(text, measureText);
+  YGNodeInsertChild(view, text, 0);
+
+  return row;
+}
+
+static void expectSameLayout(YGNodeRef node, YGNodeRef expectedNode) {
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetLeft(node), YGNodeLayoutGetLeft(expectedNode));
+  EXPECT_FLOAT_EQ(YGNodeLayoutGetTop(node), YGNodeLayoutGetTop(expectedNode));
+  EXPECT_FLOAT_EQ(
+      YGNodeLayoutGetWidth(node), YGNodeLayoutGetWidth(expectedNode));
+  EXPECT_FLOAT_EQ(
+      YGNodeLayoutGetHeight(node), YGNodeLayoutGetHeight(expectedNode));
+  ASSERT_EQ(YGNodeGetChildCount(node), YGNodeGetChildCount(expectedNode));
+  for (uint32_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    expectSameLayout(YGNodeGetChild(node, i), YGNodeGetChild(expectedNode, i));
+  }
+}
+
+TEST(YGRoundingTest, cached_subtree_moved_by_a_fraction_of_a_pixel) {
+  const YGConfigRef config = YGConfigNew();
+  YGConfigSetPointScaleFactor(config, 3);
+
+  const YGNodeRef row = createRow(config, 10);
+  YGNodeCalculateLayout(row, 200, 100, YGDirectionLTR);
+  YGNodeStyleSetWidth(YGNodeGetChild(row, 0), 10.2f);
+  YGNodeCalculateLayout(row, 200, 100, YGDirectionLTR);
+
+  const YGNodeRef expectedRow = createRow(config, 10.2f);
+  YGNodeCalculateLayout(expectedRow, 200, 100, YGDirectionLTR);
+
+  expectSameLayout(row, expectedRow);
+  EXPECT_FLOAT_EQ(
+      YGNodeLayoutGetWidth(YGNodeGetChild(YGNodeGetChild(row, 1), 0)),
+      15.0f);
+
+  YGNodeFreeRecursive(row);
+  YGNodeFreeRecursive(expectedRow);
+  YGConfigFree(config);
+}
+
+TEST(YGRoundingTest, cached_subtree_rounded_with_another_point_scale_factor) {
+  const YGConfigRef config = YGConfigNew();
+  YGConfigSetPointScaleFactor(config, 2);
+
+  const YGNodeRef row = createRow(config, 10.2f);
+  YGNodeCalculateLayout(row, 200, 100, YGDirectionLTR);
+  YGConfigSetPointScaleFactor(config, 3);
+  YGNodeCalculateLayout(row, 200, 100, YGDirectionLTR);
+
+  const YGNodeRef expectedRow = createRow(config, 10.2f);
+  YGNodeCalculateLayout(expectedRow, 200, 100, YGDirectionLTR);
+
+  expectSameLayout(row, expectedRow);
+
+  YGNodeFreeRecursive(row);
+  YGNodeFreeRecursive(expectedRow);
+  YGConfigFree(config);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <yoga/YGStyle.h>
+
+using facebook::yoga::detail::CompactValue;
+
+static CompactValue points(float value) {
+  return CompactValue::ofMaybe<YGUnitPoint>(value);
+}
+
+// Reads edges the way layout does, through a const style.
+static const YGStyle& read(const YGStyle& style) {
+  return style;
+}
+
+TEST(YGStyleTest, default_edges_do_not_allocate) {
+  YGStyle style;
+
+  EXPECT_EQ(style.getAllocatedBytes(), 0u);
+  EXPECT_TRUE(read(style).margin()[YGEdgeLeft].isUndefined());
+  EXPECT_TRUE(read(style).border()[YGEdgeAll].isUndefined());
+}
+
+TEST(YGStyleTest, copies_share_edges_until_written) {
+  YGStyle style;
+  style.margin()[YGEdgeLeft] = points(10);
+
+  YGStyle copy = style;
+  EXPECT_EQ(copy, style);
+  EXPECT_EQ(read(copy).margin()[YGEdgeLeft], points(10));
+
+  copy.margin()[YGEdgeLeft] = points(20);
+  EXPECT_EQ(read(copy).margin()[YGEdgeLeft], points(20));
+  EXPECT_EQ(read(style).margin()[YGEdgeLeft], points(10));
+  EXPECT_NE(copy, style);
+
+  style.margin()[YGEdgeLeft] = points(30);
+  EXPECT_EQ(read(copy).margin()[YGEdgeLeft], points(20));
+  EXPECT_EQ(read(style).margin()[YGEdgeLeft], points(30));
+}
+
+TEST(YGStyleTest, copies_outlive_their_source) {
+  YGStyle copy;
+  {
+    YGStyle style;
+    style.padding()[YGEdgeTop] = points(4);
+    copy = style;
+  }
+
+  EXPECT_EQ(read(copy).padding()[YGEdgeTop], points(4));
+}
+
+TEST(YGStyleTest, setting_defaults_drops_edges) {
+  YGStyle style;
+  style.position()[YGEdgeRight] = points(8);
+  EXPECT_GT(style.getAllocatedBytes(), 0u);
+
+  style.position()[YGEdgeRight] = CompactValue::ofUndefined();
+  EXPECT_EQ(read(style).position()[YGEdgeRight], CompactValue::ofUndefined());
+
+  style.position() = YGStyle::Edges{};
+  EXPECT_EQ(style.getAllocatedBytes(), 0u);
+  EXPECT_EQ(style, YGStyle{});
+}
+
+TEST(YGStyleTest, setting_defaults_keeps_values_of_copies) {
+  YGStyle style;
+  style.border()[YGEdgeBottom] = points(2);
+  YGStyle copy = style;
+
+  style.border() = YGStyle::Edges{};
+
+  EXPECT_TRUE(read(style).border()[YGEdgeBottom].isUndefined());
+  EXPECT_EQ(read(copy).border()[YGEdgeBottom], points(2));
+}
+
+TEST(YGStyleTest, edges_read_before_a_write_are_not_invalidated) {
+  YGStyle style;
+  style.margin()[YGEdgeLeft] = points(10);
+  YGStyle copy = style;
+
+  // Edges are read as a whole (like RTL swapping does), then written to.
+  const YGStyle::Edges& margin = style.margin();
+  style.margin()[YGEdgeStart] = margin[YGEdgeLeft];
+  style.margin()[YGEdgeLeft] = CompactValue::ofUndefined();
+  style.margin() = YGStyle::Edges{};
+  copy = YGStyle{};
+
+  EXPECT_EQ(margin[YGEdgeLeft], points(10));
+  EXPECT_TRUE(margin[YGEdgeStart].isUndefined());
+}
+
+TEST(YGStyleTest, edges_can_be_assigned_from_themselves) {
+  YGStyle style;
+  style.margin()[YGEdgeLeft] = points(10);
+  YGStyle copy = style;
+
+  style.margin() = read(style).margin();
+  copy.margin() = read(style).margin();
+  style.margin() = read(copy).margin();
+
+  EXPECT_EQ(read(style).margin()[YGEdgeLeft], points(10));
+  EXPECT_EQ(read(copy).margin()[YGEdgeLeft], points(10));
+}
@@ -10,6 +10,63 @@
 #include "Yoga-internal.h"
 #include "CompactValue.h"
 
+// Buffers which a layout pass reuses for the temporary lists of all the
+// containers it lays out, so that laying out a container does not allocate
+// them again.
+//
+// - nodes: Stack of the lists of nodes of the containers being laid out, from
+//   the root down to the current one, see YGScratchNodeList.
+//
+// - measureRequests: Requests of the batched measurement of the children of a
+//   single container.
+struct YGLayoutScratch {
+  std::vector<YGNodeRef> nodes;
+  std::vector<YGMeasureRequest> measureRequests;
+};
+
+// List of nodes on top of the stack of YGLayoutScratch::nodes. The lists of a
+// layout pass are nested like the containers they belong to: a container
+// releases its list before its owner adds to its own one. Nodes are accessed
+// by index, as the stack may be reallocated while a list is iterated.
+class YGScratchNodeList {
+private:
+  std::vector<YGNodeRef>& stack_;
+  const size_t start_;
+
+public:
+  class Iterator {
+  private:
+    const std::vector<YGNodeRef>* stack_;
+    size_t index_;
+
+  public:
+    Iterator(const std::vector<YGNodeRef>* stack, size_t index)
+        : stack_(stack), index_(index) {}
+    YGNodeRef operator*() const { return (*stack_)[index_]; }
+    Iterator& operator++() {
+      index_++;
+      return *this;
+    }
+    bool operator!=(const Iterator& other) const {
+      return index_ != other.index_;
+    }
+  };
+
+  explicit YGScratchNodeList(YGLayoutScratch& scratch)
+      : stack_(scratch.nodes), start_(scratch.nodes.size()) {}
+  YGScratchNodeList(const YGScratchNodeList&) = delete;
+  YGScratchNodeList& operator=(const YGScratchNodeList&) = delete;
+  ~YGScratchNodeList() { clear(); }
+
+  void clear() { stack_.resize(start_); }
+  void push_back(YGNodeRef node) { stack_.push_back(node); }
+
+  size_t size() const { return stack_.size() - start_; }
+  YGNodeRef operator[](size_t i) const { return stack_[start_ + i]; }
+  Iterator begin() const { return {&stack_, start_}; }
+  Iterator end() const { return {&stack_, stack_.size()}; }
+};
+
 // This struct is an helper model to hold the data for step 4 of flexbox algo,
 // which is collecting the flex items in a line.
 //
@@ -33,24 +90,27 @@
 //   and it may or may not be part of the current line(as it may be absolutely
 //   positioned or including it may have caused to overshoot availableInnerDim)
 //
-// - relativeChildren: Maintain a vector of the child nodes that can shrink
+// - relativeChildren: Maintain a list of the child nodes that can shrink
 //   and/or grow.
 
 struct YGCollectFlexItemsRowValues {
-  uint32_t itemsOnLine;
-  float sizeConsumedOnCurrentLine;
-  float totalFlexGrowFactors;
-  float totalFlexShrinkScaledFactors;
-  uint32_t endOfLineIndex;
-  std::vector<YGNodeRef> relativeChildren;
-  float remainingFreeSpace;
+  uint32_t itemsOnLine = 0;
+  float sizeConsumedOnCurrentLine = 0;
+  float totalFlexGrowFactors = 0;
+  float totalFlexShrinkScaledFactors = 0;
+  uint32_t endOfLineIndex = 0;
+  YGScratchNodeList relativeChildren;
+  float remainingFreeSpace = 0;
   // The size of the mainDim for the row after considering size, padding, margin
   // and border of flex items. This is used to calculate maxLineDim after going
   // through all the rows to decide on the main axis size of owner.
-  float mainDim;
+  float mainDim = 0;
   // The size of the crossDim for the row after considering size, padding,
   // margin and border of flex items. Used for calculating containers crossSize.
-  float crossDim;
+  float crossDim = 0;
+
+  explicit YGCollectFlexItemsRowValues(YGLayoutScratch& scratch)
+      : relativeChildren(scratch) {}
 };
 
 bool YGValueEqual(const YGValue& a, const YGValue& b);
@@ -9,6 +9,18 @@
 #include "Yoga-internal.h"
 #include "Yoga.h"
 
+// A measurement of a leaf node with a measure function, requested ahead of
+// time for a batch of siblings. The arguments are the ones the measure
+// function would be called with; the batch measure function sets `size`.
+struct YGMeasureRequest {
+  YGNodeRef node;
+  float width;
+  YGMeasureMode widthMode;
+  float height;
+  YGMeasureMode heightMode;
+  YGSize size;
+};
+
 struct YOGA_EXPORT YGConfig {
   using LogWithContextFn = int (*)(
       YGConfigRef config,
@@ -22,6 +34,8 @@ struct YOGA_EXPORT YGConfig {
       YGNodeRef owner,
       int childIndex,
       void* cloneContext);
+  using MeasureBatchFn =
+      void (*)(YGMeasureRequest* requests, size_t count, void* layoutContext);
 
 private:
   union {
@@ -32,6 +46,7 @@ private:
     LogWithContextFn withContext;
     YGLogger noContext;
   } logger_;
+  MeasureBatchFn measureBatch_ = nullptr;
   bool cloneNodeUsesContext_;
   bool loggerUsesContext_;
 
@@ -41,6 +56,11 @@ public:
   bool shouldDiffLayoutWithoutLegacyStretchBehaviour = false;
   bool printTree = false;
   float pointScaleFactor = 1.0f;
+  // Lets layout keep the results of nodes which are dirty only in their
+  // content (see `YGNode::markContentDirty`) if their dirty children still
+  // have the same measurements, instead of laying them out again. Only the
+  // config of the root node is taken into account.
+  bool incrementalLayout = false;
   std::array<bool, facebook::yoga::enums::count<YGExperimentalFeature>()>
       experimentalFeatures = {};
   void* context = nullptr;
@@ -73,4 +93,21 @@ public:
   void setCloneNodeCallback(std::nullptr_t) {
     setCloneNodeCallback(YGCloneNodeFunc{nullptr});
   }
+
+  // If set, Yoga collects the leaf children of a container which have to be
+  // measured to resolve their flex basis and hands them to this function
+  // before measuring any of them, so they can be measured together (e.g.
+  // concurrently). The results are used in place of calling the measure
+  // functions of these nodes with the same arguments, so the function must
+  // return exactly what the measure functions would.
+  bool hasMeasureBatchFunc() const { return measureBatch_ != nullptr; }
+  void measureBatch(
+      YGMeasureRequest* requests,
+      size_t count,
+      void* layoutContext) {
+    measureBatch_(requests, count, layoutContext);
+  }
+  void setMeasureBatchFunc(MeasureBatchFn measureBatch) {
+    measureBatch_ = measureBatch;
+  }
 };
@@ -10,12 +10,15 @@
 
 using namespace facebook;
 
-bool YGLayout::operator==(YGLayout layout) const {
+bool YGLayout::operator==(const YGLayout& layout) const {
   bool isEqual = YGFloatArrayEqual(position, layout.position) &&
       YGFloatArrayEqual(dimensions, layout.dimensions) &&
       YGFloatArrayEqual(margin, layout.margin) &&
       YGFloatArrayEqual(border, layout.border) &&
       YGFloatArrayEqual(padding, layout.padding) &&
+      YGFloatArrayEqual(unroundedPosition, layout.unroundedPosition) &&
+      YGFloatArrayEqual(unroundedDimensions, layout.unroundedDimensions) &&
+      YGFloatArrayEqual(roundedOwnerPosition, layout.roundedOwnerPosition) &&
       direction() == layout.direction() &&
       hadOverflow() == layout.hadOverflow() &&
       lastOwnerDirection == layout.lastOwnerDirection &&
@@ -27,6 +27,9 @@ private:
       didUseLegacyFlagOffset + 1;
   static constexpr size_t hadOverflowOffset =
       doesLegacyStretchFlagAffectsLayoutOffset + 1;
+  static constexpr size_t isDirtyOnlyInContentOffset = hadOverflowOffset + 1;
+  static constexpr size_t didEvictCachedMeasurementsOffset =
+      isDirtyOnlyInContentOffset + 1;
   uint8_t flags = 0;
 
 public:
@@ -38,6 +41,20 @@ public:
   uint32_t generationCount = 0;
   YGDirection lastOwnerDirection = YGDirectionInherit;
 
+  // The `pointScaleFactor` the layout was rounded to the pixel grid with, or
+  // zero if the layout was computed again since then. Rounding skips subtrees
+  // which were rounded with the current `pointScaleFactor` at the same
+  // absolute position already.
+  float roundedPointScaleFactor = 0;
+  // The left and top position and the width and height before rounding, see
+  // `roundedPointScaleFactor`.
+  std::array<float, 2> unroundedPosition = {};
+  std::array<float, 2> unroundedDimensions = {};
+  // The absolute left and top position of the owner (before rounding) the
+  // layout was rounded at. Rounding depends on it, not only on the position
+  // relative to the owner.
+  std::array<float, 2> roundedOwnerPosition = {};
+
   uint32_t nextCachedMeasurementsIndex = 0;
   std::array<YGCachedMeasurement, YG_MAX_CACHED_RESULT_COUNT>
       cachedMeasurements = {};
@@ -45,6 +62,13 @@ public:
 
   YGCachedMeasurement cachedLayout = YGCachedMeasurement();
 
+  // Result of the measure function computed ahead of time by a batch
+  // measurement (see `YGConfig::setMeasureBatchFunc`) in the layout pass with
+  // the given generation. `availableWidth` and `availableHeight` hold the
+  // arguments of the measure function, not the available size of the node.
+  uint32_t prefetchedMeasurementGeneration = 0;
+  YGCachedMeasurement prefetchedMeasurement = YGCachedMeasurement();
+
   YGDirection direction() const {
     return facebook::yoga::detail::getEnumData<YGDirection>(
         flags, directionOffset);
@@ -82,6 +106,31 @@ public:
         flags, hadOverflowOffset, hadOverflow);
   }
 
-  bool operator==(YGLayout layout) const;
-  bool operator!=(YGLayout layout) const { return !(*this == layout); }
+  // Set while a node is dirty only because its content changed (the content
+  // measured by its measure function, or the layout of a descendant) since it
+  // was last visited. Its style and children stayed the same, so its cached
+  // results can be checked instead of computed again (see
+  // `YGConfig::incrementalLayout`).
+  bool isDirtyOnlyInContent() const {
+    return facebook::yoga::detail::getBooleanData(
+        flags, isDirtyOnlyInContentOffset);
+  }
+  void setIsDirtyOnlyInContent(bool isDirtyOnlyInContent) {
+    facebook::yoga::detail::setBooleanData(
+        flags, isDirtyOnlyInContentOffset, isDirtyOnlyInContent);
+  }
+
+  // Set if `cachedMeasurements` ran out of entries since they were last
+  // invalidated; some of the measurements handed out are not cached anymore.
+  bool didEvictCachedMeasurements() const {
+    return facebook::yoga::detail::getBooleanData(
+        flags, didEvictCachedMeasurementsOffset);
+  }
+  void setDidEvictCachedMeasurements(bool didEvictCachedMeasurements) {
+    facebook::yoga::detail::setBooleanData(
+        flags, didEvictCachedMeasurementsOffset, didEvictCachedMeasurements);
+  }
+
+  bool operator==(const YGLayout& layout) const;
+  bool operator!=(const YGLayout& layout) const { return !(*this == layout); }
 };
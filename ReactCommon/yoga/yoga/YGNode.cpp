@@ -208,6 +208,7 @@ void YGNode::insertChild(YGNodeRef child, uint32_t index) {
 }
 
 void YGNode::setDirty(bool isDirty) {
+  layout_.setIsDirtyOnlyInContent(false);
   if (isDirty == facebook::yoga::detail::getBooleanData(flags, isDirty_)) {
     return;
   }
@@ -394,18 +395,47 @@ void YGNode::cloneChildrenIfNeeded(void* cloneContext) {
   iterChildrenAfterCloningIfNeeded([](YGNodeRef, void*) {}, cloneContext);
 }
 
+YGNodeRef YGNode::cloneChildIfNeeded(uint32_t index, void* cloneContext) {
+  YGNodeRef& child = children_[index];
+  if (child->getOwner() != this) {
+    child = config_->cloneNode(child, this, index, cloneContext);
+    child->setOwner(this);
+  }
+  return child;
+}
+
 void YGNode::markDirtyAndPropogate() {
   if (!facebook::yoga::detail::getBooleanData(flags, isDirty_)) {
     setDirty(true);
     setLayoutComputedFlexBasis(YGFloatOptional());
     if (owner_) {
-      owner_->markDirtyAndPropogate();
+      owner_->markContentDirtyAndPropogate();
+    }
+  } else {
+    layout_.setIsDirtyOnlyInContent(false);
+  }
+}
+
+void YGNode::markContentDirty() {
+  if (!facebook::yoga::detail::getBooleanData(flags, isDirty_)) {
+    setDirty(true);
+    setLayoutComputedFlexBasis(YGFloatOptional());
+    layout_.setIsDirtyOnlyInContent(true);
+  }
+}
+
+void YGNode::markContentDirtyAndPropogate() {
+  if (!facebook::yoga::detail::getBooleanData(flags, isDirty_)) {
+    markContentDirty();
+    if (owner_) {
+      owner_->markContentDirtyAndPropogate();
     }
   }
 }
 
 void YGNode::markDirtyAndPropogateDownwards() {
   facebook::yoga::detail::setBooleanData(flags, isDirty_, true);
+  layout_.setIsDirtyOnlyInContent(false);
   for_each(children_.begin(), children_.end(), [](YGNodeRef childNode) {
     childNode->markDirtyAndPropogateDownwards();
   });
@@ -185,6 +185,8 @@ public:
     return facebook::yoga::detail::getBooleanData(flags, isDirty_);
   }
 
+  bool isDirtyOnlyInContent() const { return layout_.isDirtyOnlyInContent(); }
+
   std::array<YGValue, 2> getResolvedDimensions() const {
     return resolvedDimensions_;
   }
@@ -325,7 +327,15 @@ public:
   void removeChild(uint32_t index);
 
   void cloneChildrenIfNeeded(void*);
+  YGNodeRef cloneChildIfNeeded(uint32_t index, void* cloneContext);
   void markDirtyAndPropogate();
+  // Marks the node dirty because its content changed: the content measured by
+  // its measure function, or the layout of a descendant. Unlike a change of
+  // its style or children, this lets layout keep the cached results of the
+  // node if it still has the same size (see `YGConfig::incrementalLayout`).
+  // Does nothing if the node is dirty already.
+  void markContentDirty();
+  void markContentDirtyAndPropogate();
   float resolveFlexGrow() const;
   float resolveFlexShrink() const;
   bool isNodeFlexible();
@@ -24,6 +24,9 @@ class YOGA_EXPORT YGStyle {
   template <typename Enum>
   using Values =
       facebook::yoga::detail::Values<facebook::yoga::enums::count<Enum>()>;
+  template <typename Enum>
+  using SharedValues = facebook::yoga::detail::SharedValues<
+      facebook::yoga::enums::count<Enum>()>;
   using CompactValue = facebook::yoga::detail::CompactValue;
 
 public:
@@ -53,27 +56,29 @@ public:
     }
   };
 
-  template <typename Idx, Values<Idx> YGStyle::*Prop>
+  template <typename Idx, typename Group, Group YGStyle::*Prop>
   struct IdxRef {
     struct Ref {
       YGStyle& style;
       Idx idx;
-      operator CompactValue() const { return (style.*Prop)[idx]; }
-      operator YGValue() const { return (style.*Prop)[idx]; }
+      operator CompactValue() const { return getValues(style.*Prop)[idx]; }
+      operator YGValue() const { return getValues(style.*Prop)[idx]; }
       Ref& operator=(CompactValue value) {
-        (style.*Prop)[idx] = value;
+        setValue(style.*Prop, idx, value);
         return *this;
       }
     };
 
     YGStyle& style;
-    IdxRef<Idx, Prop>& operator=(const Values<Idx>& values) {
-      style.*Prop = values;
+    IdxRef<Idx, Group, Prop>& operator=(const Values<Idx>& values) {
+      setValues(style.*Prop, values);
       return *this;
     }
-    operator const Values<Idx>&() const { return style.*Prop; }
+    operator Values<Idx>() const { return getValues(style.*Prop); }
     Ref operator[](Idx idx) { return {style, idx}; }
-    CompactValue operator[](Idx idx) const { return (style.*Prop)[idx]; }
+    CompactValue operator[](Idx idx) const {
+      return getValues(style.*Prop)[idx];
+    }
   };
 
   YGStyle() {
@@ -103,16 +108,59 @@ private:
   static constexpr size_t displayOffset =
       overflowOffset + facebook::yoga::detail::bitWidthFn<YGOverflow>();
 
+  // Groups of values are either stored inline or shared between copies of
+  // the style, see `SharedValues`. Shared values are returned by value, as a
+  // reference to them would not survive the next write to the style.
+  template <size_t Size>
+  static const facebook::yoga::detail::Values<Size>& getValues(
+      const facebook::yoga::detail::Values<Size>& values) {
+    return values;
+  }
+  template <size_t Size>
+  static const facebook::yoga::detail::Values<Size>& getValues(
+      const facebook::yoga::detail::SharedValues<Size>& values) {
+    return values.get();
+  }
+
+  template <size_t Size>
+  static void setValue(
+      facebook::yoga::detail::Values<Size>& values,
+      size_t i,
+      CompactValue value) {
+    values[i] = value;
+  }
+  template <size_t Size>
+  static void setValue(
+      facebook::yoga::detail::SharedValues<Size>& values,
+      size_t i,
+      CompactValue value) {
+    values.set(i, value);
+  }
+
+  template <size_t Size>
+  static void setValues(
+      facebook::yoga::detail::Values<Size>& values,
+      const facebook::yoga::detail::Values<Size>& newValues) {
+    values = newValues;
+  }
+  template <size_t Size>
+  static void setValues(
+      facebook::yoga::detail::SharedValues<Size>& values,
+      const facebook::yoga::detail::Values<Size>& newValues) {
+    values.set(newValues);
+  }
+
   uint32_t flags = 0;
 
   YGFloatOptional flex_ = {};
   YGFloatOptional flexGrow_ = {};
   YGFloatOptional flexShrink_ = {};
   CompactValue flexBasis_ = CompactValue::ofAuto();
-  Edges margin_ = {};
-  Edges position_ = {};
-  Edges padding_ = {};
-  Edges border_ = {};
+  // Most nodes set none or only a few of the edges, so edges are shared.
+  SharedValues<YGEdge> margin_ = {};
+  SharedValues<YGEdge> position_ = {};
+  SharedValues<YGEdge> padding_ = {};
+  SharedValues<YGEdge> border_ = {};
   Dimensions dimensions_{CompactValue::ofAuto()};
   Dimensions minDimensions_ = {};
   Dimensions maxDimensions_ = {};
@@ -121,7 +169,7 @@ private:
 
 public:
   // for library users needing a type
-  using ValueRepr = std::remove_reference<decltype(margin_[0])>::type;
+  using ValueRepr = decltype(flexBasis_);
 
   YGDirection direction() const {
     return facebook::yoga::detail::getEnumData<YGDirection>(
@@ -198,34 +246,51 @@ public:
   CompactValue flexBasis() const { return flexBasis_; }
   Ref<CompactValue, &YGStyle::flexBasis_> flexBasis() { return {*this}; }
 
-  const Edges& margin() const { return margin_; }
-  IdxRef<YGEdge, &YGStyle::margin_> margin() { return {*this}; }
+  Edges margin() const { return margin_.get(); }
+  IdxRef<YGEdge, SharedValues<YGEdge>, &YGStyle::margin_> margin() {
+    return {*this};
+  }
 
-  const Edges& position() const { return position_; }
-  IdxRef<YGEdge, &YGStyle::position_> position() { return {*this}; }
+  Edges position() const { return position_.get(); }
+  IdxRef<YGEdge, SharedValues<YGEdge>, &YGStyle::position_> position() {
+    return {*this};
+  }
 
-  const Edges& padding() const { return padding_; }
-  IdxRef<YGEdge, &YGStyle::padding_> padding() { return {*this}; }
+  Edges padding() const { return padding_.get(); }
+  IdxRef<YGEdge, SharedValues<YGEdge>, &YGStyle::padding_> padding() {
+    return {*this};
+  }
 
-  const Edges& border() const { return border_; }
-  IdxRef<YGEdge, &YGStyle::border_> border() { return {*this}; }
+  Edges border() const { return border_.get(); }
+  IdxRef<YGEdge, SharedValues<YGEdge>, &YGStyle::border_> border() {
+    return {*this};
+  }
 
   const Dimensions& dimensions() const { return dimensions_; }
-  IdxRef<YGDimension, &YGStyle::dimensions_> dimensions() { return {*this}; }
+  IdxRef<YGDimension, Dimensions, &YGStyle::dimensions_> dimensions() {
+    return {*this};
+  }
 
   const Dimensions& minDimensions() const { return minDimensions_; }
-  IdxRef<YGDimension, &YGStyle::minDimensions_> minDimensions() {
+  IdxRef<YGDimension, Dimensions, &YGStyle::minDimensions_> minDimensions() {
     return {*this};
   }
 
   const Dimensions& maxDimensions() const { return maxDimensions_; }
-  IdxRef<YGDimension, &YGStyle::maxDimensions_> maxDimensions() {
+  IdxRef<YGDimension, Dimensions, &YGStyle::maxDimensions_> maxDimensions() {
     return {*this};
   }
 
   // Yoga specific properties, not compatible with flexbox specification
   YGFloatOptional aspectRatio() const { return aspectRatio_; }
   Ref<YGFloatOptional, &YGStyle::aspectRatio_> aspectRatio() { return {*this}; }
+
+  // Bytes the style allocates besides its own size, including the values it
+  // shares with copies of itself.
+  size_t getAllocatedBytes() const {
+    return margin_.getAllocatedBytes() + position_.getAllocatedBytes() +
+        padding_.getAllocatedBytes() + border_.getAllocatedBytes();
+  }
 };
 
 YOGA_EXPORT bool operator==(const YGStyle& lhs, const YGStyle& rhs);
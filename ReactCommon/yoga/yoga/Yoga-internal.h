@@ -8,6 +8,7 @@
 #pragma once
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <vector>
 #include "CompactValue.h"
@@ -135,6 +136,105 @@ public:
   Values& operator=(const Values& other) = default;
 };
 
+// Values of a group of style properties (such as all margins) which copies of
+// a style share until one of them changes a value. Groups which keep their
+// default values do not allocate at all. A reference returned by `get()` is
+// only valid until the next `set()` on this group.
+template <size_t Size>
+class SharedValues {
+private:
+  struct Block {
+    std::atomic<uint32_t> refCount;
+    Values<Size> values;
+  };
+
+  static const Values<Size> defaultValues_;
+
+  Block* block_ = nullptr;
+
+  void retain() const noexcept {
+    if (block_ != nullptr) {
+      block_->refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void release() noexcept {
+    if (block_ != nullptr &&
+        block_->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete block_;
+    }
+    block_ = nullptr;
+  }
+
+  // Returns the values for writing, copying them first unless they are owned
+  // by this group alone.
+  Values<Size>& mutate() {
+    if (block_ == nullptr ||
+        block_->refCount.load(std::memory_order_acquire) != 1) {
+      Block* block = new Block{{1}, get()};
+      release();
+      block_ = block;
+    }
+    return block_->values;
+  }
+
+public:
+  SharedValues() = default;
+  SharedValues(const SharedValues& other) noexcept : block_(other.block_) {
+    retain();
+  }
+  SharedValues(SharedValues&& other) noexcept : block_(other.block_) {
+    other.block_ = nullptr;
+  }
+  ~SharedValues() { release(); }
+
+  SharedValues& operator=(const SharedValues& other) noexcept {
+    other.retain();
+    release();
+    block_ = other.block_;
+    return *this;
+  }
+
+  SharedValues& operator=(SharedValues&& other) noexcept {
+    if (this != &other) {
+      release();
+      block_ = other.block_;
+      other.block_ = nullptr;
+    }
+    return *this;
+  }
+
+  const Values<Size>& get() const noexcept {
+    return block_ != nullptr ? block_->values : defaultValues_;
+  }
+
+  void set(const Values<Size>& values) {
+    if (values == defaultValues_) {
+      release();
+    } else if (!(values == get())) {
+      mutate() = values;
+    }
+  }
+
+  void set(size_t i, CompactValue value) {
+    if (get()[i] != value) {
+      mutate()[i] = value;
+    }
+  }
+
+  // Bytes allocated for the values, whether they are shared or not.
+  size_t getAllocatedBytes() const noexcept {
+    return block_ != nullptr ? sizeof(Block) : 0;
+  }
+
+  bool operator==(const SharedValues& other) const noexcept {
+    return block_ == other.block_ || get() == other.get();
+  }
+};
+
+template <size_t Size>
+const Values<Size> SharedValues<Size>::defaultValues_{};
+
 } // namespace detail
 } // namespace yoga
 } // namespace facebook
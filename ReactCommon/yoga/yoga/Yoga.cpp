@@ -513,7 +513,7 @@ YOGA_EXPORT void YGNodeMarkDirty(const YGNodeRef node) {
       "Only leaf nodes with custom measure functions"
       "should manually mark themselves as dirty");
 
-  node->markDirtyAndPropogate();
+  node->markContentDirtyAndPropogate();
 }
 
 YOGA_EXPORT void YGNodeCopyStyle(
@@ -1018,6 +1018,7 @@ bool YGLayoutNodeInternal(
     const LayoutPassReason reason,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount);
@@ -1258,6 +1259,141 @@ static void YGConstrainMaxSizeForMode(
   }
 }
 
+// Computes the constraints `child` is measured with to resolve its flex basis
+// when neither its flex basis nor its main axis dimension is definite.
+static void YGNodeComputeFlexBasisMeasureConstraints(
+    const YGNodeRef node,
+    const YGNodeRef child,
+    const float width,
+    const YGMeasureMode widthMode,
+    const float height,
+    const float ownerWidth,
+    const float ownerHeight,
+    const YGMeasureMode heightMode,
+    const YGDirection direction,
+    float* childWidth,
+    YGMeasureMode* childWidthMeasureMode,
+    float* childHeight,
+    YGMeasureMode* childHeightMeasureMode) {
+  const YGFlexDirection mainAxis =
+      YGResolveFlexDirection(node->getStyle().flexDirection(), direction);
+  const bool isMainAxisRow = YGFlexDirectionIsRow(mainAxis);
+  const bool isRowStyleDimDefined =
+      YGNodeIsStyleDimDefined(child, YGFlexDirectionRow, ownerWidth);
+  const bool isColumnStyleDimDefined =
+      YGNodeIsStyleDimDefined(child, YGFlexDirectionColumn, ownerHeight);
+
+  *childWidth = YGUndefined;
+  *childHeight = YGUndefined;
+  *childWidthMeasureMode = YGMeasureModeUndefined;
+  *childHeightMeasureMode = YGMeasureModeUndefined;
+
+  auto marginRow =
+      child->getMarginForAxis(YGFlexDirectionRow, ownerWidth).unwrap();
+  auto marginColumn =
+      child->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap();
+
+  if (isRowStyleDimDefined) {
+    *childWidth =
+        YGResolveValue(
+            child->getResolvedDimensions()[YGDimensionWidth], ownerWidth)
+            .unwrap() +
+        marginRow;
+    *childWidthMeasureMode = YGMeasureModeExactly;
+  }
+  if (isColumnStyleDimDefined) {
+    *childHeight =
+        YGResolveValue(
+            child->getResolvedDimensions()[YGDimensionHeight], ownerHeight)
+            .unwrap() +
+        marginColumn;
+    *childHeightMeasureMode = YGMeasureModeExactly;
+  }
+
+  // The W3C spec doesn't say anything about the 'overflow' property, but all
+  // major browsers appear to implement the following logic.
+  if ((!isMainAxisRow && node->getStyle().overflow() == YGOverflowScroll) ||
+      node->getStyle().overflow() != YGOverflowScroll) {
+    if (YGFloatIsUndefined(*childWidth) && !YGFloatIsUndefined(width)) {
+      *childWidth = width;
+      *childWidthMeasureMode = YGMeasureModeAtMost;
+    }
+  }
+
+  if ((isMainAxisRow && node->getStyle().overflow() == YGOverflowScroll) ||
+      node->getStyle().overflow() != YGOverflowScroll) {
+    if (YGFloatIsUndefined(*childHeight) && !YGFloatIsUndefined(height)) {
+      *childHeight = height;
+      *childHeightMeasureMode = YGMeasureModeAtMost;
+    }
+  }
+
+  const auto& childStyle = child->getStyle();
+  if (!childStyle.aspectRatio().isUndefined()) {
+    if (!isMainAxisRow && *childWidthMeasureMode == YGMeasureModeExactly) {
+      *childHeight = marginColumn +
+          (*childWidth - marginRow) / childStyle.aspectRatio().unwrap();
+      *childHeightMeasureMode = YGMeasureModeExactly;
+    } else if (
+        isMainAxisRow && *childHeightMeasureMode == YGMeasureModeExactly) {
+      *childWidth = marginRow +
+          (*childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
+      *childWidthMeasureMode = YGMeasureModeExactly;
+    }
+  }
+
+  // If child has no defined size in the cross axis and is set to stretch, set
+  // the cross axis to be measured exactly with the available inner width
+
+  const bool hasExactWidth =
+      !YGFloatIsUndefined(width) && widthMode == YGMeasureModeExactly;
+  const bool childWidthStretch =
+      YGNodeAlignItem(node, child) == YGAlignStretch &&
+      *childWidthMeasureMode != YGMeasureModeExactly;
+  if (!isMainAxisRow && !isRowStyleDimDefined && hasExactWidth &&
+      childWidthStretch) {
+    *childWidth = width;
+    *childWidthMeasureMode = YGMeasureModeExactly;
+    if (!childStyle.aspectRatio().isUndefined()) {
+      *childHeight =
+          (*childWidth - marginRow) / childStyle.aspectRatio().unwrap();
+      *childHeightMeasureMode = YGMeasureModeExactly;
+    }
+  }
+
+  const bool hasExactHeight =
+      !YGFloatIsUndefined(height) && heightMode == YGMeasureModeExactly;
+  const bool childHeightStretch =
+      YGNodeAlignItem(node, child) == YGAlignStretch &&
+      *childHeightMeasureMode != YGMeasureModeExactly;
+  if (isMainAxisRow && !isColumnStyleDimDefined && hasExactHeight &&
+      childHeightStretch) {
+    *childHeight = height;
+    *childHeightMeasureMode = YGMeasureModeExactly;
+
+    if (!childStyle.aspectRatio().isUndefined()) {
+      *childWidth =
+          (*childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
+      *childWidthMeasureMode = YGMeasureModeExactly;
+    }
+  }
+
+  YGConstrainMaxSizeForMode(
+      child,
+      YGFlexDirectionRow,
+      ownerWidth,
+      ownerWidth,
+      childWidthMeasureMode,
+      childWidth);
+  YGConstrainMaxSizeForMode(
+      child,
+      YGFlexDirectionColumn,
+      ownerHeight,
+      ownerWidth,
+      childHeightMeasureMode,
+      childHeight);
+}
+
 static void YGNodeComputeFlexBasisForChild(
     const YGNodeRef node,
     const YGNodeRef child,
@@ -1270,6 +1406,7 @@ static void YGNodeComputeFlexBasisForChild(
     const YGDirection direction,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount) {
@@ -1322,115 +1459,20 @@ static void YGNodeComputeFlexBasisForChild(
   } else {
     // Compute the flex basis and hypothetical main size (i.e. the clamped flex
     // basis).
-    childWidth = YGUndefined;
-    childHeight = YGUndefined;
-    childWidthMeasureMode = YGMeasureModeUndefined;
-    childHeightMeasureMode = YGMeasureModeUndefined;
-
-    auto marginRow =
-        child->getMarginForAxis(YGFlexDirectionRow, ownerWidth).unwrap();
-    auto marginColumn =
-        child->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap();
-
-    if (isRowStyleDimDefined) {
-      childWidth =
-          YGResolveValue(
-              child->getResolvedDimensions()[YGDimensionWidth], ownerWidth)
-              .unwrap() +
-          marginRow;
-      childWidthMeasureMode = YGMeasureModeExactly;
-    }
-    if (isColumnStyleDimDefined) {
-      childHeight =
-          YGResolveValue(
-              child->getResolvedDimensions()[YGDimensionHeight], ownerHeight)
-              .unwrap() +
-          marginColumn;
-      childHeightMeasureMode = YGMeasureModeExactly;
-    }
-
-    // The W3C spec doesn't say anything about the 'overflow' property, but all
-    // major browsers appear to implement the following logic.
-    if ((!isMainAxisRow && node->getStyle().overflow() == YGOverflowScroll) ||
-        node->getStyle().overflow() != YGOverflowScroll) {
-      if (YGFloatIsUndefined(childWidth) && !YGFloatIsUndefined(width)) {
-        childWidth = width;
-        childWidthMeasureMode = YGMeasureModeAtMost;
-      }
-    }
-
-    if ((isMainAxisRow && node->getStyle().overflow() == YGOverflowScroll) ||
-        node->getStyle().overflow() != YGOverflowScroll) {
-      if (YGFloatIsUndefined(childHeight) && !YGFloatIsUndefined(height)) {
-        childHeight = height;
-        childHeightMeasureMode = YGMeasureModeAtMost;
-      }
-    }
-
-    const auto& childStyle = child->getStyle();
-    if (!childStyle.aspectRatio().isUndefined()) {
-      if (!isMainAxisRow && childWidthMeasureMode == YGMeasureModeExactly) {
-        childHeight = marginColumn +
-            (childWidth - marginRow) / childStyle.aspectRatio().unwrap();
-        childHeightMeasureMode = YGMeasureModeExactly;
-      } else if (
-          isMainAxisRow && childHeightMeasureMode == YGMeasureModeExactly) {
-        childWidth = marginRow +
-            (childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
-        childWidthMeasureMode = YGMeasureModeExactly;
-      }
-    }
-
-    // If child has no defined size in the cross axis and is set to stretch, set
-    // the cross axis to be measured exactly with the available inner width
-
-    const bool hasExactWidth =
-        !YGFloatIsUndefined(width) && widthMode == YGMeasureModeExactly;
-    const bool childWidthStretch =
-        YGNodeAlignItem(node, child) == YGAlignStretch &&
-        childWidthMeasureMode != YGMeasureModeExactly;
-    if (!isMainAxisRow && !isRowStyleDimDefined && hasExactWidth &&
-        childWidthStretch) {
-      childWidth = width;
-      childWidthMeasureMode = YGMeasureModeExactly;
-      if (!childStyle.aspectRatio().isUndefined()) {
-        childHeight =
-            (childWidth - marginRow) / childStyle.aspectRatio().unwrap();
-        childHeightMeasureMode = YGMeasureModeExactly;
-      }
-    }
-
-    const bool hasExactHeight =
-        !YGFloatIsUndefined(height) && heightMode == YGMeasureModeExactly;
-    const bool childHeightStretch =
-        YGNodeAlignItem(node, child) == YGAlignStretch &&
-        childHeightMeasureMode != YGMeasureModeExactly;
-    if (isMainAxisRow && !isColumnStyleDimDefined && hasExactHeight &&
-        childHeightStretch) {
-      childHeight = height;
-      childHeightMeasureMode = YGMeasureModeExactly;
-
-      if (!childStyle.aspectRatio().isUndefined()) {
-        childWidth =
-            (childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
-        childWidthMeasureMode = YGMeasureModeExactly;
-      }
-    }
-
-    YGConstrainMaxSizeForMode(
+    YGNodeComputeFlexBasisMeasureConstraints(
+        node,
         child,
-        YGFlexDirectionRow,
-        ownerWidth,
+        width,
+        widthMode,
+        height,
         ownerWidth,
-        &childWidthMeasureMode,
-        &childWidth);
-    YGConstrainMaxSizeForMode(
-        child,
-        YGFlexDirectionColumn,
         ownerHeight,
-        ownerWidth,
-        &childHeightMeasureMode,
-        &childHeight);
+        heightMode,
+        direction,
+        &childWidth,
+        &childWidthMeasureMode,
+        &childHeight,
+        &childHeightMeasureMode);
 
     // Measure the child
     YGLayoutNodeInternal(
@@ -1446,6 +1488,7 @@ static void YGNodeComputeFlexBasisForChild(
         LayoutPassReason::kMeasureChild,
         config,
         layoutMarkerData,
+        scratch,
         layoutContext,
         depth,
         generationCount);
@@ -1466,6 +1509,7 @@ static void YGNodeAbsoluteLayoutChild(
     const YGDirection direction,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount) {
@@ -1574,6 +1618,7 @@ static void YGNodeAbsoluteLayoutChild(
         LayoutPassReason::kAbsMeasureChild,
         config,
         layoutMarkerData,
+        scratch,
         layoutContext,
         depth,
         generationCount);
@@ -1596,6 +1641,7 @@ static void YGNodeAbsoluteLayoutChild(
       LayoutPassReason::kAbsLayout,
       config,
       layoutMarkerData,
+      scratch,
       layoutContext,
       depth,
       generationCount);
@@ -1658,6 +1704,44 @@ static void YGNodeAbsoluteLayoutChild(
   }
 }
 
+// Returns the size the measure function of `node` is called with for the given
+// available size.
+static YGSize YGNodeMeasureFuncInnerSize(
+    const YGNodeRef node,
+    const float availableWidth,
+    const float availableHeight,
+    const YGMeasureMode widthMeasureMode,
+    const YGMeasureMode heightMeasureMode,
+    const float ownerWidth) {
+  const float paddingAndBorderAxisRow =
+      YGNodePaddingAndBorderForAxis(node, YGFlexDirectionRow, ownerWidth);
+  const float paddingAndBorderAxisColumn =
+      YGNodePaddingAndBorderForAxis(node, YGFlexDirectionColumn, ownerWidth);
+  const float marginAxisRow =
+      node->getMarginForAxis(YGFlexDirectionRow, ownerWidth).unwrap();
+  const float marginAxisColumn =
+      node->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap();
+
+  const float width =
+      widthMeasureMode == YGMeasureModeUndefined ? YGUndefined : availableWidth;
+  const float height = heightMeasureMode == YGMeasureModeUndefined
+      ? YGUndefined
+      : availableHeight;
+
+  // We want to make sure we don't call measure with negative size
+  const float innerWidth = YGFloatIsUndefined(width)
+      ? width
+      : YGFloatMax(0, width - marginAxisRow - paddingAndBorderAxisRow);
+  const float innerHeight = YGFloatIsUndefined(height)
+      ? height
+      : YGFloatMax(0, height - marginAxisColumn - paddingAndBorderAxisColumn);
+  return YGSize{innerWidth, innerHeight};
+}
+
+static inline bool YGFloatsIdentical(const float a, const float b) {
+  return a == b || (YGFloatIsUndefined(a) && YGFloatIsUndefined(b));
+}
+
 static void YGNodeWithMeasureFuncSetMeasuredDimensions(
     const YGNodeRef node,
     float availableWidth,
@@ -1668,7 +1752,8 @@ static void YGNodeWithMeasureFuncSetMeasuredDimensions(
     const float ownerHeight,
     LayoutData& layoutMarkerData,
     void* const layoutContext,
-    const LayoutPassReason reason) {
+    const LayoutPassReason reason,
+    const uint32_t generationCount) {
   YGAssertWithNode(
       node,
       node->hasMeasureFunc(),
@@ -1690,14 +1775,15 @@ static void YGNodeWithMeasureFuncSetMeasuredDimensions(
   const float marginAxisColumn =
       node->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap();
 
-  // We want to make sure we don't call measure with negative size
-  const float innerWidth = YGFloatIsUndefined(availableWidth)
-      ? availableWidth
-      : YGFloatMax(0, availableWidth - marginAxisRow - paddingAndBorderAxisRow);
-  const float innerHeight = YGFloatIsUndefined(availableHeight)
-      ? availableHeight
-      : YGFloatMax(
-            0, availableHeight - marginAxisColumn - paddingAndBorderAxisColumn);
+  const YGSize innerSize = YGNodeMeasureFuncInnerSize(
+      node,
+      availableWidth,
+      availableHeight,
+      widthMeasureMode,
+      heightMeasureMode,
+      ownerWidth);
+  const float innerWidth = innerSize.width;
+  const float innerHeight = innerSize.height;
 
   if (widthMeasureMode == YGMeasureModeExactly &&
       heightMeasureMode == YGMeasureModeExactly) {
@@ -1721,13 +1807,23 @@ static void YGNodeWithMeasureFuncSetMeasuredDimensions(
   } else {
     Event::publish<Event::MeasureCallbackStart>(node);
 
-    // Measure the text under the current constraints.
-    const YGSize measuredSize = node->measure(
-        innerWidth,
-        widthMeasureMode,
-        innerHeight,
-        heightMeasureMode,
-        layoutContext);
+    // Measure the text under the current constraints, unless a batch
+    // measurement already did.
+    const YGLayout& layout = node->getLayout();
+    const YGCachedMeasurement& prefetched = layout.prefetchedMeasurement;
+    const YGSize measuredSize =
+        layout.prefetchedMeasurementGeneration == generationCount &&
+            prefetched.widthMeasureMode == widthMeasureMode &&
+            prefetched.heightMeasureMode == heightMeasureMode &&
+            YGFloatsIdentical(prefetched.availableWidth, innerWidth) &&
+            YGFloatsIdentical(prefetched.availableHeight, innerHeight)
+        ? YGSize{prefetched.computedWidth, prefetched.computedHeight}
+        : node->measure(
+              innerWidth,
+              widthMeasureMode,
+              innerHeight,
+              heightMeasureMode,
+              layoutContext);
 
     layoutMarkerData.measureCallbacks += 1;
     layoutMarkerData.measureCallbackReasonsCount[static_cast<size_t>(reason)] +=
@@ -1917,6 +2013,183 @@ static float YGNodeCalculateAvailableInnerDim(
   return availableInnerDim;
 }
 
+// Returns true if the cached results of `node` must not be used in the layout
+// pass with the given generation.
+static inline bool YGNodeNeedsToVisit(
+    const YGNodeRef node,
+    const YGDirection ownerDirection,
+    const uint32_t generationCount) {
+  const YGLayout& layout = node->getLayout();
+  return (node->isDirty() && layout.generationCount != generationCount) ||
+      layout.lastOwnerDirection != ownerDirection;
+}
+
+// Returns the cached measurement of a node with a measure function which can
+// be used for the given available size, if any.
+static YGCachedMeasurement* YGNodeFindCachedMeasurement(
+    const YGNodeRef node,
+    const float availableWidth,
+    const float availableHeight,
+    const YGMeasureMode widthMeasureMode,
+    const YGMeasureMode heightMeasureMode,
+    const float ownerWidth,
+    const YGConfigRef config) {
+  YGLayout* layout = &node->getLayout();
+  const float marginAxisRow =
+      node->getMarginForAxis(YGFlexDirectionRow, ownerWidth).unwrap();
+  const float marginAxisColumn =
+      node->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap();
+
+  // First, try to use the layout cache.
+  if (YGNodeCanUseCachedMeasurement(
+          widthMeasureMode,
+          availableWidth,
+          heightMeasureMode,
+          availableHeight,
+          layout->cachedLayout.widthMeasureMode,
+          layout->cachedLayout.availableWidth,
+          layout->cachedLayout.heightMeasureMode,
+          layout->cachedLayout.availableHeight,
+          layout->cachedLayout.computedWidth,
+          layout->cachedLayout.computedHeight,
+          marginAxisRow,
+          marginAxisColumn,
+          config)) {
+    return &layout->cachedLayout;
+  }
+
+  // Try to use the measurement cache.
+  for (uint32_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
+    if (YGNodeCanUseCachedMeasurement(
+            widthMeasureMode,
+            availableWidth,
+            heightMeasureMode,
+            availableHeight,
+            layout->cachedMeasurements[i].widthMeasureMode,
+            layout->cachedMeasurements[i].availableWidth,
+            layout->cachedMeasurements[i].heightMeasureMode,
+            layout->cachedMeasurements[i].availableHeight,
+            layout->cachedMeasurements[i].computedWidth,
+            layout->cachedMeasurements[i].computedHeight,
+            marginAxisRow,
+            marginAxisColumn,
+            config)) {
+      return &layout->cachedMeasurements[i];
+    }
+  }
+  return nullptr;
+}
+
+// Measures the leaf children of `node` which YGNodeComputeFlexBasisForChildren
+// is going to measure in one batch, see `YGConfig::setMeasureBatchFunc`.
+// Children whose measurement is cached are skipped.
+static void YGNodePrefetchFlexBasisMeasurements(
+    const YGNodeRef node,
+    const YGNodeRef singleFlexChild,
+    const float availableInnerWidth,
+    const float availableInnerHeight,
+    const YGMeasureMode widthMeasureMode,
+    const YGMeasureMode heightMeasureMode,
+    const YGDirection direction,
+    const YGFlexDirection mainAxis,
+    const YGConfigRef config,
+    YGLayoutScratch& scratch,
+    void* const layoutContext,
+    const uint32_t generationCount) {
+  const bool isMainAxisRow = YGFlexDirectionIsRow(mainAxis);
+  const float mainAxisSize =
+      isMainAxisRow ? availableInnerWidth : availableInnerHeight;
+
+  std::vector<YGMeasureRequest>& requests = scratch.measureRequests;
+  requests.clear();
+  for (auto child : node->getChildren()) {
+    if (!child->hasMeasureFunc() || child == singleFlexChild ||
+        child->getStyle().display() == YGDisplayNone ||
+        child->getStyle().positionType() == YGPositionTypeAbsolute) {
+      continue;
+    }
+
+    // Same conditions as in YGNodeComputeFlexBasisForChild.
+    child->resolveDimension();
+    const YGFloatOptional resolvedFlexBasis =
+        YGResolveValue(child->resolveFlexBasisPtr(), mainAxisSize);
+    if ((!resolvedFlexBasis.isUndefined() &&
+         !YGFloatIsUndefined(mainAxisSize)) ||
+        YGNodeIsStyleDimDefined(child, mainAxis, mainAxisSize)) {
+      continue;
+    }
+
+    float childWidth;
+    float childHeight;
+    YGMeasureMode childWidthMeasureMode;
+    YGMeasureMode childHeightMeasureMode;
+    YGNodeComputeFlexBasisMeasureConstraints(
+        node,
+        child,
+        availableInnerWidth,
+        widthMeasureMode,
+        availableInnerHeight,
+        availableInnerWidth,
+        availableInnerHeight,
+        heightMeasureMode,
+        direction,
+        &childWidth,
+        &childWidthMeasureMode,
+        &childHeight,
+        &childHeightMeasureMode);
+
+    if ((childWidthMeasureMode == YGMeasureModeExactly &&
+         childHeightMeasureMode == YGMeasureModeExactly) ||
+        (!YGNodeNeedsToVisit(child, direction, generationCount) &&
+         YGNodeFindCachedMeasurement(
+             child,
+             childWidth,
+             childHeight,
+             childWidthMeasureMode,
+             childHeightMeasureMode,
+             availableInnerWidth,
+             config) != nullptr)) {
+      continue;
+    }
+
+    // Measure functions may depend on the layout direction, which is only
+    // set once the child is laid out.
+    child->setLayoutDirection(child->resolveDirection(direction));
+
+    const YGSize innerSize = YGNodeMeasureFuncInnerSize(
+        child,
+        childWidth,
+        childHeight,
+        childWidthMeasureMode,
+        childHeightMeasureMode,
+        availableInnerWidth);
+    requests.push_back({child,
+                        innerSize.width,
+                        childWidthMeasureMode,
+                        innerSize.height,
+                        childHeightMeasureMode,
+                        {YGUndefined, YGUndefined}});
+  }
+
+  // A single measurement is as well done the usual way.
+  if (requests.size() < 2) {
+    return;
+  }
+
+  config->measureBatch(requests.data(), requests.size(), layoutContext);
+
+  for (const auto& request : requests) {
+    YGLayout& layout = request.node->getLayout();
+    layout.prefetchedMeasurementGeneration = generationCount;
+    layout.prefetchedMeasurement.availableWidth = request.width;
+    layout.prefetchedMeasurement.availableHeight = request.height;
+    layout.prefetchedMeasurement.widthMeasureMode = request.widthMode;
+    layout.prefetchedMeasurement.heightMeasureMode = request.heightMode;
+    layout.prefetchedMeasurement.computedWidth = request.size.width;
+    layout.prefetchedMeasurement.computedHeight = request.size.height;
+  }
+}
+
 static float YGNodeComputeFlexBasisForChildren(
     const YGNodeRef node,
     const float availableInnerWidth,
@@ -1928,6 +2201,7 @@ static float YGNodeComputeFlexBasisForChildren(
     const YGConfigRef config,
     bool performLayout,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount) {
@@ -1956,6 +2230,22 @@ static float YGNodeComputeFlexBasisForChildren(
     }
   }
 
+  if (config->hasMeasureBatchFunc()) {
+    YGNodePrefetchFlexBasisMeasurements(
+        node,
+        singleFlexChild,
+        availableInnerWidth,
+        availableInnerHeight,
+        widthMeasureMode,
+        heightMeasureMode,
+        direction,
+        mainAxis,
+        config,
+        scratch,
+        layoutContext,
+        generationCount);
+  }
+
   for (auto child : children) {
     child->resolveDimension();
     if (child->getStyle().display() == YGDisplayNone) {
@@ -1996,6 +2286,7 @@ static float YGNodeComputeFlexBasisForChildren(
           direction,
           config,
           layoutMarkerData,
+          scratch,
           layoutContext,
           depth,
           generationCount);
@@ -2014,7 +2305,8 @@ static float YGNodeComputeFlexBasisForChildren(
 // computedFlexBasis properly computed(To do this use
 // YGNodeComputeFlexBasisForChildren function). This function calculates
 // YGCollectFlexItemsRowMeasurement
-static YGCollectFlexItemsRowValues YGCalculateCollectFlexItemsRowValues(
+static void YGCalculateCollectFlexItemsRowValues(
+    YGCollectFlexItemsRowValues& flexAlgoRowMeasurement,
     const YGNodeRef& node,
     const YGDirection ownerDirection,
     const float mainAxisownerSize,
@@ -2022,8 +2314,6 @@ static YGCollectFlexItemsRowValues YGCalculateCollectFlexItemsRowValues(
     const float availableInnerMainDim,
     const uint32_t startOfLineIndex,
     const uint32_t lineCount) {
-  YGCollectFlexItemsRowValues flexAlgoRowMeasurement = {};
-  flexAlgoRowMeasurement.relativeChildren.reserve(node->getChildren().size());
 
   float sizeConsumedOnCurrentLineIncludingMinConstraint = 0;
   const YGFlexDirection mainAxis = YGResolveFlexDirection(
@@ -2090,7 +2380,6 @@ static YGCollectFlexItemsRowValues YGCalculateCollectFlexItemsRowValues(
     flexAlgoRowMeasurement.totalFlexShrinkScaledFactors = 1;
   }
   flexAlgoRowMeasurement.endOfLineIndex = endOfLineIndex;
-  return flexAlgoRowMeasurement;
 }
 
 // It distributes the free space to the flexible items and ensures that the size
@@ -2112,6 +2401,7 @@ static float YGDistributeFreeSpaceSecondPass(
     const bool performLayout,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount) {
@@ -2282,6 +2572,7 @@ static float YGDistributeFreeSpaceSecondPass(
                      : LayoutPassReason::kFlexMeasure,
         config,
         layoutMarkerData,
+        scratch,
         layoutContext,
         depth,
         generationCount);
@@ -2416,6 +2707,7 @@ static void YGResolveFlexibleLength(
     const bool performLayout,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount) {
@@ -2444,6 +2736,7 @@ static void YGResolveFlexibleLength(
       performLayout,
       config,
       layoutMarkerData,
+      scratch,
       layoutContext,
       depth,
       generationCount);
@@ -2746,6 +3039,7 @@ static void YGNodelayoutImpl(
     const bool performLayout,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     const uint32_t depth,
     const uint32_t generationCount,
@@ -2819,7 +3113,8 @@ static void YGNodelayoutImpl(
         ownerHeight,
         layoutMarkerData,
         layoutContext,
-        reason);
+        reason,
+        generationCount);
     return;
   }
 
@@ -2931,6 +3226,7 @@ static void YGNodelayoutImpl(
       config,
       performLayout,
       layoutMarkerData,
+      scratch,
       layoutContext,
       depth,
       generationCount);
@@ -2956,10 +3252,11 @@ static void YGNodelayoutImpl(
 
   // Max main dimension of all the lines.
   float maxLineMainDim = 0;
-  YGCollectFlexItemsRowValues collectedFlexItemsValues;
   for (; endOfLineIndex < childCount;
        lineCount++, startOfLineIndex = endOfLineIndex) {
-    collectedFlexItemsValues = YGCalculateCollectFlexItemsRowValues(
+    YGCollectFlexItemsRowValues collectedFlexItemsValues{scratch};
+    YGCalculateCollectFlexItemsRowValues(
+        collectedFlexItemsValues,
         node,
         ownerDirection,
         mainAxisownerSize,
@@ -3041,6 +3338,7 @@ static void YGNodelayoutImpl(
           performLayout,
           config,
           layoutMarkerData,
+          scratch,
           layoutContext,
           depth,
           generationCount);
@@ -3217,6 +3515,7 @@ static void YGNodelayoutImpl(
                   LayoutPassReason::kStretch,
                   config,
                   layoutMarkerData,
+                  scratch,
                   layoutContext,
                   depth,
                   generationCount);
@@ -3427,6 +3726,7 @@ static void YGNodelayoutImpl(
                         LayoutPassReason::kMultilineStretch,
                         config,
                         layoutMarkerData,
+                        scratch,
                         layoutContext,
                         depth,
                         generationCount);
@@ -3569,6 +3869,7 @@ static void YGNodelayoutImpl(
           direction,
           config,
           layoutMarkerData,
+          scratch,
           layoutContext,
           depth,
           generationCount);
@@ -3783,6 +4084,161 @@ YOGA_EXPORT bool YGNodeCanUseCachedMeasurement(
   return widthIsCompatible && heightIsCompatible;
 }
 
+// Whether the style of the node has percentages, which are resolved against
+// the size of its owner.
+static bool YGNodeStyleHasPercentages(const YGNodeConstRef node) {
+  const YGStyle& style = node->getStyle();
+  const auto isPercent = [](detail::CompactValue value) {
+    return YGValue(value).unit == YGUnitPercent;
+  };
+  for (size_t i = 0; i < enums::count<YGEdge>(); i++) {
+    if (isPercent(style.margin()[i]) || isPercent(style.position()[i]) ||
+        isPercent(style.padding()[i])) {
+      return true;
+    }
+  }
+  for (size_t i = 0; i < enums::count<YGDimension>(); i++) {
+    if (isPercent(style.dimensions()[i]) ||
+        isPercent(style.minDimensions()[i]) ||
+        isPercent(style.maxDimensions()[i])) {
+      return true;
+    }
+  }
+  return isPercent(style.flexBasis());
+}
+
+// Checks whether the cached results of a node which is dirty only in its
+// content (see `YGNode::markContentDirty`) are still valid, which is the case
+// if every dirty child comes up with the same measurements for all available
+// sizes it was asked for before. Such children are laid out again (or
+// revalidated in turn), but the node itself is not: the positions it gave its
+// children only depend on their measurements.
+//
+// Returns false if the node has to be laid out again. The children laid out
+// by then keep their new results, which are cached for that layout.
+static bool YGNodeRevalidateCachedResults(
+    const YGNodeRef node,
+    const YGConfigRef config,
+    LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
+    void* const layoutContext,
+    const uint32_t depth,
+    const uint32_t generationCount) {
+  // Baselines depend on the layout of descendants, not only on measurements.
+  // Overflow of the node might come from any of the (intermediate) layouts of
+  // its children, which are not cached.
+  if (node->hasMeasureFunc() || YGIsBaselineLayout(node) ||
+      node->getLayout().hadOverflow()) {
+    return false;
+  }
+
+  const YGDirection direction = node->getLayout().direction();
+  const uint32_t childCount = YGNodeGetChildCount(node);
+  for (uint32_t i = 0; i < childCount; i++) {
+    if (node->getChild(i)->getLayout().hadOverflow()) {
+      return false;
+    }
+    if (!node->getChild(i)->isDirty()) {
+      continue;
+    }
+
+    // The available sizes are cached, but not the sizes of the owner they
+    // were computed for, so percentages can't be resolved again. Absolute
+    // children are positioned by their size, and hidden ones are not cached.
+    const YGNodeRef child = node->cloneChildIfNeeded(i, layoutContext);
+    YGLayout& childLayout = child->getLayout();
+    if (!child->isDirtyOnlyInContent() ||
+        child->getStyle().positionType() == YGPositionTypeAbsolute ||
+        child->getStyle().display() == YGDisplayNone ||
+        childLayout.lastOwnerDirection != direction ||
+        childLayout.didEvictCachedMeasurements() ||
+        childLayout.cachedLayout.computedWidth < 0 ||
+        YGNodeStyleHasPercentages(child)) {
+      return false;
+    }
+
+    const YGCachedMeasurement cachedLayout = childLayout.cachedLayout;
+    const uint32_t cachedMeasurementCount =
+        childLayout.nextCachedMeasurementsIndex;
+    const auto cachedMeasurements = childLayout.cachedMeasurements;
+
+    // The position stays where the node put it.
+    if (childLayout.roundedPointScaleFactor != 0) {
+      child->setLayoutPosition(childLayout.unroundedPosition[0], YGEdgeLeft);
+      child->setLayoutPosition(childLayout.unroundedPosition[1], YGEdgeTop);
+    }
+
+    // Asks for the measurements in the order the node did, the layout last.
+    for (uint32_t j = 0; j <= cachedMeasurementCount; j++) {
+      const bool performLayout = j == cachedMeasurementCount;
+      const YGCachedMeasurement& measurement =
+          performLayout ? cachedLayout : cachedMeasurements[j];
+      YGLayoutNodeInternal(
+          child,
+          measurement.availableWidth,
+          measurement.availableHeight,
+          direction,
+          measurement.widthMeasureMode,
+          measurement.heightMeasureMode,
+          YGUndefined,
+          YGUndefined,
+          performLayout,
+          performLayout ? LayoutPassReason::kFlexLayout
+                        : LayoutPassReason::kMeasureChild,
+          config,
+          layoutMarkerData,
+          scratch,
+          layoutContext,
+          depth,
+          generationCount);
+      if (!YGFloatsEqual(
+              childLayout.measuredDimensions[YGDimensionWidth],
+              measurement.computedWidth) ||
+          !YGFloatsEqual(
+              childLayout.measuredDimensions[YGDimensionHeight],
+              measurement.computedHeight) ||
+          childLayout.hadOverflow()) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// Called before the layout cache entry of a node is replaced. Nodes can be
+// laid out more than once per layout pass (e.g. to stretch them), and their
+// owners might have used the results of the previous layout. Incremental
+// layout needs every request the owner made to be cached, so the previous
+// layout stays cached as a measurement.
+static void YGNodeRetireCachedLayout(
+    const YGNodeRef node,
+    const YGConfigRef config) {
+  YGLayout& layout = node->getLayout();
+  const YGCachedMeasurement& cachedLayout = layout.cachedLayout;
+  if (cachedLayout.computedWidth < 0) {
+    return;
+  }
+  if (!config->incrementalLayout ||
+      layout.nextCachedMeasurementsIndex == YG_MAX_CACHED_RESULT_COUNT) {
+    layout.setDidEvictCachedMeasurements(true);
+    return;
+  }
+
+  for (uint32_t i = 0; i < layout.nextCachedMeasurementsIndex; i++) {
+    const YGCachedMeasurement& measurement = layout.cachedMeasurements[i];
+    if (YGFloatsEqual(measurement.availableWidth, cachedLayout.availableWidth) &&
+        YGFloatsEqual(
+            measurement.availableHeight, cachedLayout.availableHeight) &&
+        measurement.widthMeasureMode == cachedLayout.widthMeasureMode &&
+        measurement.heightMeasureMode == cachedLayout.heightMeasureMode) {
+      return;
+    }
+  }
+  layout.cachedMeasurements[layout.nextCachedMeasurementsIndex] = cachedLayout;
+  layout.nextCachedMeasurementsIndex++;
+}
+
 //
 // This is a wrapper around the YGNodelayoutImpl function. It determines whether
 // the layout request is redundant and can be skipped.
@@ -3804,6 +4260,7 @@ bool YGLayoutNodeInternal(
     const LayoutPassReason reason,
     const YGConfigRef config,
     LayoutData& layoutMarkerData,
+    YGLayoutScratch& scratch,
     void* const layoutContext,
     uint32_t depth,
     const uint32_t generationCount) {
@@ -3811,12 +4268,29 @@ bool YGLayoutNodeInternal(
 
   depth++;
 
-  const bool needToVisitNode =
-      (node->isDirty() && layout->generationCount != generationCount) ||
-      layout->lastOwnerDirection != ownerDirection;
+  bool needToVisitNode =
+      YGNodeNeedsToVisit(node, ownerDirection, generationCount);
+
+  // A node which is dirty only in its content might not need to be visited.
+  const bool didRevalidateNode = needToVisitNode &&
+      config->incrementalLayout && node->isDirtyOnlyInContent() &&
+      layout->lastOwnerDirection == ownerDirection &&
+      YGNodeRevalidateCachedResults(
+          node,
+          config,
+          layoutMarkerData,
+          scratch,
+          layoutContext,
+          depth,
+          generationCount);
+  if (didRevalidateNode) {
+    needToVisitNode = false;
+  }
 
   if (needToVisitNode) {
     // Invalidate the cached results.
+    layout->setIsDirtyOnlyInContent(false);
+    layout->setDidEvictCachedMeasurements(false);
     layout->nextCachedMeasurementsIndex = 0;
     layout->cachedLayout.availableWidth = -1;
     layout->cachedLayout.availableHeight = -1;
@@ -3837,49 +4311,14 @@ bool YGLayoutNodeInternal(
   // they are the most expensive to measure, so it's worth avoiding redundant
   // measurements if at all possible.
   if (node->hasMeasureFunc()) {
-    const float marginAxisRow =
-        node->getMarginForAxis(YGFlexDirectionRow, ownerWidth).unwrap();
-    const float marginAxisColumn =
-        node->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap();
-
-    // First, try to use the layout cache.
-    if (YGNodeCanUseCachedMeasurement(
-            widthMeasureMode,
-            availableWidth,
-            heightMeasureMode,
-            availableHeight,
-            layout->cachedLayout.widthMeasureMode,
-            layout->cachedLayout.availableWidth,
-            layout->cachedLayout.heightMeasureMode,
-            layout->cachedLayout.availableHeight,
-            layout->cachedLayout.computedWidth,
-            layout->cachedLayout.computedHeight,
-            marginAxisRow,
-            marginAxisColumn,
-            config)) {
-      cachedResults = &layout->cachedLayout;
-    } else {
-      // Try to use the measurement cache.
-      for (uint32_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
-        if (YGNodeCanUseCachedMeasurement(
-                widthMeasureMode,
-                availableWidth,
-                heightMeasureMode,
-                availableHeight,
-                layout->cachedMeasurements[i].widthMeasureMode,
-                layout->cachedMeasurements[i].availableWidth,
-                layout->cachedMeasurements[i].heightMeasureMode,
-                layout->cachedMeasurements[i].availableHeight,
-                layout->cachedMeasurements[i].computedWidth,
-                layout->cachedMeasurements[i].computedHeight,
-                marginAxisRow,
-                marginAxisColumn,
-                config)) {
-          cachedResults = &layout->cachedMeasurements[i];
-          break;
-        }
-      }
-    }
+    cachedResults = YGNodeFindCachedMeasurement(
+        node,
+        availableWidth,
+        availableHeight,
+        widthMeasureMode,
+        heightMeasureMode,
+        ownerWidth,
+        config);
   } else if (performLayout) {
     if (YGFloatsEqual(layout->cachedLayout.availableWidth, availableWidth) &&
         YGFloatsEqual(layout->cachedLayout.availableHeight, availableHeight) &&
@@ -3907,6 +4346,14 @@ bool YGLayoutNodeInternal(
     layout->measuredDimensions[YGDimensionHeight] =
         cachedResults->computedHeight;
 
+    // Nodes with measure functions might take their layout from a cached
+    // measurement. The layout cache entry is kept as the request the layout
+    // was computed for, which incremental layout asks for again.
+    if (performLayout && cachedResults != &layout->cachedLayout) {
+      YGNodeRetireCachedLayout(node, config);
+      layout->cachedLayout = *cachedResults;
+    }
+
     (performLayout ? layoutMarkerData.cachedLayouts
                    : layoutMarkerData.cachedMeasures) += 1;
 
@@ -3967,6 +4414,7 @@ bool YGLayoutNodeInternal(
         performLayout,
         config,
         layoutMarkerData,
+        scratch,
         layoutContext,
         depth,
         generationCount,
@@ -4007,11 +4455,13 @@ bool YGLayoutNodeInternal(
           Log::log(node, YGLogLevelVerbose, nullptr, "Out of cache entries!\n");
         }
         layout->nextCachedMeasurementsIndex = 0;
+        layout->setDidEvictCachedMeasurements(true);
       }
 
       YGCachedMeasurement* newCacheEntry;
       if (performLayout) {
         // Use the single layout cache entry.
+        YGNodeRetireCachedLayout(node, config);
         newCacheEntry = &layout->cachedLayout;
       } else {
         // Allocate a new measurement cache entry.
@@ -4041,6 +4491,7 @@ bool YGLayoutNodeInternal(
 
     node->setHasNewLayout(true);
     node->setDirty(false);
+    layout->roundedPointScaleFactor = 0;
   }
 
   layout->generationCount = generationCount;
@@ -4056,7 +4507,8 @@ bool YGLayoutNodeInternal(
   }
   Event::publish<Event::NodeLayout>(node, {layoutType, layoutContext});
 
-  return (needToVisitNode || cachedResults == nullptr);
+  // The layouts in the subtree of a revalidated node changed as well.
+  return (needToVisitNode || didRevalidateNode || cachedResults == nullptr);
 }
 
 YOGA_EXPORT void YGConfigSetPointScaleFactor(
@@ -4085,6 +4537,19 @@ static void YGRoundToPixelGrid(
     return;
   }
 
+  YGLayout& layout = node->getLayout();
+
+  // A layout which was rounded before is rounded again from its values
+  // before rounding.
+  if (layout.roundedPointScaleFactor != 0) {
+    node->setLayoutPosition(layout.unroundedPosition[0], YGEdgeLeft);
+    node->setLayoutPosition(layout.unroundedPosition[1], YGEdgeTop);
+    node->setLayoutDimension(
+        layout.unroundedDimensions[0], YGDimensionWidth);
+    node->setLayoutDimension(
+        layout.unroundedDimensions[1], YGDimensionHeight);
+  }
+
   const double nodeLeft = node->getLayout().position[YGEdgeLeft];
   const double nodeTop = node->getLayout().position[YGEdgeTop];
 
@@ -4101,6 +4566,9 @@ static void YGRoundToPixelGrid(
   // size as this could lead to unwanted text truncation.
   const bool textRounding = node->getNodeType() == YGNodeTypeText;
 
+  layout.unroundedPosition = {{(float) nodeLeft, (float) nodeTop}};
+  layout.unroundedDimensions = {{(float) nodeWidth, (float) nodeHeight}};
+  layout.roundedOwnerPosition = {{(float) absoluteLeft, (float) absoluteTop}};
   node->setLayoutPosition(
       YGRoundValueToPixelGrid(nodeLeft, pointScaleFactor, false, textRounding),
       YGEdgeLeft);
@@ -4139,13 +4607,25 @@ static void YGRoundToPixelGrid(
               absoluteNodeTop, pointScaleFactor, false, textRounding),
       YGDimensionHeight);
 
+  layout.roundedPointScaleFactor = (float) pointScaleFactor;
+
   const uint32_t childCount = YGNodeGetChildCount(node);
   for (uint32_t i = 0; i < childCount; i++) {
+    const YGNodeRef child = YGNodeGetChild(node, i);
+    const YGLayout& childLayout = child->getLayout();
+
+    // The layout of the child was not computed in this layout pass, so the
+    // layouts in its subtree are rounded already. Unless the node moved, they
+    // would be rounded to the same values again. A node moved by a fraction
+    // of a pixel rounds its subtree differently, e.g. to wider text nodes.
+    if (childLayout.roundedPointScaleFactor == pointScaleFactor &&
+        childLayout.roundedOwnerPosition[0] == (float) absoluteNodeLeft &&
+        childLayout.roundedOwnerPosition[1] == (float) absoluteNodeTop) {
+      continue;
+    }
+
     YGRoundToPixelGrid(
-        YGNodeGetChild(node, i),
-        pointScaleFactor,
-        absoluteNodeLeft,
-        absoluteNodeTop);
+        child, pointScaleFactor, absoluteNodeLeft, absoluteNodeTop);
   }
 }
 
@@ -4165,6 +4645,9 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
 
   Event::publish<Event::LayoutPassStart>(node, {layoutContext});
   LayoutData markerData = {};
+  // Temporary lists of all the containers laid out in this pass, released
+  // at the end of the pass.
+  YGLayoutScratch scratch;
 
   // Increment the generation count. This will force the recursive routine to
   // visit all dirty nodes at least once. Subsequent visits will be skipped if
@@ -4211,6 +4694,7 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
     heightMeasureMode = YGFloatIsUndefined(height) ? YGMeasureModeUndefined
                                                    : YGMeasureModeExactly;
   }
+  // A layout of the root taken from the cache is not rounded either.
   if (YGLayoutNodeInternal(
           node,
           width,
@@ -4224,9 +4708,12 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
           LayoutPassReason::kInitial,
           node->getConfig(),
           markerData,
+          scratch,
           layoutContext,
           0, // tree root
-          gCurrentGenerationCount.load(std::memory_order_relaxed))) {
+          gCurrentGenerationCount.load(std::memory_order_relaxed)) ||
+      node->getLayout().roundedPointScaleFactor !=
+          node->getConfig()->pointScaleFactor) {
     node->setPosition(
         node->getLayout().direction(), ownerWidth, ownerHeight, ownerWidth);
     YGRoundToPixelGrid(node, node->getConfig()->pointScaleFactor, 0.0f, 0.0f);
@@ -4274,6 +4761,7 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
             LayoutPassReason::kInitial,
             nodeWithoutLegacyFlag->getConfig(),
             layoutMarkerData,
+            scratch,
             layoutContext,
             0, // tree root
             gCurrentGenerationCount.load(std::memory_order_relaxed))) {